@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/mock/Core/Arduino.cpp" "mock/CMakeFiles/ArduinoMock.dir/Core/Arduino.cpp.o" "gcc" "mock/CMakeFiles/ArduinoMock.dir/Core/Arduino.cpp.o.d"
+  "/root/repo/mock/Core/ArduinoMock.cpp" "mock/CMakeFiles/ArduinoMock.dir/Core/ArduinoMock.cpp.o" "gcc" "mock/CMakeFiles/ArduinoMock.dir/Core/ArduinoMock.cpp.o.d"
+  "/root/repo/mock/Core/HardwareSerial0.cpp" "mock/CMakeFiles/ArduinoMock.dir/Core/HardwareSerial0.cpp.o" "gcc" "mock/CMakeFiles/ArduinoMock.dir/Core/HardwareSerial0.cpp.o.d"
+  "/root/repo/mock/Core/Print.cpp" "mock/CMakeFiles/ArduinoMock.dir/Core/Print.cpp.o" "gcc" "mock/CMakeFiles/ArduinoMock.dir/Core/Print.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
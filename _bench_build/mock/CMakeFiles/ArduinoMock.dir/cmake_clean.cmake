@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ArduinoMock.dir/Core/Arduino.cpp.o"
+  "CMakeFiles/ArduinoMock.dir/Core/Arduino.cpp.o.d"
+  "CMakeFiles/ArduinoMock.dir/Core/ArduinoMock.cpp.o"
+  "CMakeFiles/ArduinoMock.dir/Core/ArduinoMock.cpp.o.d"
+  "CMakeFiles/ArduinoMock.dir/Core/HardwareSerial0.cpp.o"
+  "CMakeFiles/ArduinoMock.dir/Core/HardwareSerial0.cpp.o.d"
+  "CMakeFiles/ArduinoMock.dir/Core/Print.cpp.o"
+  "CMakeFiles/ArduinoMock.dir/Core/Print.cpp.o.d"
+  "libArduinoMock.a"
+  "libArduinoMock.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ArduinoMock.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/AH/Debug/Debug.cpp" "src/AH/CMakeFiles/Arduino_Helpers.dir/Debug/Debug.cpp.o" "gcc" "src/AH/CMakeFiles/Arduino_Helpers.dir/Debug/Debug.cpp.o.d"
+  "/root/repo/src/AH/Error/Exit.cpp" "src/AH/CMakeFiles/Arduino_Helpers.dir/Error/Exit.cpp.o" "gcc" "src/AH/CMakeFiles/Arduino_Helpers.dir/Error/Exit.cpp.o.d"
+  "/root/repo/src/AH/Hardware/Button.cpp" "src/AH/CMakeFiles/Arduino_Helpers.dir/Hardware/Button.cpp.o" "gcc" "src/AH/CMakeFiles/Arduino_Helpers.dir/Hardware/Button.cpp.o.d"
+  "/root/repo/src/AH/Hardware/ExtendedInputOutput/ExtendedIOElement.cpp" "src/AH/CMakeFiles/Arduino_Helpers.dir/Hardware/ExtendedInputOutput/ExtendedIOElement.cpp.o" "gcc" "src/AH/CMakeFiles/Arduino_Helpers.dir/Hardware/ExtendedInputOutput/ExtendedIOElement.cpp.o.d"
+  "/root/repo/src/AH/Hardware/ExtendedInputOutput/ExtendedInputOutput.cpp" "src/AH/CMakeFiles/Arduino_Helpers.dir/Hardware/ExtendedInputOutput/ExtendedInputOutput.cpp.o" "gcc" "src/AH/CMakeFiles/Arduino_Helpers.dir/Hardware/ExtendedInputOutput/ExtendedInputOutput.cpp.o.d"
+  "/root/repo/src/AH/Hardware/ExtendedInputOutput/SPIShiftRegisterOut.cpp" "src/AH/CMakeFiles/Arduino_Helpers.dir/Hardware/ExtendedInputOutput/SPIShiftRegisterOut.cpp.o" "gcc" "src/AH/CMakeFiles/Arduino_Helpers.dir/Hardware/ExtendedInputOutput/SPIShiftRegisterOut.cpp.o.d"
+  "/root/repo/src/AH/Hardware/ExtendedInputOutput/ShiftRegisterOutRGB.cpp" "src/AH/CMakeFiles/Arduino_Helpers.dir/Hardware/ExtendedInputOutput/ShiftRegisterOutRGB.cpp.o" "gcc" "src/AH/CMakeFiles/Arduino_Helpers.dir/Hardware/ExtendedInputOutput/ShiftRegisterOutRGB.cpp.o.d"
+  "/root/repo/src/AH/Hardware/IncrementButton.cpp" "src/AH/CMakeFiles/Arduino_Helpers.dir/Hardware/IncrementButton.cpp.o" "gcc" "src/AH/CMakeFiles/Arduino_Helpers.dir/Hardware/IncrementButton.cpp.o.d"
+  "/root/repo/src/AH/Hardware/IncrementDecrementButtons.cpp" "src/AH/CMakeFiles/Arduino_Helpers.dir/Hardware/IncrementDecrementButtons.cpp.o" "gcc" "src/AH/CMakeFiles/Arduino_Helpers.dir/Hardware/IncrementDecrementButtons.cpp.o.d"
+  "/root/repo/src/AH/Math/Quaternion.cpp" "src/AH/CMakeFiles/Arduino_Helpers.dir/Math/Quaternion.cpp.o" "gcc" "src/AH/CMakeFiles/Arduino_Helpers.dir/Math/Quaternion.cpp.o.d"
+  "/root/repo/src/AH/Math/Vector.cpp" "src/AH/CMakeFiles/Arduino_Helpers.dir/Math/Vector.cpp.o" "gcc" "src/AH/CMakeFiles/Arduino_Helpers.dir/Math/Vector.cpp.o.d"
+  "/root/repo/src/AH/PrintStream/PrintStream.cpp" "src/AH/CMakeFiles/Arduino_Helpers.dir/PrintStream/PrintStream.cpp.o" "gcc" "src/AH/CMakeFiles/Arduino_Helpers.dir/PrintStream/PrintStream.cpp.o.d"
+  "/root/repo/src/AH/STL/vector.cpp" "src/AH/CMakeFiles/Arduino_Helpers.dir/STL/vector.cpp.o" "gcc" "src/AH/CMakeFiles/Arduino_Helpers.dir/STL/vector.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/mock/CMakeFiles/ArduinoMock.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Arduino_Helpers.dir/Debug/Debug.cpp.o"
+  "CMakeFiles/Arduino_Helpers.dir/Debug/Debug.cpp.o.d"
+  "CMakeFiles/Arduino_Helpers.dir/Error/Exit.cpp.o"
+  "CMakeFiles/Arduino_Helpers.dir/Error/Exit.cpp.o.d"
+  "CMakeFiles/Arduino_Helpers.dir/Hardware/Button.cpp.o"
+  "CMakeFiles/Arduino_Helpers.dir/Hardware/Button.cpp.o.d"
+  "CMakeFiles/Arduino_Helpers.dir/Hardware/ExtendedInputOutput/ExtendedIOElement.cpp.o"
+  "CMakeFiles/Arduino_Helpers.dir/Hardware/ExtendedInputOutput/ExtendedIOElement.cpp.o.d"
+  "CMakeFiles/Arduino_Helpers.dir/Hardware/ExtendedInputOutput/ExtendedInputOutput.cpp.o"
+  "CMakeFiles/Arduino_Helpers.dir/Hardware/ExtendedInputOutput/ExtendedInputOutput.cpp.o.d"
+  "CMakeFiles/Arduino_Helpers.dir/Hardware/ExtendedInputOutput/SPIShiftRegisterOut.cpp.o"
+  "CMakeFiles/Arduino_Helpers.dir/Hardware/ExtendedInputOutput/SPIShiftRegisterOut.cpp.o.d"
+  "CMakeFiles/Arduino_Helpers.dir/Hardware/ExtendedInputOutput/ShiftRegisterOutRGB.cpp.o"
+  "CMakeFiles/Arduino_Helpers.dir/Hardware/ExtendedInputOutput/ShiftRegisterOutRGB.cpp.o.d"
+  "CMakeFiles/Arduino_Helpers.dir/Hardware/IncrementButton.cpp.o"
+  "CMakeFiles/Arduino_Helpers.dir/Hardware/IncrementButton.cpp.o.d"
+  "CMakeFiles/Arduino_Helpers.dir/Hardware/IncrementDecrementButtons.cpp.o"
+  "CMakeFiles/Arduino_Helpers.dir/Hardware/IncrementDecrementButtons.cpp.o.d"
+  "CMakeFiles/Arduino_Helpers.dir/Math/Quaternion.cpp.o"
+  "CMakeFiles/Arduino_Helpers.dir/Math/Quaternion.cpp.o.d"
+  "CMakeFiles/Arduino_Helpers.dir/Math/Vector.cpp.o"
+  "CMakeFiles/Arduino_Helpers.dir/Math/Vector.cpp.o.d"
+  "CMakeFiles/Arduino_Helpers.dir/PrintStream/PrintStream.cpp.o"
+  "CMakeFiles/Arduino_Helpers.dir/PrintStream/PrintStream.cpp.o.d"
+  "CMakeFiles/Arduino_Helpers.dir/STL/vector.cpp.o"
+  "CMakeFiles/Arduino_Helpers.dir/STL/vector.cpp.o.d"
+  "libArduino_Helpers.a"
+  "libArduino_Helpers.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Arduino_Helpers.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
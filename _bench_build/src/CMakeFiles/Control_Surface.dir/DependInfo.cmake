@@ -0,0 +1,51 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/Control_Surface/Control_Surface_Class.cpp" "src/CMakeFiles/Control_Surface.dir/Control_Surface/Control_Surface_Class.cpp.o" "gcc" "src/CMakeFiles/Control_Surface.dir/Control_Surface/Control_Surface_Class.cpp.o.d"
+  "/root/repo/src/Control_Surface/LoopProfiler.cpp" "src/CMakeFiles/Control_Surface.dir/Control_Surface/LoopProfiler.cpp.o" "gcc" "src/CMakeFiles/Control_Surface.dir/Control_Surface/LoopProfiler.cpp.o.d"
+  "/root/repo/src/Def/Cable.cpp" "src/CMakeFiles/Control_Surface.dir/Def/Cable.cpp.o" "gcc" "src/CMakeFiles/Control_Surface.dir/Def/Cable.cpp.o.d"
+  "/root/repo/src/Def/Channel.cpp" "src/CMakeFiles/Control_Surface.dir/Def/Channel.cpp.o" "gcc" "src/CMakeFiles/Control_Surface.dir/Def/Channel.cpp.o.d"
+  "/root/repo/src/Def/MIDIAddress.cpp" "src/CMakeFiles/Control_Surface.dir/Def/MIDIAddress.cpp.o" "gcc" "src/CMakeFiles/Control_Surface.dir/Def/MIDIAddress.cpp.o.d"
+  "/root/repo/src/Display/AsyncDisplayTransfer.cpp" "src/CMakeFiles/Control_Surface.dir/Display/AsyncDisplayTransfer.cpp.o" "gcc" "src/CMakeFiles/Control_Surface.dir/Display/AsyncDisplayTransfer.cpp.o.d"
+  "/root/repo/src/Display/DisplayElement.cpp" "src/CMakeFiles/Control_Surface.dir/Display/DisplayElement.cpp.o" "gcc" "src/CMakeFiles/Control_Surface.dir/Display/DisplayElement.cpp.o.d"
+  "/root/repo/src/Display/DisplayInterface.cpp" "src/CMakeFiles/Control_Surface.dir/Display/DisplayInterface.cpp.o" "gcc" "src/CMakeFiles/Control_Surface.dir/Display/DisplayInterface.cpp.o.d"
+  "/root/repo/src/Display/Helpers/Bresenham.cpp" "src/CMakeFiles/Control_Surface.dir/Display/Helpers/Bresenham.cpp.o" "gcc" "src/CMakeFiles/Control_Surface.dir/Display/Helpers/Bresenham.cpp.o.d"
+  "/root/repo/src/MIDI_Constants/MCUNameFromNoteNumber.cpp" "src/CMakeFiles/Control_Surface.dir/MIDI_Constants/MCUNameFromNoteNumber.cpp.o" "gcc" "src/CMakeFiles/Control_Surface.dir/MIDI_Constants/MCUNameFromNoteNumber.cpp.o.d"
+  "/root/repo/src/MIDI_Inputs/LEDs/NoteCCKPRangeFastLED.cpp" "src/CMakeFiles/Control_Surface.dir/MIDI_Inputs/LEDs/NoteCCKPRangeFastLED.cpp.o" "gcc" "src/CMakeFiles/Control_Surface.dir/MIDI_Inputs/LEDs/NoteCCKPRangeFastLED.cpp.o.d"
+  "/root/repo/src/MIDI_Inputs/MCU/LCD.cpp" "src/CMakeFiles/Control_Surface.dir/MIDI_Inputs/MCU/LCD.cpp.o" "gcc" "src/CMakeFiles/Control_Surface.dir/MIDI_Inputs/MCU/LCD.cpp.o.d"
+  "/root/repo/src/MIDI_Inputs/MCU/VUDecayClock.cpp" "src/CMakeFiles/Control_Surface.dir/MIDI_Inputs/MCU/VUDecayClock.cpp.o" "gcc" "src/CMakeFiles/Control_Surface.dir/MIDI_Inputs/MCU/VUDecayClock.cpp.o.d"
+  "/root/repo/src/MIDI_Inputs/MIDIInputDispatchIndex.cpp" "src/CMakeFiles/Control_Surface.dir/MIDI_Inputs/MIDIInputDispatchIndex.cpp.o" "gcc" "src/CMakeFiles/Control_Surface.dir/MIDI_Inputs/MIDIInputDispatchIndex.cpp.o.d"
+  "/root/repo/src/MIDI_Interfaces/BLEMIDI/BLEMIDIPacketBuilder.cpp" "src/CMakeFiles/Control_Surface.dir/MIDI_Interfaces/BLEMIDI/BLEMIDIPacketBuilder.cpp.o" "gcc" "src/CMakeFiles/Control_Surface.dir/MIDI_Interfaces/BLEMIDI/BLEMIDIPacketBuilder.cpp.o.d"
+  "/root/repo/src/MIDI_Interfaces/BLEMIDI/BLEMIDIPacketScheduler.cpp" "src/CMakeFiles/Control_Surface.dir/MIDI_Interfaces/BLEMIDI/BLEMIDIPacketScheduler.cpp.o" "gcc" "src/CMakeFiles/Control_Surface.dir/MIDI_Interfaces/BLEMIDI/BLEMIDIPacketScheduler.cpp.o.d"
+  "/root/repo/src/MIDI_Interfaces/BLEMIDI/BTstack/advertising.cpp" "src/CMakeFiles/Control_Surface.dir/MIDI_Interfaces/BLEMIDI/BTstack/advertising.cpp.o" "gcc" "src/CMakeFiles/Control_Surface.dir/MIDI_Interfaces/BLEMIDI/BTstack/advertising.cpp.o.d"
+  "/root/repo/src/MIDI_Interfaces/BLEMIDI/BTstack/gatt_midi.cpp" "src/CMakeFiles/Control_Surface.dir/MIDI_Interfaces/BLEMIDI/BTstack/gatt_midi.cpp.o" "gcc" "src/CMakeFiles/Control_Surface.dir/MIDI_Interfaces/BLEMIDI/BTstack/gatt_midi.cpp.o.d"
+  "/root/repo/src/MIDI_Interfaces/BLEMIDI/ESP32/app.cpp" "src/CMakeFiles/Control_Surface.dir/MIDI_Interfaces/BLEMIDI/ESP32/app.cpp.o" "gcc" "src/CMakeFiles/Control_Surface.dir/MIDI_Interfaces/BLEMIDI/ESP32/app.cpp.o.d"
+  "/root/repo/src/MIDI_Interfaces/DebugMIDI_Interface.cpp" "src/CMakeFiles/Control_Surface.dir/MIDI_Interfaces/DebugMIDI_Interface.cpp.o" "gcc" "src/CMakeFiles/Control_Surface.dir/MIDI_Interfaces/DebugMIDI_Interface.cpp.o.d"
+  "/root/repo/src/MIDI_Interfaces/MIDI_Interface.cpp" "src/CMakeFiles/Control_Surface.dir/MIDI_Interfaces/MIDI_Interface.cpp.o" "gcc" "src/CMakeFiles/Control_Surface.dir/MIDI_Interfaces/MIDI_Interface.cpp.o.d"
+  "/root/repo/src/MIDI_Interfaces/MIDI_Pipes.cpp" "src/CMakeFiles/Control_Surface.dir/MIDI_Interfaces/MIDI_Pipes.cpp.o" "gcc" "src/CMakeFiles/Control_Surface.dir/MIDI_Interfaces/MIDI_Pipes.cpp.o.d"
+  "/root/repo/src/MIDI_Interfaces/SerialMIDI_Interface.cpp" "src/CMakeFiles/Control_Surface.dir/MIDI_Interfaces/SerialMIDI_Interface.cpp.o" "gcc" "src/CMakeFiles/Control_Surface.dir/MIDI_Interfaces/SerialMIDI_Interface.cpp.o.d"
+  "/root/repo/src/MIDI_Interfaces/USBMIDI/mbed/PluggableUSBMIDI-descr.cpp" "src/CMakeFiles/Control_Surface.dir/MIDI_Interfaces/USBMIDI/mbed/PluggableUSBMIDI-descr.cpp.o" "gcc" "src/CMakeFiles/Control_Surface.dir/MIDI_Interfaces/USBMIDI/mbed/PluggableUSBMIDI-descr.cpp.o.d"
+  "/root/repo/src/MIDI_Interfaces/USBMIDI/mbed/PluggableUSBMIDI.cpp" "src/CMakeFiles/Control_Surface.dir/MIDI_Interfaces/USBMIDI/mbed/PluggableUSBMIDI.cpp.o" "gcc" "src/CMakeFiles/Control_Surface.dir/MIDI_Interfaces/USBMIDI/mbed/PluggableUSBMIDI.cpp.o.d"
+  "/root/repo/src/MIDI_Parsers/MIDI_MessageTypes.cpp" "src/CMakeFiles/Control_Surface.dir/MIDI_Parsers/MIDI_MessageTypes.cpp.o" "gcc" "src/CMakeFiles/Control_Surface.dir/MIDI_Parsers/MIDI_MessageTypes.cpp.o.d"
+  "/root/repo/src/MIDI_Parsers/SerialMIDI_Parser.cpp" "src/CMakeFiles/Control_Surface.dir/MIDI_Parsers/SerialMIDI_Parser.cpp.o" "gcc" "src/CMakeFiles/Control_Surface.dir/MIDI_Parsers/SerialMIDI_Parser.cpp.o.d"
+  "/root/repo/src/MIDI_Parsers/SysExBuffer.cpp" "src/CMakeFiles/Control_Surface.dir/MIDI_Parsers/SysExBuffer.cpp.o" "gcc" "src/CMakeFiles/Control_Surface.dir/MIDI_Parsers/SysExBuffer.cpp.o.d"
+  "/root/repo/src/MIDI_Parsers/USBMIDI_Parser.cpp" "src/CMakeFiles/Control_Surface.dir/MIDI_Parsers/USBMIDI_Parser.cpp.o" "gcc" "src/CMakeFiles/Control_Surface.dir/MIDI_Parsers/USBMIDI_Parser.cpp.o.d"
+  "/root/repo/src/MIDI_Senders/RelativeCCSender.cpp" "src/CMakeFiles/Control_Surface.dir/MIDI_Senders/RelativeCCSender.cpp.o" "gcc" "src/CMakeFiles/Control_Surface.dir/MIDI_Senders/RelativeCCSender.cpp.o.d"
+  "/root/repo/src/Submodules/Encoder/AHEncoder.cpp" "src/CMakeFiles/Control_Surface.dir/Submodules/Encoder/AHEncoder.cpp.o" "gcc" "src/CMakeFiles/Control_Surface.dir/Submodules/Encoder/AHEncoder.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/src/AH/CMakeFiles/Arduino_Helpers.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/mock/CMakeFiles/ArduinoMock.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,71 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Control_Surface.dir/Control_Surface/Control_Surface_Class.cpp.o"
+  "CMakeFiles/Control_Surface.dir/Control_Surface/Control_Surface_Class.cpp.o.d"
+  "CMakeFiles/Control_Surface.dir/Control_Surface/LoopProfiler.cpp.o"
+  "CMakeFiles/Control_Surface.dir/Control_Surface/LoopProfiler.cpp.o.d"
+  "CMakeFiles/Control_Surface.dir/Def/Cable.cpp.o"
+  "CMakeFiles/Control_Surface.dir/Def/Cable.cpp.o.d"
+  "CMakeFiles/Control_Surface.dir/Def/Channel.cpp.o"
+  "CMakeFiles/Control_Surface.dir/Def/Channel.cpp.o.d"
+  "CMakeFiles/Control_Surface.dir/Def/MIDIAddress.cpp.o"
+  "CMakeFiles/Control_Surface.dir/Def/MIDIAddress.cpp.o.d"
+  "CMakeFiles/Control_Surface.dir/Display/AsyncDisplayTransfer.cpp.o"
+  "CMakeFiles/Control_Surface.dir/Display/AsyncDisplayTransfer.cpp.o.d"
+  "CMakeFiles/Control_Surface.dir/Display/DisplayElement.cpp.o"
+  "CMakeFiles/Control_Surface.dir/Display/DisplayElement.cpp.o.d"
+  "CMakeFiles/Control_Surface.dir/Display/DisplayInterface.cpp.o"
+  "CMakeFiles/Control_Surface.dir/Display/DisplayInterface.cpp.o.d"
+  "CMakeFiles/Control_Surface.dir/Display/Helpers/Bresenham.cpp.o"
+  "CMakeFiles/Control_Surface.dir/Display/Helpers/Bresenham.cpp.o.d"
+  "CMakeFiles/Control_Surface.dir/MIDI_Constants/MCUNameFromNoteNumber.cpp.o"
+  "CMakeFiles/Control_Surface.dir/MIDI_Constants/MCUNameFromNoteNumber.cpp.o.d"
+  "CMakeFiles/Control_Surface.dir/MIDI_Inputs/LEDs/NoteCCKPRangeFastLED.cpp.o"
+  "CMakeFiles/Control_Surface.dir/MIDI_Inputs/LEDs/NoteCCKPRangeFastLED.cpp.o.d"
+  "CMakeFiles/Control_Surface.dir/MIDI_Inputs/MCU/LCD.cpp.o"
+  "CMakeFiles/Control_Surface.dir/MIDI_Inputs/MCU/LCD.cpp.o.d"
+  "CMakeFiles/Control_Surface.dir/MIDI_Inputs/MCU/VUDecayClock.cpp.o"
+  "CMakeFiles/Control_Surface.dir/MIDI_Inputs/MCU/VUDecayClock.cpp.o.d"
+  "CMakeFiles/Control_Surface.dir/MIDI_Inputs/MIDIInputDispatchIndex.cpp.o"
+  "CMakeFiles/Control_Surface.dir/MIDI_Inputs/MIDIInputDispatchIndex.cpp.o.d"
+  "CMakeFiles/Control_Surface.dir/MIDI_Interfaces/BLEMIDI/BLEMIDIPacketBuilder.cpp.o"
+  "CMakeFiles/Control_Surface.dir/MIDI_Interfaces/BLEMIDI/BLEMIDIPacketBuilder.cpp.o.d"
+  "CMakeFiles/Control_Surface.dir/MIDI_Interfaces/BLEMIDI/BLEMIDIPacketScheduler.cpp.o"
+  "CMakeFiles/Control_Surface.dir/MIDI_Interfaces/BLEMIDI/BLEMIDIPacketScheduler.cpp.o.d"
+  "CMakeFiles/Control_Surface.dir/MIDI_Interfaces/BLEMIDI/BTstack/advertising.cpp.o"
+  "CMakeFiles/Control_Surface.dir/MIDI_Interfaces/BLEMIDI/BTstack/advertising.cpp.o.d"
+  "CMakeFiles/Control_Surface.dir/MIDI_Interfaces/BLEMIDI/BTstack/gatt_midi.cpp.o"
+  "CMakeFiles/Control_Surface.dir/MIDI_Interfaces/BLEMIDI/BTstack/gatt_midi.cpp.o.d"
+  "CMakeFiles/Control_Surface.dir/MIDI_Interfaces/BLEMIDI/ESP32/app.cpp.o"
+  "CMakeFiles/Control_Surface.dir/MIDI_Interfaces/BLEMIDI/ESP32/app.cpp.o.d"
+  "CMakeFiles/Control_Surface.dir/MIDI_Interfaces/DebugMIDI_Interface.cpp.o"
+  "CMakeFiles/Control_Surface.dir/MIDI_Interfaces/DebugMIDI_Interface.cpp.o.d"
+  "CMakeFiles/Control_Surface.dir/MIDI_Interfaces/MIDI_Interface.cpp.o"
+  "CMakeFiles/Control_Surface.dir/MIDI_Interfaces/MIDI_Interface.cpp.o.d"
+  "CMakeFiles/Control_Surface.dir/MIDI_Interfaces/MIDI_Pipes.cpp.o"
+  "CMakeFiles/Control_Surface.dir/MIDI_Interfaces/MIDI_Pipes.cpp.o.d"
+  "CMakeFiles/Control_Surface.dir/MIDI_Interfaces/SerialMIDI_Interface.cpp.o"
+  "CMakeFiles/Control_Surface.dir/MIDI_Interfaces/SerialMIDI_Interface.cpp.o.d"
+  "CMakeFiles/Control_Surface.dir/MIDI_Interfaces/USBMIDI/mbed/PluggableUSBMIDI-descr.cpp.o"
+  "CMakeFiles/Control_Surface.dir/MIDI_Interfaces/USBMIDI/mbed/PluggableUSBMIDI-descr.cpp.o.d"
+  "CMakeFiles/Control_Surface.dir/MIDI_Interfaces/USBMIDI/mbed/PluggableUSBMIDI.cpp.o"
+  "CMakeFiles/Control_Surface.dir/MIDI_Interfaces/USBMIDI/mbed/PluggableUSBMIDI.cpp.o.d"
+  "CMakeFiles/Control_Surface.dir/MIDI_Parsers/MIDI_MessageTypes.cpp.o"
+  "CMakeFiles/Control_Surface.dir/MIDI_Parsers/MIDI_MessageTypes.cpp.o.d"
+  "CMakeFiles/Control_Surface.dir/MIDI_Parsers/SerialMIDI_Parser.cpp.o"
+  "CMakeFiles/Control_Surface.dir/MIDI_Parsers/SerialMIDI_Parser.cpp.o.d"
+  "CMakeFiles/Control_Surface.dir/MIDI_Parsers/SysExBuffer.cpp.o"
+  "CMakeFiles/Control_Surface.dir/MIDI_Parsers/SysExBuffer.cpp.o.d"
+  "CMakeFiles/Control_Surface.dir/MIDI_Parsers/USBMIDI_Parser.cpp.o"
+  "CMakeFiles/Control_Surface.dir/MIDI_Parsers/USBMIDI_Parser.cpp.o.d"
+  "CMakeFiles/Control_Surface.dir/MIDI_Senders/RelativeCCSender.cpp.o"
+  "CMakeFiles/Control_Surface.dir/MIDI_Senders/RelativeCCSender.cpp.o.d"
+  "CMakeFiles/Control_Surface.dir/Submodules/Encoder/AHEncoder.cpp.o"
+  "CMakeFiles/Control_Surface.dir/Submodules/Encoder/AHEncoder.cpp.o.d"
+  "libControl_Surface.a"
+  "libControl_Surface.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Control_Surface.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
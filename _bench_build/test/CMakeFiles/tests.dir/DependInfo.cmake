@@ -0,0 +1,86 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/AH/Containers/test-Array.cpp" "test/CMakeFiles/tests.dir/AH/Containers/test-Array.cpp.o" "gcc" "test/CMakeFiles/tests.dir/AH/Containers/test-Array.cpp.o.d"
+  "/root/repo/test/AH/Containers/test-DoublyLinkedList.cpp" "test/CMakeFiles/tests.dir/AH/Containers/test-DoublyLinkedList.cpp.o" "gcc" "test/CMakeFiles/tests.dir/AH/Containers/test-DoublyLinkedList.cpp.o.d"
+  "/root/repo/test/AH/Containers/test-Updatable.cpp" "test/CMakeFiles/tests.dir/AH/Containers/test-Updatable.cpp.o" "gcc" "test/CMakeFiles/tests.dir/AH/Containers/test-Updatable.cpp.o.d"
+  "/root/repo/test/AH/Containers/tests-BitArray.cpp" "test/CMakeFiles/tests.dir/AH/Containers/tests-BitArray.cpp.o" "gcc" "test/CMakeFiles/tests.dir/AH/Containers/tests-BitArray.cpp.o.d"
+  "/root/repo/test/AH/Filters/test-EMA.cpp" "test/CMakeFiles/tests.dir/AH/Filters/test-EMA.cpp.o" "gcc" "test/CMakeFiles/tests.dir/AH/Filters/test-EMA.cpp.o.d"
+  "/root/repo/test/AH/Filters/test-Hysteresis.cpp" "test/CMakeFiles/tests.dir/AH/Filters/test-Hysteresis.cpp.o" "gcc" "test/CMakeFiles/tests.dir/AH/Filters/test-Hysteresis.cpp.o.d"
+  "/root/repo/test/AH/Hardware/ExtendedInputOutput/test-AnalogMultiplex.cpp" "test/CMakeFiles/tests.dir/AH/Hardware/ExtendedInputOutput/test-AnalogMultiplex.cpp.o" "gcc" "test/CMakeFiles/tests.dir/AH/Hardware/ExtendedInputOutput/test-AnalogMultiplex.cpp.o.d"
+  "/root/repo/test/AH/Hardware/ExtendedInputOutput/test-ExtendedInputOutput.cpp" "test/CMakeFiles/tests.dir/AH/Hardware/ExtendedInputOutput/test-ExtendedInputOutput.cpp.o" "gcc" "test/CMakeFiles/tests.dir/AH/Hardware/ExtendedInputOutput/test-ExtendedInputOutput.cpp.o.d"
+  "/root/repo/test/AH/Hardware/ExtendedInputOutput/test-MCP23017.cpp" "test/CMakeFiles/tests.dir/AH/Hardware/ExtendedInputOutput/test-MCP23017.cpp.o" "gcc" "test/CMakeFiles/tests.dir/AH/Hardware/ExtendedInputOutput/test-MCP23017.cpp.o.d"
+  "/root/repo/test/AH/Hardware/ExtendedInputOutput/test-SPIShiftRegisterOut.cpp" "test/CMakeFiles/tests.dir/AH/Hardware/ExtendedInputOutput/test-SPIShiftRegisterOut.cpp.o" "gcc" "test/CMakeFiles/tests.dir/AH/Hardware/ExtendedInputOutput/test-SPIShiftRegisterOut.cpp.o.d"
+  "/root/repo/test/AH/Hardware/test-Button.cpp" "test/CMakeFiles/tests.dir/AH/Hardware/test-Button.cpp.o" "gcc" "test/CMakeFiles/tests.dir/AH/Hardware/test-Button.cpp.o.d"
+  "/root/repo/test/AH/Hardware/test-ButtonBank.cpp" "test/CMakeFiles/tests.dir/AH/Hardware/test-ButtonBank.cpp.o" "gcc" "test/CMakeFiles/tests.dir/AH/Hardware/test-ButtonBank.cpp.o.d"
+  "/root/repo/test/AH/Hardware/test-ButtonMatrix.cpp" "test/CMakeFiles/tests.dir/AH/Hardware/test-ButtonMatrix.cpp.o" "gcc" "test/CMakeFiles/tests.dir/AH/Hardware/test-ButtonMatrix.cpp.o.d"
+  "/root/repo/test/AH/Hardware/test-FilteredAnalog.cpp" "test/CMakeFiles/tests.dir/AH/Hardware/test-FilteredAnalog.cpp.o" "gcc" "test/CMakeFiles/tests.dir/AH/Hardware/test-FilteredAnalog.cpp.o.d"
+  "/root/repo/test/AH/Hardware/test-FilteredAnalogBank.cpp" "test/CMakeFiles/tests.dir/AH/Hardware/test-FilteredAnalogBank.cpp.o" "gcc" "test/CMakeFiles/tests.dir/AH/Hardware/test-FilteredAnalogBank.cpp.o.d"
+  "/root/repo/test/AH/Hardware/test-IncrementButton.cpp" "test/CMakeFiles/tests.dir/AH/Hardware/test-IncrementButton.cpp.o" "gcc" "test/CMakeFiles/tests.dir/AH/Hardware/test-IncrementButton.cpp.o.d"
+  "/root/repo/test/AH/Hardware/test-IncrementDecrementButtons.cpp" "test/CMakeFiles/tests.dir/AH/Hardware/test-IncrementDecrementButtons.cpp.o" "gcc" "test/CMakeFiles/tests.dir/AH/Hardware/test-IncrementDecrementButtons.cpp.o.d"
+  "/root/repo/test/AH/Math/test-Degrees.cpp" "test/CMakeFiles/tests.dir/AH/Math/test-Degrees.cpp.o" "gcc" "test/CMakeFiles/tests.dir/AH/Math/test-Degrees.cpp.o.d"
+  "/root/repo/test/AH/Math/test-IncreaseBitDepth.cpp" "test/CMakeFiles/tests.dir/AH/Math/test-IncreaseBitDepth.cpp.o" "gcc" "test/CMakeFiles/tests.dir/AH/Math/test-IncreaseBitDepth.cpp.o.d"
+  "/root/repo/test/AH/Math/test-Quaternion.cpp" "test/CMakeFiles/tests.dir/AH/Math/test-Quaternion.cpp.o" "gcc" "test/CMakeFiles/tests.dir/AH/Math/test-Quaternion.cpp.o.d"
+  "/root/repo/test/AH/Math/test-Vector.cpp" "test/CMakeFiles/tests.dir/AH/Math/test-Vector.cpp.o" "gcc" "test/CMakeFiles/tests.dir/AH/Math/test-Vector.cpp.o.d"
+  "/root/repo/test/AH/PrintStream/test-PrintStream.cpp" "test/CMakeFiles/tests.dir/AH/PrintStream/test-PrintStream.cpp.o" "gcc" "test/CMakeFiles/tests.dir/AH/PrintStream/test-PrintStream.cpp.o.d"
+  "/root/repo/test/AH/Timing/test-Timer.cpp" "test/CMakeFiles/tests.dir/AH/Timing/test-Timer.cpp.o" "gcc" "test/CMakeFiles/tests.dir/AH/Timing/test-Timer.cpp.o.d"
+  "/root/repo/test/Banks/test-Banks.cpp" "test/CMakeFiles/tests.dir/Banks/test-Banks.cpp.o" "gcc" "test/CMakeFiles/tests.dir/Banks/test-Banks.cpp.o.d"
+  "/root/repo/test/Control_Surface/test-LoopProfiler.cpp" "test/CMakeFiles/tests.dir/Control_Surface/test-LoopProfiler.cpp.o" "gcc" "test/CMakeFiles/tests.dir/Control_Surface/test-LoopProfiler.cpp.o.d"
+  "/root/repo/test/Display/test-AsyncDisplayTransfer.cpp" "test/CMakeFiles/tests.dir/Display/test-AsyncDisplayTransfer.cpp.o" "gcc" "test/CMakeFiles/tests.dir/Display/test-AsyncDisplayTransfer.cpp.o.d"
+  "/root/repo/test/Display/test-DisplayElement.cpp" "test/CMakeFiles/tests.dir/Display/test-DisplayElement.cpp.o" "gcc" "test/CMakeFiles/tests.dir/Display/test-DisplayElement.cpp.o.d"
+  "/root/repo/test/Helpers/test-MIDICNCHannelAddress.cpp" "test/CMakeFiles/tests.dir/Helpers/test-MIDICNCHannelAddress.cpp.o" "gcc" "test/CMakeFiles/tests.dir/Helpers/test-MIDICNCHannelAddress.cpp.o.d"
+  "/root/repo/test/MIDI_Constants/test-MCU.cpp" "test/CMakeFiles/tests.dir/MIDI_Constants/test-MCU.cpp.o" "gcc" "test/CMakeFiles/tests.dir/MIDI_Constants/test-MCU.cpp.o.d"
+  "/root/repo/test/MIDI_Constants/test-Notes.cpp" "test/CMakeFiles/tests.dir/MIDI_Constants/test-Notes.cpp.o" "gcc" "test/CMakeFiles/tests.dir/MIDI_Constants/test-Notes.cpp.o.d"
+  "/root/repo/test/MIDI_Inputs/test-MCU_LCD.cpp" "test/CMakeFiles/tests.dir/MIDI_Inputs/test-MCU_LCD.cpp.o" "gcc" "test/CMakeFiles/tests.dir/MIDI_Inputs/test-MCU_LCD.cpp.o.d"
+  "/root/repo/test/MIDI_Inputs/test-MCU_TimeDisplay.cpp" "test/CMakeFiles/tests.dir/MIDI_Inputs/test-MCU_TimeDisplay.cpp.o" "gcc" "test/CMakeFiles/tests.dir/MIDI_Inputs/test-MCU_TimeDisplay.cpp.o.d"
+  "/root/repo/test/MIDI_Inputs/test-MIDIInputElement.cpp" "test/CMakeFiles/tests.dir/MIDI_Inputs/test-MIDIInputElement.cpp.o" "gcc" "test/CMakeFiles/tests.dir/MIDI_Inputs/test-MIDIInputElement.cpp.o.d"
+  "/root/repo/test/MIDI_Inputs/test-MIDINote.cpp" "test/CMakeFiles/tests.dir/MIDI_Inputs/test-MIDINote.cpp.o" "gcc" "test/CMakeFiles/tests.dir/MIDI_Inputs/test-MIDINote.cpp.o.d"
+  "/root/repo/test/MIDI_Inputs/test-NoteCCKPLEDBar.cpp" "test/CMakeFiles/tests.dir/MIDI_Inputs/test-NoteCCKPLEDBar.cpp.o" "gcc" "test/CMakeFiles/tests.dir/MIDI_Inputs/test-NoteCCKPLEDBar.cpp.o.d"
+  "/root/repo/test/MIDI_Inputs/tests-MCU_VPot.cpp" "test/CMakeFiles/tests.dir/MIDI_Inputs/tests-MCU_VPot.cpp.o" "gcc" "test/CMakeFiles/tests.dir/MIDI_Inputs/tests-MCU_VPot.cpp.o.d"
+  "/root/repo/test/MIDI_Inputs/tests-MCU_VU.cpp" "test/CMakeFiles/tests.dir/MIDI_Inputs/tests-MCU_VU.cpp.o" "gcc" "test/CMakeFiles/tests.dir/MIDI_Inputs/tests-MCU_VU.cpp.o.d"
+  "/root/repo/test/MIDI_Interfaces/test-BLEAPI.cpp" "test/CMakeFiles/tests.dir/MIDI_Interfaces/test-BLEAPI.cpp.o" "gcc" "test/CMakeFiles/tests.dir/MIDI_Interfaces/test-BLEAPI.cpp.o.d"
+  "/root/repo/test/MIDI_Interfaces/test-BLEMIDIMessageQueue.cpp" "test/CMakeFiles/tests.dir/MIDI_Interfaces/test-BLEMIDIMessageQueue.cpp.o" "gcc" "test/CMakeFiles/tests.dir/MIDI_Interfaces/test-BLEMIDIMessageQueue.cpp.o.d"
+  "/root/repo/test/MIDI_Interfaces/test-BLEMIDIPacketBuilder.cpp" "test/CMakeFiles/tests.dir/MIDI_Interfaces/test-BLEMIDIPacketBuilder.cpp.o" "gcc" "test/CMakeFiles/tests.dir/MIDI_Interfaces/test-BLEMIDIPacketBuilder.cpp.o.d"
+  "/root/repo/test/MIDI_Interfaces/test-BLEMIDIPacketScheduler.cpp" "test/CMakeFiles/tests.dir/MIDI_Interfaces/test-BLEMIDIPacketScheduler.cpp.o" "gcc" "test/CMakeFiles/tests.dir/MIDI_Interfaces/test-BLEMIDIPacketScheduler.cpp.o.d"
+  "/root/repo/test/MIDI_Interfaces/test-BluetoothMIDI_Interface.cpp" "test/CMakeFiles/tests.dir/MIDI_Interfaces/test-BluetoothMIDI_Interface.cpp.o" "gcc" "test/CMakeFiles/tests.dir/MIDI_Interfaces/test-BluetoothMIDI_Interface.cpp.o.d"
+  "/root/repo/test/MIDI_Interfaces/test-CoalescingMIDI_Pipe.cpp" "test/CMakeFiles/tests.dir/MIDI_Interfaces/test-CoalescingMIDI_Pipe.cpp.o" "gcc" "test/CMakeFiles/tests.dir/MIDI_Interfaces/test-CoalescingMIDI_Pipe.cpp.o.d"
+  "/root/repo/test/MIDI_Interfaces/test-DebugStreamMIDI_Interface.cpp" "test/CMakeFiles/tests.dir/MIDI_Interfaces/test-DebugStreamMIDI_Interface.cpp.o" "gcc" "test/CMakeFiles/tests.dir/MIDI_Interfaces/test-DebugStreamMIDI_Interface.cpp.o.d"
+  "/root/repo/test/MIDI_Interfaces/test-MIDI_Pipeline.cpp" "test/CMakeFiles/tests.dir/MIDI_Interfaces/test-MIDI_Pipeline.cpp.o" "gcc" "test/CMakeFiles/tests.dir/MIDI_Interfaces/test-MIDI_Pipeline.cpp.o.d"
+  "/root/repo/test/MIDI_Interfaces/test-MIDI_Pipes.cpp" "test/CMakeFiles/tests.dir/MIDI_Interfaces/test-MIDI_Pipes.cpp.o" "gcc" "test/CMakeFiles/tests.dir/MIDI_Interfaces/test-MIDI_Pipes.cpp.o.d"
+  "/root/repo/test/MIDI_Interfaces/test-StreamMIDI_Interface.cpp" "test/CMakeFiles/tests.dir/MIDI_Interfaces/test-StreamMIDI_Interface.cpp.o" "gcc" "test/CMakeFiles/tests.dir/MIDI_Interfaces/test-StreamMIDI_Interface.cpp.o.d"
+  "/root/repo/test/MIDI_Interfaces/test-USBBulk.cpp" "test/CMakeFiles/tests.dir/MIDI_Interfaces/test-USBBulk.cpp.o" "gcc" "test/CMakeFiles/tests.dir/MIDI_Interfaces/test-USBBulk.cpp.o.d"
+  "/root/repo/test/MIDI_Interfaces/test-USBMIDI_Interface.cpp" "test/CMakeFiles/tests.dir/MIDI_Interfaces/test-USBMIDI_Interface.cpp.o" "gcc" "test/CMakeFiles/tests.dir/MIDI_Interfaces/test-USBMIDI_Interface.cpp.o.d"
+  "/root/repo/test/MIDI_Outputs/test-CCButton.cpp" "test/CMakeFiles/tests.dir/MIDI_Outputs/test-CCButton.cpp.o" "gcc" "test/CMakeFiles/tests.dir/MIDI_Outputs/test-CCButton.cpp.o.d"
+  "/root/repo/test/MIDI_Outputs/test-CCPotentiometer.cpp" "test/CMakeFiles/tests.dir/MIDI_Outputs/test-CCPotentiometer.cpp.o" "gcc" "test/CMakeFiles/tests.dir/MIDI_Outputs/test-CCPotentiometer.cpp.o.d"
+  "/root/repo/test/MIDI_Outputs/test-CCRotaryEncoder.cpp" "test/CMakeFiles/tests.dir/MIDI_Outputs/test-CCRotaryEncoder.cpp.o" "gcc" "test/CMakeFiles/tests.dir/MIDI_Outputs/test-CCRotaryEncoder.cpp.o.d"
+  "/root/repo/test/MIDI_Outputs/test-Construction.cpp" "test/CMakeFiles/tests.dir/MIDI_Outputs/test-Construction.cpp.o" "gcc" "test/CMakeFiles/tests.dir/MIDI_Outputs/test-Construction.cpp.o.d"
+  "/root/repo/test/MIDI_Outputs/test-NoteButton.cpp" "test/CMakeFiles/tests.dir/MIDI_Outputs/test-NoteButton.cpp.o" "gcc" "test/CMakeFiles/tests.dir/MIDI_Outputs/test-NoteButton.cpp.o.d"
+  "/root/repo/test/MIDI_Outputs/test-NoteButtonLatching.cpp" "test/CMakeFiles/tests.dir/MIDI_Outputs/test-NoteButtonLatching.cpp.o" "gcc" "test/CMakeFiles/tests.dir/MIDI_Outputs/test-NoteButtonLatching.cpp.o.d"
+  "/root/repo/test/MIDI_Outputs/test-NoteButtonMatrix.cpp" "test/CMakeFiles/tests.dir/MIDI_Outputs/test-NoteButtonMatrix.cpp.o" "gcc" "test/CMakeFiles/tests.dir/MIDI_Outputs/test-NoteButtonMatrix.cpp.o.d"
+  "/root/repo/test/MIDI_Outputs/test-PBPotentiometer.cpp" "test/CMakeFiles/tests.dir/MIDI_Outputs/test-PBPotentiometer.cpp.o" "gcc" "test/CMakeFiles/tests.dir/MIDI_Outputs/test-PBPotentiometer.cpp.o.d"
+  "/root/repo/test/MIDI_Outputs/test-ProgramChanger.cpp" "test/CMakeFiles/tests.dir/MIDI_Outputs/test-ProgramChanger.cpp.o" "gcc" "test/CMakeFiles/tests.dir/MIDI_Outputs/test-ProgramChanger.cpp.o.d"
+  "/root/repo/test/MIDI_Parsers/tests-MIDI_Parsers.cpp" "test/CMakeFiles/tests.dir/MIDI_Parsers/tests-MIDI_Parsers.cpp.o" "gcc" "test/CMakeFiles/tests.dir/MIDI_Parsers/tests-MIDI_Parsers.cpp.o.d"
+  "/root/repo/test/MIDI_Senders/test-RelativeCCSender.cpp" "test/CMakeFiles/tests.dir/MIDI_Senders/test-RelativeCCSender.cpp.o" "gcc" "test/CMakeFiles/tests.dir/MIDI_Senders/test-RelativeCCSender.cpp.o.d"
+  "/root/repo/test/Selectors/test-IncrementDecrementSelector.cpp" "test/CMakeFiles/tests.dir/Selectors/test-IncrementDecrementSelector.cpp.o" "gcc" "test/CMakeFiles/tests.dir/Selectors/test-IncrementDecrementSelector.cpp.o.d"
+  "/root/repo/test/Selectors/test-IncrementSelector.cpp" "test/CMakeFiles/tests.dir/Selectors/test-IncrementSelector.cpp.o" "gcc" "test/CMakeFiles/tests.dir/Selectors/test-IncrementSelector.cpp.o.d"
+  "/root/repo/test/Selectors/test-ManyButtonsSelector.cpp" "test/CMakeFiles/tests.dir/Selectors/test-ManyButtonsSelector.cpp.o" "gcc" "test/CMakeFiles/tests.dir/Selectors/test-ManyButtonsSelector.cpp.o.d"
+  "/root/repo/test/test-main.cpp" "test/CMakeFiles/tests.dir/test-main.cpp.o" "gcc" "test/CMakeFiles/tests.dir/test-main.cpp.o.d"
+  "/root/repo/test/test_example.cpp" "test/CMakeFiles/tests.dir/test_example.cpp.o" "gcc" "test/CMakeFiles/tests.dir/test_example.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/src/AH/CMakeFiles/Arduino_Helpers.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/CMakeFiles/Control_Surface.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/mock/CMakeFiles/ArduinoMock.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
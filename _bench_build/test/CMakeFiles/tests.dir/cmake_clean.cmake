@@ -0,0 +1,140 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests.dir/AH/Containers/test-Array.cpp.o"
+  "CMakeFiles/tests.dir/AH/Containers/test-Array.cpp.o.d"
+  "CMakeFiles/tests.dir/AH/Containers/test-DoublyLinkedList.cpp.o"
+  "CMakeFiles/tests.dir/AH/Containers/test-DoublyLinkedList.cpp.o.d"
+  "CMakeFiles/tests.dir/AH/Containers/test-Updatable.cpp.o"
+  "CMakeFiles/tests.dir/AH/Containers/test-Updatable.cpp.o.d"
+  "CMakeFiles/tests.dir/AH/Containers/tests-BitArray.cpp.o"
+  "CMakeFiles/tests.dir/AH/Containers/tests-BitArray.cpp.o.d"
+  "CMakeFiles/tests.dir/AH/Filters/test-EMA.cpp.o"
+  "CMakeFiles/tests.dir/AH/Filters/test-EMA.cpp.o.d"
+  "CMakeFiles/tests.dir/AH/Filters/test-Hysteresis.cpp.o"
+  "CMakeFiles/tests.dir/AH/Filters/test-Hysteresis.cpp.o.d"
+  "CMakeFiles/tests.dir/AH/Hardware/ExtendedInputOutput/test-AnalogMultiplex.cpp.o"
+  "CMakeFiles/tests.dir/AH/Hardware/ExtendedInputOutput/test-AnalogMultiplex.cpp.o.d"
+  "CMakeFiles/tests.dir/AH/Hardware/ExtendedInputOutput/test-ExtendedInputOutput.cpp.o"
+  "CMakeFiles/tests.dir/AH/Hardware/ExtendedInputOutput/test-ExtendedInputOutput.cpp.o.d"
+  "CMakeFiles/tests.dir/AH/Hardware/ExtendedInputOutput/test-MCP23017.cpp.o"
+  "CMakeFiles/tests.dir/AH/Hardware/ExtendedInputOutput/test-MCP23017.cpp.o.d"
+  "CMakeFiles/tests.dir/AH/Hardware/ExtendedInputOutput/test-SPIShiftRegisterOut.cpp.o"
+  "CMakeFiles/tests.dir/AH/Hardware/ExtendedInputOutput/test-SPIShiftRegisterOut.cpp.o.d"
+  "CMakeFiles/tests.dir/AH/Hardware/test-Button.cpp.o"
+  "CMakeFiles/tests.dir/AH/Hardware/test-Button.cpp.o.d"
+  "CMakeFiles/tests.dir/AH/Hardware/test-ButtonBank.cpp.o"
+  "CMakeFiles/tests.dir/AH/Hardware/test-ButtonBank.cpp.o.d"
+  "CMakeFiles/tests.dir/AH/Hardware/test-ButtonMatrix.cpp.o"
+  "CMakeFiles/tests.dir/AH/Hardware/test-ButtonMatrix.cpp.o.d"
+  "CMakeFiles/tests.dir/AH/Hardware/test-FilteredAnalog.cpp.o"
+  "CMakeFiles/tests.dir/AH/Hardware/test-FilteredAnalog.cpp.o.d"
+  "CMakeFiles/tests.dir/AH/Hardware/test-FilteredAnalogBank.cpp.o"
+  "CMakeFiles/tests.dir/AH/Hardware/test-FilteredAnalogBank.cpp.o.d"
+  "CMakeFiles/tests.dir/AH/Hardware/test-IncrementButton.cpp.o"
+  "CMakeFiles/tests.dir/AH/Hardware/test-IncrementButton.cpp.o.d"
+  "CMakeFiles/tests.dir/AH/Hardware/test-IncrementDecrementButtons.cpp.o"
+  "CMakeFiles/tests.dir/AH/Hardware/test-IncrementDecrementButtons.cpp.o.d"
+  "CMakeFiles/tests.dir/AH/Math/test-Degrees.cpp.o"
+  "CMakeFiles/tests.dir/AH/Math/test-Degrees.cpp.o.d"
+  "CMakeFiles/tests.dir/AH/Math/test-IncreaseBitDepth.cpp.o"
+  "CMakeFiles/tests.dir/AH/Math/test-IncreaseBitDepth.cpp.o.d"
+  "CMakeFiles/tests.dir/AH/Math/test-Quaternion.cpp.o"
+  "CMakeFiles/tests.dir/AH/Math/test-Quaternion.cpp.o.d"
+  "CMakeFiles/tests.dir/AH/Math/test-Vector.cpp.o"
+  "CMakeFiles/tests.dir/AH/Math/test-Vector.cpp.o.d"
+  "CMakeFiles/tests.dir/AH/PrintStream/test-PrintStream.cpp.o"
+  "CMakeFiles/tests.dir/AH/PrintStream/test-PrintStream.cpp.o.d"
+  "CMakeFiles/tests.dir/AH/Timing/test-Timer.cpp.o"
+  "CMakeFiles/tests.dir/AH/Timing/test-Timer.cpp.o.d"
+  "CMakeFiles/tests.dir/Banks/test-Banks.cpp.o"
+  "CMakeFiles/tests.dir/Banks/test-Banks.cpp.o.d"
+  "CMakeFiles/tests.dir/Control_Surface/test-LoopProfiler.cpp.o"
+  "CMakeFiles/tests.dir/Control_Surface/test-LoopProfiler.cpp.o.d"
+  "CMakeFiles/tests.dir/Display/test-AsyncDisplayTransfer.cpp.o"
+  "CMakeFiles/tests.dir/Display/test-AsyncDisplayTransfer.cpp.o.d"
+  "CMakeFiles/tests.dir/Display/test-DisplayElement.cpp.o"
+  "CMakeFiles/tests.dir/Display/test-DisplayElement.cpp.o.d"
+  "CMakeFiles/tests.dir/Helpers/test-MIDICNCHannelAddress.cpp.o"
+  "CMakeFiles/tests.dir/Helpers/test-MIDICNCHannelAddress.cpp.o.d"
+  "CMakeFiles/tests.dir/MIDI_Constants/test-MCU.cpp.o"
+  "CMakeFiles/tests.dir/MIDI_Constants/test-MCU.cpp.o.d"
+  "CMakeFiles/tests.dir/MIDI_Constants/test-Notes.cpp.o"
+  "CMakeFiles/tests.dir/MIDI_Constants/test-Notes.cpp.o.d"
+  "CMakeFiles/tests.dir/MIDI_Inputs/test-MCU_LCD.cpp.o"
+  "CMakeFiles/tests.dir/MIDI_Inputs/test-MCU_LCD.cpp.o.d"
+  "CMakeFiles/tests.dir/MIDI_Inputs/test-MCU_TimeDisplay.cpp.o"
+  "CMakeFiles/tests.dir/MIDI_Inputs/test-MCU_TimeDisplay.cpp.o.d"
+  "CMakeFiles/tests.dir/MIDI_Inputs/test-MIDIInputElement.cpp.o"
+  "CMakeFiles/tests.dir/MIDI_Inputs/test-MIDIInputElement.cpp.o.d"
+  "CMakeFiles/tests.dir/MIDI_Inputs/test-MIDINote.cpp.o"
+  "CMakeFiles/tests.dir/MIDI_Inputs/test-MIDINote.cpp.o.d"
+  "CMakeFiles/tests.dir/MIDI_Inputs/test-NoteCCKPLEDBar.cpp.o"
+  "CMakeFiles/tests.dir/MIDI_Inputs/test-NoteCCKPLEDBar.cpp.o.d"
+  "CMakeFiles/tests.dir/MIDI_Inputs/tests-MCU_VPot.cpp.o"
+  "CMakeFiles/tests.dir/MIDI_Inputs/tests-MCU_VPot.cpp.o.d"
+  "CMakeFiles/tests.dir/MIDI_Inputs/tests-MCU_VU.cpp.o"
+  "CMakeFiles/tests.dir/MIDI_Inputs/tests-MCU_VU.cpp.o.d"
+  "CMakeFiles/tests.dir/MIDI_Interfaces/test-BLEAPI.cpp.o"
+  "CMakeFiles/tests.dir/MIDI_Interfaces/test-BLEAPI.cpp.o.d"
+  "CMakeFiles/tests.dir/MIDI_Interfaces/test-BLEMIDIMessageQueue.cpp.o"
+  "CMakeFiles/tests.dir/MIDI_Interfaces/test-BLEMIDIMessageQueue.cpp.o.d"
+  "CMakeFiles/tests.dir/MIDI_Interfaces/test-BLEMIDIPacketBuilder.cpp.o"
+  "CMakeFiles/tests.dir/MIDI_Interfaces/test-BLEMIDIPacketBuilder.cpp.o.d"
+  "CMakeFiles/tests.dir/MIDI_Interfaces/test-BLEMIDIPacketScheduler.cpp.o"
+  "CMakeFiles/tests.dir/MIDI_Interfaces/test-BLEMIDIPacketScheduler.cpp.o.d"
+  "CMakeFiles/tests.dir/MIDI_Interfaces/test-BluetoothMIDI_Interface.cpp.o"
+  "CMakeFiles/tests.dir/MIDI_Interfaces/test-BluetoothMIDI_Interface.cpp.o.d"
+  "CMakeFiles/tests.dir/MIDI_Interfaces/test-CoalescingMIDI_Pipe.cpp.o"
+  "CMakeFiles/tests.dir/MIDI_Interfaces/test-CoalescingMIDI_Pipe.cpp.o.d"
+  "CMakeFiles/tests.dir/MIDI_Interfaces/test-DebugStreamMIDI_Interface.cpp.o"
+  "CMakeFiles/tests.dir/MIDI_Interfaces/test-DebugStreamMIDI_Interface.cpp.o.d"
+  "CMakeFiles/tests.dir/MIDI_Interfaces/test-MIDI_Pipeline.cpp.o"
+  "CMakeFiles/tests.dir/MIDI_Interfaces/test-MIDI_Pipeline.cpp.o.d"
+  "CMakeFiles/tests.dir/MIDI_Interfaces/test-MIDI_Pipes.cpp.o"
+  "CMakeFiles/tests.dir/MIDI_Interfaces/test-MIDI_Pipes.cpp.o.d"
+  "CMakeFiles/tests.dir/MIDI_Interfaces/test-StreamMIDI_Interface.cpp.o"
+  "CMakeFiles/tests.dir/MIDI_Interfaces/test-StreamMIDI_Interface.cpp.o.d"
+  "CMakeFiles/tests.dir/MIDI_Interfaces/test-USBBulk.cpp.o"
+  "CMakeFiles/tests.dir/MIDI_Interfaces/test-USBBulk.cpp.o.d"
+  "CMakeFiles/tests.dir/MIDI_Interfaces/test-USBMIDI_Interface.cpp.o"
+  "CMakeFiles/tests.dir/MIDI_Interfaces/test-USBMIDI_Interface.cpp.o.d"
+  "CMakeFiles/tests.dir/MIDI_Outputs/test-CCButton.cpp.o"
+  "CMakeFiles/tests.dir/MIDI_Outputs/test-CCButton.cpp.o.d"
+  "CMakeFiles/tests.dir/MIDI_Outputs/test-CCPotentiometer.cpp.o"
+  "CMakeFiles/tests.dir/MIDI_Outputs/test-CCPotentiometer.cpp.o.d"
+  "CMakeFiles/tests.dir/MIDI_Outputs/test-CCRotaryEncoder.cpp.o"
+  "CMakeFiles/tests.dir/MIDI_Outputs/test-CCRotaryEncoder.cpp.o.d"
+  "CMakeFiles/tests.dir/MIDI_Outputs/test-Construction.cpp.o"
+  "CMakeFiles/tests.dir/MIDI_Outputs/test-Construction.cpp.o.d"
+  "CMakeFiles/tests.dir/MIDI_Outputs/test-NoteButton.cpp.o"
+  "CMakeFiles/tests.dir/MIDI_Outputs/test-NoteButton.cpp.o.d"
+  "CMakeFiles/tests.dir/MIDI_Outputs/test-NoteButtonLatching.cpp.o"
+  "CMakeFiles/tests.dir/MIDI_Outputs/test-NoteButtonLatching.cpp.o.d"
+  "CMakeFiles/tests.dir/MIDI_Outputs/test-NoteButtonMatrix.cpp.o"
+  "CMakeFiles/tests.dir/MIDI_Outputs/test-NoteButtonMatrix.cpp.o.d"
+  "CMakeFiles/tests.dir/MIDI_Outputs/test-PBPotentiometer.cpp.o"
+  "CMakeFiles/tests.dir/MIDI_Outputs/test-PBPotentiometer.cpp.o.d"
+  "CMakeFiles/tests.dir/MIDI_Outputs/test-ProgramChanger.cpp.o"
+  "CMakeFiles/tests.dir/MIDI_Outputs/test-ProgramChanger.cpp.o.d"
+  "CMakeFiles/tests.dir/MIDI_Parsers/tests-MIDI_Parsers.cpp.o"
+  "CMakeFiles/tests.dir/MIDI_Parsers/tests-MIDI_Parsers.cpp.o.d"
+  "CMakeFiles/tests.dir/MIDI_Senders/test-RelativeCCSender.cpp.o"
+  "CMakeFiles/tests.dir/MIDI_Senders/test-RelativeCCSender.cpp.o.d"
+  "CMakeFiles/tests.dir/Selectors/test-IncrementDecrementSelector.cpp.o"
+  "CMakeFiles/tests.dir/Selectors/test-IncrementDecrementSelector.cpp.o.d"
+  "CMakeFiles/tests.dir/Selectors/test-IncrementSelector.cpp.o"
+  "CMakeFiles/tests.dir/Selectors/test-IncrementSelector.cpp.o.d"
+  "CMakeFiles/tests.dir/Selectors/test-ManyButtonsSelector.cpp.o"
+  "CMakeFiles/tests.dir/Selectors/test-ManyButtonsSelector.cpp.o.d"
+  "CMakeFiles/tests.dir/test-main.cpp.o"
+  "CMakeFiles/tests.dir/test-main.cpp.o.d"
+  "CMakeFiles/tests.dir/test_example.cpp.o"
+  "CMakeFiles/tests.dir/test_example.cpp.o.d"
+  "tests"
+  "tests.pdb"
+  "tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
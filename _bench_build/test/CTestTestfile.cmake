@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test
+# Build directory: /root/repo/_bench_build/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_bench_build/test/tests[1]_include.cmake")
+subdirs("tools")
+subdirs("benchmarks")
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/benchmarks/benchmark-MIDIInputDispatch.cpp" "test/benchmarks/CMakeFiles/benchmark-MIDIInputDispatch.dir/benchmark-MIDIInputDispatch.cpp.o" "gcc" "test/benchmarks/CMakeFiles/benchmark-MIDIInputDispatch.dir/benchmark-MIDIInputDispatch.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/src/AH/CMakeFiles/Arduino_Helpers.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/CMakeFiles/Control_Surface.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/mock/CMakeFiles/ArduinoMock.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmark-MIDIInputDispatch.dir/benchmark-MIDIInputDispatch.cpp.o"
+  "CMakeFiles/benchmark-MIDIInputDispatch.dir/benchmark-MIDIInputDispatch.cpp.o.d"
+  "benchmark-MIDIInputDispatch"
+  "benchmark-MIDIInputDispatch.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmark-MIDIInputDispatch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
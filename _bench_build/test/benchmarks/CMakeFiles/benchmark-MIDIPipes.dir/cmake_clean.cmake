@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmark-MIDIPipes.dir/benchmark-MIDIPipes.cpp.o"
+  "CMakeFiles/benchmark-MIDIPipes.dir/benchmark-MIDIPipes.cpp.o.d"
+  "benchmark-MIDIPipes"
+  "benchmark-MIDIPipes.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmark-MIDIPipes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmark-MIDIThroughput.dir/benchmark-MIDIThroughput.cpp.o"
+  "CMakeFiles/benchmark-MIDIThroughput.dir/benchmark-MIDIThroughput.cpp.o.d"
+  "benchmark-MIDIThroughput"
+  "benchmark-MIDIThroughput.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmark-MIDIThroughput.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
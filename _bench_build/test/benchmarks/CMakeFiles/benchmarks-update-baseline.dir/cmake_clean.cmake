@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmarks-update-baseline"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/benchmarks-update-baseline.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
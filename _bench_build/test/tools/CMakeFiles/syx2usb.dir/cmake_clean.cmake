@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/syx2usb.dir/syx2usb.cpp.o"
+  "CMakeFiles/syx2usb.dir/syx2usb.cpp.o.d"
+  "syx2usb"
+  "syx2usb.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/syx2usb.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
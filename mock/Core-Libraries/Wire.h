@@ -0,0 +1,17 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// TODO
+class TwoWire {
+  public:
+    void begin() {}
+    void beginTransmission(uint8_t) {}
+    uint8_t endTransmission(bool = true) { return 0; }
+    uint8_t requestFrom(uint8_t, uint8_t) { return 0; }
+    size_t write(uint8_t) { return 1; }
+    size_t write(const uint8_t *, size_t len) { return len; }
+    int available() { return 0; }
+    int read() { return -1; }
+} extern Wire;
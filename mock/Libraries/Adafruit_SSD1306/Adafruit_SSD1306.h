@@ -43,6 +43,7 @@ typedef uint32_t PortMask;
 
 // #include <SPI.h>
 #include <Adafruit_GFX.h>
+#include <Wire.h>
 
 #define BLACK 0
 #define WHITE 1
@@ -165,6 +166,7 @@ class Adafruit_SSD1306 : public Adafruit_GFX {
     // void dim(boolean dim);
 
     void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+    uint8_t *getBuffer();
 
     void drawFastVLine(int16_t x, int16_t y, int16_t h,
                        uint16_t color) override;
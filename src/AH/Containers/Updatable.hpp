@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include <AH/Arduino-Wrapper.h> // micros
 #include <AH/Containers/CRTP.hpp>
 #include <AH/Containers/LinkedList.hpp>
 #include <AH/Error/Error.hpp>
@@ -122,9 +123,13 @@ class UpdatableCRTP : public DoublyLinkable<Derived> {
     }
 
     /// @copydoc enable()
-    static void enable(UpdatableCRTP *element) { element->enable(); }
+    static void enable(UpdatableCRTP *element) {
+        CRTP_INST(Derived, *element).enable();
+    }
     /// @copydoc enable()
-    static void enable(UpdatableCRTP &element) { element.enable(); }
+    static void enable(UpdatableCRTP &element) {
+        CRTP_INST(Derived, element).enable();
+    }
     /// @copydoc enable()
     template <class U, size_t N>
     static void enable(U (&array)[N]) {
@@ -133,9 +138,13 @@ class UpdatableCRTP : public DoublyLinkable<Derived> {
     }
 
     /// @copydoc disable()
-    static void disable(UpdatableCRTP *element) { element->disable(); }
+    static void disable(UpdatableCRTP *element) {
+        CRTP_INST(Derived, *element).disable();
+    }
     /// @copydoc disable()
-    static void disable(UpdatableCRTP &element) { element.disable(); }
+    static void disable(UpdatableCRTP &element) {
+        CRTP_INST(Derived, element).disable();
+    }
     /// @copydoc disable()
     template <class U, size_t N>
     static void disable(U (&array)[N]) {
@@ -157,16 +166,69 @@ DoublyLinkedList<Derived> UpdatableCRTP<Derived>::updatables;
 
 struct NormalUpdatable {};
 
+/**
+ * @brief   Rate classes that determine how often an @ref Updatable is updated
+ *          by @ref Updatable::updateAll.
+ * 
+ * The classes are serviced in this order. When the update budget runs out, the
+ * next call to `updateAll` resumes with the class that was interrupted, so the
+ * faster classes cannot starve the slower ones.
+ */
+enum class UpdateRate : uint8_t {
+    EveryLoop = 0, ///< Update on every call to `updateAll` (default).
+    Fast = 1,      ///< Every @ref UPDATE_INTERVAL_FAST µs (1 kHz).
+    Medium = 2,    ///< Every @ref UPDATE_INTERVAL_MEDIUM µs (200 Hz).
+    Slow = 3,      ///< Every @ref UPDATE_INTERVAL_SLOW µs (30 Hz).
+};
+
+/// The number of @ref UpdateRate classes.
+constexpr uint8_t NumUpdateRates = 4;
+
 /**
  * @brief   A super class for object that have to be updated regularly.
  * 
  * All instances of this class are kept in a linked list, so it's easy to 
  * iterate over all of them to update them.
  * 
+ * By default, @ref updateAll updates all instances every time it is called.
+ * If some instances don't need to be updated that often, they can be assigned
+ * a slower rate class using @ref setUpdateRate. Additionally, the time spent
+ * in each call to @ref updateAll can be limited using @ref setUpdateBudget.
+ * Once the budget is exhausted, the remaining instances are skipped, and the
+ * next call resumes with the rate class that was interrupted, so each
+ * instance is updated at most once per interval of its rate class, and no
+ * instance is starved, not even if the faster classes use up the entire
+ * budget.
+ * 
+ * As long as all instances use the `EveryLoop` rate class and no budget is
+ * set, @ref updateAll simply updates all instances, without checking the time.
+ * 
+ * @note    To support the rate classes, each instance stores two extra bytes
+ *          (its rate class and the round it was last updated in), which adds
+ *          up on AVR boards with many updatables.
+ * 
  * @nosubgrouping
  */
 template <class T = NormalUpdatable>
 class Updatable : public UpdatableCRTP<Updatable<T>> {
+  protected:
+    Updatable() = default;
+    /// Copies get the same rate class as the original.
+    Updatable(const Updatable &other) : UpdatableCRTP<Updatable<T>>(other) {
+        setUpdateRate(other.getUpdateRate());
+    }
+    Updatable &operator=(const Updatable &) { return *this; }
+    /// Moved-to instances get the same rate class as the original.
+    Updatable(Updatable &&other)
+        : UpdatableCRTP<Updatable<T>>(std::move(other)) {
+        setUpdateRate(other.getUpdateRate());
+    }
+    Updatable &operator=(Updatable &&) { return *this; }
+
+  public:
+    /// Destructor: stop counting this updatable as scheduled.
+    ~Updatable() override { setUpdateRate(UpdateRate::EveryLoop); }
+
   public:
     /// @name Main initialization and updating methods
     /// @{
@@ -181,11 +243,162 @@ class Updatable : public UpdatableCRTP<Updatable<T>> {
     /// @see    begin()
     static void beginAll() { Updatable::applyToAll(&Updatable::begin); }
 
-    /// Update all enabled instances of this class
+    /// Update all enabled instances of this class that are due, within the
+    /// update budget.
     /// @see    update()
-    static void updateAll() { Updatable::applyToAll(&Updatable::update); }
+    static void updateAll() {
+        if (scheduled)
+            updateScheduled();
+        else
+            Updatable::applyToAll(&Updatable::update);
+    }
 
     /// @}
+
+  public:
+    /// @name Scheduling
+    /// @{
+
+    /// Set the rate class of this updatable.
+    void setUpdateRate(UpdateRate rate) {
+        bool wasEveryLoop = rateClass == 0;
+        rateClass = static_cast<uint8_t>(rate);
+        round = initialRound(rateClass);
+        if (wasEveryLoop && rateClass != 0)
+            ++numScheduledInstances;
+        else if (!wasEveryLoop && rateClass == 0)
+            --numScheduledInstances;
+        updateScheduledFlag();
+    }
+    /// Get the rate class of this updatable.
+    UpdateRate getUpdateRate() const {
+        return static_cast<UpdateRate>(rateClass);
+    }
+
+    /// Set the update interval of the given rate class in microseconds.
+    static void setUpdateInterval(UpdateRate rate, unsigned long interval) {
+        rateClasses[static_cast<uint8_t>(rate)].interval = interval;
+    }
+    /// Get the update interval of the given rate class in microseconds.
+    static unsigned long getUpdateInterval(UpdateRate rate) {
+        return rateClasses[static_cast<uint8_t>(rate)].interval;
+    }
+
+    /**
+     * @brief   Limit the time spent updating instances in a single call to
+     *          @ref updateAll.
+     * 
+     * At least one instance is updated per call, the update of an instance
+     * is never interrupted, so the actual time may exceed the budget by the
+     * duration of one update.
+     * 
+     * @param   budget
+     *          The maximum time in microseconds, or zero for no limit.
+     */
+    static void setUpdateBudget(unsigned long budget) {
+        Updatable::budget = budget;
+        updateScheduledFlag();
+    }
+    /// Get the update budget in microseconds.
+    static unsigned long getUpdateBudget() { return budget; }
+
+    /// @}
+
+  private:
+    /// Update the instances whose rate class is due, until the budget is
+    /// exhausted.
+    static void updateScheduled();
+    /// The round value for an instance that joins the given rate class, such
+    /// that it is due in the current round (if one is in progress) or in the
+    /// next one.
+    static bool initialRound(uint8_t c) {
+        return rateClasses[c].pending ? !rateClasses[c].round
+                                      : rateClasses[c].round;
+    }
+    /// Only use the scheduler if it is needed: if a budget was set, or if any
+    /// instances use a rate class other than `EveryLoop`.
+    static void updateScheduledFlag() {
+        scheduled = budget != 0 || numScheduledInstances != 0;
+    }
+
+    /// The rate class of this updatable.
+    uint8_t rateClass = 0;
+    /// The round of its rate class in which this updatable was last updated.
+    bool round = initialRound(0);
+
+    struct RateClass {
+        /// The update interval in microseconds.
+        unsigned long interval;
+        /// The time the current round was started.
+        unsigned long roundStart;
+        /// Whether some instances haven't been updated this round yet.
+        bool pending;
+        /// Toggled at the start of each round.
+        bool round;
+    };
+    static RateClass rateClasses[NumUpdateRates];
+    static unsigned long budget;
+    /// The rate class to start with during the next call, i.e. the class that
+    /// was interrupted because the budget ran out.
+    static uint8_t resumeClass;
+    /// The number of instances with a rate class other than `EveryLoop`.
+    static unsigned numScheduledInstances;
+    /// Whether any instances have a rate class other than `EveryLoop`, or
+    /// whether a budget was set.
+    static bool scheduled;
 };
 
+template <class T>
+typename Updatable<T>::RateClass Updatable<T>::rateClasses[NumUpdateRates] = {
+    {0, 0, false, false},
+    {UPDATE_INTERVAL_FAST, 0, false, false},
+    {UPDATE_INTERVAL_MEDIUM, 0, false, false},
+    {UPDATE_INTERVAL_SLOW, 0, false, false},
+};
+
+template <class T>
+unsigned long Updatable<T>::budget = 0;
+
+template <class T>
+uint8_t Updatable<T>::resumeClass = 0;
+
+template <class T>
+unsigned Updatable<T>::numScheduledInstances = 0;
+
+template <class T>
+bool Updatable<T>::scheduled = false;
+
+template <class T>
+void Updatable<T>::updateScheduled() {
+    unsigned long start = micros();
+    bool updatedAny = false;
+    for (uint8_t i = 0; i < NumUpdateRates; ++i) {
+        uint8_t c = (resumeClass + i) % NumUpdateRates;
+        RateClass &rc = rateClasses[c];
+        if (!rc.pending) {
+            if (start - rc.roundStart < rc.interval)
+                continue;
+            // Start a new round: all instances in this class are due
+            rc.roundStart = start;
+            rc.round = !rc.round;
+            rc.pending = true;
+        }
+        for (Updatable &el : Updatable::updatables) {
+            if (el.rateClass != c || el.round == rc.round)
+                continue;
+            // The remaining instances are updated during the next call, which
+            // starts with this class
+            if (budget != 0 && updatedAny && micros() - start >= budget) {
+                resumeClass = c;
+                return;
+            }
+            el.update();
+            el.round = rc.round;
+            updatedAny = true;
+        }
+        rc.pending = false;
+    }
+    resumeClass = 0;
+}
+
 END_AH_NAMESPACE
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <AH/Hardware/Button.hpp>
+#include <AH/Hardware/ExtendedInputOutput/ExtendedIOElement.hpp>
+#include <AH/STL/climits> // CHAR_BIT
+
+BEGIN_AH_NAMESPACE
+
+/**
+ * @brief   A class for reading and debouncing many buttons connected to the
+ *          consecutive pins of an extended IO element at once.
+ *
+ * Instead of reading and debouncing each button individually, like
+ * @ref Button does, the inputs are read from the ExtendedIOElement as packed
+ * words, and all buttons in a word are debounced simultaneously, using
+ * bitwise "vertical counter" logic: for each button, a two-bit counter
+ * (stored as two bit planes) counts the number of consecutive samples that
+ * differ from the debounced state. A button only changes state after four
+ * such samples, any sample that matches the debounced state resets its
+ * counter.
+ *
+ * The inputs are sampled every quarter of the debounce time, so a change is
+ * reported between one and 1.25 debounce times after the input settled.
+ * Only a single call to `millis()` and a single read of the IO element are
+ * required per update, regardless of the number of buttons. If the IO element
+ * keeps track of changes to its inputs (see
+ * @ref ExtendedIOElement::getInputRevision), samples where nothing changed
+ * and no buttons are bouncing are skipped altogether.
+ *
+ * @tparam  N
+ *          The number of buttons.
+ *
+ * @ingroup AH_HardwareUtils
+ */
+template <uint16_t N>
+class ButtonBank {
+  public:
+    /// The type used to debounce multiple buttons at once.
+    using word_t = uint_fast32_t;
+    /// The number of buttons in one word.
+    constexpr static uint8_t WordBits = sizeof(word_t) * CHAR_BIT;
+    /// The number of words required to store the states of all buttons.
+    constexpr static uint16_t NumWords = (N + WordBits - 1) / WordBits;
+
+    /**
+     * @brief   Create a new ButtonBank.
+     *
+     * @param   element
+     *          The extended IO element the buttons are connected to.
+     * @param   firstPin
+     *          The (zero-based) pin of the element the first button is
+     *          connected to. The other buttons are connected to the next
+     *          `N - 1` pins.
+     */
+    ButtonBank(ExtendedIOElement &element, pin_int_t firstPin = 0)
+        : element(&element), firstPin(firstPin) {}
+
+    /// Initialize (enable the internal pull-up resistors).
+    void begin();
+
+    /**
+     * @brief   Invert the input state of all buttons
+     *          (button pressed is `HIGH` instead of `LOW`).
+     */
+    void invert() { inverted = true; }
+
+    /**
+     * @brief   Read and debounce all buttons.
+     *
+     * @return  True if any of the buttons was pressed or released, false
+     *          otherwise.
+     */
+    bool update();
+
+    /// @name   Accessing the button states as bit masks
+    /// @{
+
+    /// The debounced states of buttons @f$ w \cdot WordBits @f$ through
+    /// @f$ (w + 1) \cdot WordBits - 1 @f$. A bit is set if the button is
+    /// pressed.
+    word_t getPressed(uint16_t w) const { return pressed[w]; }
+    /// The buttons in word @p w that were pressed during the last update.
+    word_t getPressedEdges(uint16_t w) const { return edges[w] & pressed[w]; }
+    /// The buttons in word @p w that were released during the last update.
+    word_t getReleasedEdges(uint16_t w) const {
+        return edges[w] & ~pressed[w];
+    }
+    /// The buttons in word @p w that were pressed or released during the last
+    /// update.
+    word_t getEdges(uint16_t w) const { return edges[w]; }
+
+    /// @}
+
+    /**
+     * @brief   Get the state of the given button, as if it were a @ref Button.
+     *
+     * @param   index
+     *          The index of the button, in @f$ [0, N) @f$.
+     * @return  @ref Button::Falling or @ref Button::Rising if the button was
+     *          pressed or released during the last update,
+     *          @ref Button::Pressed or @ref Button::Released otherwise.
+     */
+    Button::State getState(uint16_t index) const;
+
+    /// Set the debounce time of this bank in milliseconds.
+    void setDebounceTime(unsigned long debounceTime) {
+        this->debounceTime = debounceTime;
+    }
+    /// Get the debounce time of this bank in milliseconds.
+    unsigned long getDebounceTime() const { return debounceTime; }
+
+    /// Get the number of buttons.
+    constexpr static uint16_t length() { return N; }
+
+  private:
+    /// Read the (non-inverted) input states of the given word.
+    word_t read(uint16_t w) const;
+    /// Get the mask of the bits of word @p w that correspond to a button.
+    constexpr static word_t getMask(uint16_t w) {
+        return (w + 1) * WordBits <= N
+                   ? ~word_t(0)
+                   : (word_t(1) << (N % WordBits)) - 1;
+    }
+
+  private:
+    ExtendedIOElement *element;
+    pin_int_t firstPin;
+    bool inverted = false;
+    unsigned long debounceTime = BUTTON_DEBOUNCE_TIME;
+    unsigned long prevSampleTime = 0;
+    uint16_t inputRevision = ExtendedIOElement::NoInputRevision;
+    bool debouncing = false;
+    word_t pressed[NumWords] = {};
+    word_t edges[NumWords] = {};
+    /// The two bit planes of the vertical counters.
+    word_t count0[NumWords] = {}, count1[NumWords] = {};
+};
+
+END_AH_NAMESPACE
+
+#include "ButtonBank.ipp" // Template implementations
@@ -0,0 +1,78 @@
+#include "ButtonBank.hpp"
+
+BEGIN_AH_NAMESPACE
+
+template <uint16_t N>
+void ButtonBank<N>::begin() {
+    for (uint16_t i = 0; i < N; ++i)
+        element->pinModeBuffered(firstPin + i, INPUT_PULLUP);
+    element->updateBufferedOutputs();
+}
+
+template <uint16_t N>
+auto ButtonBank<N>::read(uint16_t w) const -> word_t {
+    word_t bits = 0;
+    uint16_t offset = w * WordBits;
+    uint16_t remaining = N - offset;
+    uint8_t count = remaining < WordBits ? remaining : WordBits;
+    for (uint8_t i = 0; i < count; i += 32) {
+        uint8_t n = count - i < 32 ? count - i : 32;
+        bits |= word_t(element->digitalReadBufferedBits(firstPin + offset + i,
+                                                        n))
+                << i;
+    }
+    return bits;
+}
+
+template <uint16_t N>
+bool ButtonBank<N>::update() {
+    unsigned long now = millis();
+    if (now - prevSampleTime < debounceTime / 4) {
+        for (word_t &e : edges)
+            e = 0;
+        return false;
+    }
+    prevSampleTime = now;
+    element->updateBufferedInputs();
+    // If the inputs didn't change since the last sample, and none of the
+    // buttons are bouncing, the state can't change either
+    uint16_t revision = element->getInputRevision();
+    if (revision != ExtendedIOElement::NoInputRevision &&
+        revision == inputRevision && !debouncing) {
+        for (word_t &e : edges)
+            e = 0;
+        return false;
+    }
+    inputRevision = revision;
+    bool changed = false;
+    debouncing = false;
+    for (uint16_t w = 0; w < NumWords; ++w) {
+        // The inputs are active-low, unless inverted
+        word_t input = (inverted ? read(w) : ~read(w)) & getMask(w);
+        // Count the samples that differ from the debounced state, reset the
+        // counters of the inputs that don't
+        word_t delta = input ^ pressed[w];
+        count1[w] = (count1[w] ^ count0[w]) & delta;
+        count0[w] = ~count0[w] & delta;
+        // The counters that wrapped around have seen four differing samples
+        edges[w] = delta & ~(count0[w] | count1[w]);
+        pressed[w] ^= edges[w];
+        changed |= edges[w] != 0;
+        debouncing |= (count0[w] | count1[w]) != 0;
+    }
+    return changed;
+}
+
+template <uint16_t N>
+Button::State ButtonBank<N>::getState(uint16_t index) const {
+    uint16_t w = index / WordBits;
+    word_t mask = word_t(1) << (index % WordBits);
+    bool isPressed = pressed[w] & mask;
+    bool isEdge = edges[w] & mask;
+    if (isPressed)
+        return isEdge ? Button::Falling : Button::Pressed;
+    else
+        return isEdge ? Button::Rising : Button::Released;
+}
+
+END_AH_NAMESPACE
@@ -2,23 +2,59 @@
 
 #pragma once
 
+#include <AH/Hardware/ExtendedInputOutput/ExtendedIOElement.hpp>
 #include <AH/Hardware/Hardware-Types.hpp>
+#include <AH/Settings/SettingsWrapper.hpp>
+#include <AH/STL/climits>     // CHAR_BIT
+#include <AH/STL/type_traits> // conditional
 
 BEGIN_AH_NAMESPACE
 
 /**
  * @brief   A class that reads the states of a button matrix.
  *
+ * The rows are driven low one at a time, and the states of all columns of
+ * that row are read into a single word. If all column pins are consecutive
+ * pins of the same @ref ExtendedIOElement, they are read using one call to
+ * @ref ExtendedIOElement::digitalReadBufferedBits, otherwise, the column pins
+ * are read one by one.
+ *
+ * Each key is debounced individually: a change of state is reported
+ * immediately, after which the key ignores any further changes for the
+ * duration of the debounce time. Keys that are bouncing don't affect the other
+ * keys. To save RAM, only the least significant byte of the time of the last
+ * change is stored for each key (one byte per key), so the debounce time is
+ * limited to 255 ms.
+ *
+ * To bound the time spent in each call to @ref update, the matrix can be
+ * scanned incrementally, a few rows at a time, see @ref setRowsPerUpdate.
+ *
+ * Matrices without diodes suffer from ghosting: when three keys on the
+ * corners of a rectangle are pressed, the fourth key appears to be pressed as
+ * well. Such chords are detected and reported using the
+ * `onGhostedChord` callback.
+ *
  * @tparam  NumRows
  *          The number of rows in the button matrix.
  * @tparam  NumCols
- *          The number of columns in the button matrix.
+ *          The number of columns in the button matrix, at most 64.
  * 
  * @ingroup AH_HardwareUtils
  */
 template <class Derived, uint8_t NumRows, uint8_t NumCols>
 class ButtonMatrix {
+    static_assert(NumCols <= 64, "At most 64 columns are supported");
+
   public:
+    /// The type used to store the states of all columns of one row, bit
+    /// @f$ c @f$ corresponds to column @f$ c @f$.
+    using ColMask = typename std::conditional<
+        (NumCols <= 8), uint8_t,
+        typename std::conditional<
+            (NumCols <= 16), uint16_t,
+            typename std::conditional<(NumCols <= 32), uint32_t,
+                                      uint64_t>::type>::type>::type;
+
     /**
      * @brief   Construct a new ButtonMatrix object.
      *
@@ -41,8 +77,9 @@ class ButtonMatrix {
     void begin();
 
     /**
-     * @brief   Scan the matrix, read all button states, and call the
-     *          onButtonChanged callback.
+     * @brief   Scan the next rows of the matrix (all rows by default), read the
+     *          button states, and call the onButtonChanged callback for each
+     *          button that changed state.
      */
     void update();
 
@@ -51,16 +88,39 @@ class ButtonMatrix {
      * 
      * @note    No bounds checking is performed.
      */
-    bool getPrevState(uint8_t col, uint8_t row);
+    bool getPrevState(uint8_t col, uint8_t row) const {
+        return (rowStates[row] >> col) & 1;
+    }
 
-    /// Configure the debounce time interval. Only one button can change in each
-    /// debounce interval. Time in milliseconds.
+    /// Get the states of all buttons in the given row. A bit is set if the
+    /// button is pressed.
+    ColMask getPressed(uint8_t row) const {
+        return ~rowStates[row] & ColMaskAll;
+    }
+
+    /// Configure the debounce time interval. After a button changed state,
+    /// further changes of that button are ignored during this interval.
+    /// Time in milliseconds. Longer times are capped to 255 ms, because only
+    /// one byte of the change time is stored per key.
     void setDebounceTime(unsigned long debounceTime) {
-        this->debounceTime = debounceTime;
+        this->debounceTime = debounceTime < 255 ? debounceTime : 255;
     }
     /// Get the debounce time.
     unsigned long getDebounceTime() const { return debounceTime; }
 
+    /// Set the number of rows to scan in each call to @ref update. Scanning
+    /// fewer rows bounds the duration of @ref update, at the cost of a lower
+    /// scan rate of each row.
+    void setRowsPerUpdate(uint8_t rows) {
+        rowsPerUpdate = rows == 0 || rows > NumRows ? NumRows : rows;
+    }
+    /// Get the number of rows scanned in each call to @ref update.
+    uint8_t getRowsPerUpdate() const { return rowsPerUpdate; }
+
+    /// Check whether the buttons that are currently pressed contain a chord
+    /// that causes ghosting.
+    bool isGhosting() const;
+
   protected:
     /**
      * @brief   The callback function that is called whenever a button changes
@@ -75,18 +135,69 @@ class ButtonMatrix {
      */
     void onButtonChanged(uint8_t row, uint8_t col, bool state) = delete;
 
+    /**
+     * @brief   The callback function that is called when a change in the given
+     *          row caused a chord that could be ghosted. The derived class can
+     *          implement it, it does nothing by default.
+     *
+     * The presses of the keys in these rows and columns are ambiguous: for
+     * each such key, it cannot be determined whether it was pressed or whether
+     * it's a ghost of the three other keys on the corners of the rectangle.
+     *
+     * @param   row1
+     *          The row that changed state.
+     * @param   row2
+     *          A row that has at least two pressed columns in common with
+     *          `row1`.
+     * @param   cols
+     *          The pressed columns both rows have in common.
+     */
+    void onGhostedChord(uint8_t row1, uint8_t row2, ColMask cols) {
+        (void)row1, (void)row2, (void)cols;
+    }
+
   private:
-    static inline uint8_t positionToBits(uint8_t col, uint8_t row);
-    static inline uint8_t bitsToIndex(uint8_t bits);
-    static inline uint8_t bitsToBitmask(uint8_t bits);
-    void setPrevState(uint8_t col, uint8_t row, bool state);
+    /// Read all column pins.
+    ColMask readColumns();
+    /// Scan the given row, debounce its buttons and report the changes.
+    void scanRow(uint8_t row, unsigned long now);
+    /// Check if more than one bit is set.
+    static bool multipleBits(ColMask x) { return x & (x - 1); }
+    /// Get the index of the least significant bit that is set.
+    static uint8_t lowestBit(ColMask x) {
+        uint8_t i = 0;
+        while (!(x & 1)) {
+            x >>= 1;
+            ++i;
+        }
+        return i;
+    }
+
+    constexpr static ColMask ColMaskAll =
+        NumCols == sizeof(ColMask) * CHAR_BIT
+            ? ~ColMask(0)
+            : (ColMask(1) << (NumCols % (sizeof(ColMask) * CHAR_BIT))) - 1;
 
     unsigned long debounceTime = BUTTON_DEBOUNCE_TIME;
-    unsigned long prevRefresh = 0;
-    uint8_t prevStates[(NumCols * NumRows + 7) / 8];
+    uint8_t rowsPerUpdate = NumRows;
+    uint8_t nextRow = 0;
+    /// The debounced states of the buttons, one word per row (1 = released).
+    ColMask rowStates[NumRows];
+    /// The buttons that changed state less than one debounce time ago (as of
+    /// the last scan of their row). The change times of the other buttons are
+    /// never looked at, so it doesn't matter that they wrap around.
+    ColMask bouncing[NumRows] = {};
+    /// The time of the last scan of each row.
+    unsigned long scanTimes[NumRows] = {};
+    /// The least significant byte of the time of the last change of each
+    /// button. Only valid for buttons that are still bouncing.
+    uint8_t changeTimes[NumRows][NumCols] = {};
 
     const PinList<NumRows> rowPins;
     const PinList<NumCols> colPins;
+    /// The extended IO element all column pins belong to, if they are
+    /// consecutive pins of the same element, `nullptr` otherwise.
+    ExtendedIOElement *colElement = nullptr;
 };
 
 END_AH_NAMESPACE
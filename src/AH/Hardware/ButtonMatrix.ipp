@@ -9,83 +9,118 @@ template <class Derived, uint8_t NumRows, uint8_t NumCols>
 ButtonMatrix<Derived, NumRows, NumCols>::ButtonMatrix(
     const PinList<NumRows> &rowPins, const PinList<NumCols> &colPins)
     : rowPins(rowPins), colPins(colPins) {
-    memset(prevStates, 0xFF, sizeof(prevStates));
+    for (ColMask &state : rowStates)
+        state = ColMaskAll;
 }
 
 template <class Derived, uint8_t NumRows, uint8_t NumCols>
 void ButtonMatrix<Derived, NumRows, NumCols>::update() {
     unsigned long now = millis();
-    // only update 25 ms after previous change (crude software debounce).
-    // Edit this in Settings/Settings.hpp
-    if (now - prevRefresh < debounceTime)
-        return;
+    for (uint8_t i = 0; i < rowsPerUpdate; ++i) {
+        scanRow(nextRow, now);
+        nextRow = nextRow + 1 == NumRows ? 0 : nextRow + 1;
+    }
+}
 
-    for (size_t row = 0; row < NumRows; row++) { // scan through all rows
-        pinMode(rowPins[row], OUTPUT);           // make the current row Lo-Z 0V
+template <class Derived, uint8_t NumRows, uint8_t NumCols>
+void ButtonMatrix<Derived, NumRows, NumCols>::scanRow(uint8_t row,
+                                                      unsigned long now) {
+    pinMode(rowPins[row], OUTPUT); // make the current row Lo-Z 0V
 #if !defined(__AVR__) && defined(ARDUINO)
-        delayMicroseconds(SELECT_LINE_DELAY);
+    delayMicroseconds(SELECT_LINE_DELAY);
 #endif
-        for (size_t col = 0; col < NumCols; col++) { // scan through all columns
-            bool state = digitalRead(colPins[col]);  // read the state
-            if (state != getPrevState(col, row)) {
-                // if the state changed since last time
-                // execute the handler
-                CRTP(Derived).onButtonChanged(row, col, state);
-                setPrevState(col, row, state); // remember the state
-                prevRefresh = now;
-            }
+    ColMask input = readColumns();
+    pinMode(rowPins[row], INPUT); // make the current row Hi-Z again
+
+    // Buttons that are no longer bouncing can change state again. The time
+    // since the change is split into the time since the previous scan, and
+    // the time between the change and the previous scan. The latter is less
+    // than the debounce time (the button was still bouncing during that
+    // scan), so its least significant byte is enough, even if the row hasn't
+    // been scanned in a long time.
+    unsigned long sinceScan = now - scanTimes[row];
+    uint8_t prevScan = scanTimes[row];
+    scanTimes[row] = now;
+    ColMask stillBouncing = 0;
+    if (sinceScan < debounceTime) {
+        for (ColMask b = bouncing[row]; b; b &= b - 1) {
+            uint8_t col = lowestBit(b);
+            uint8_t beforeScan = prevScan - changeTimes[row][col];
+            if (sinceScan + beforeScan < debounceTime)
+                stillBouncing |= ColMask(1) << col;
         }
-        pinMode(rowPins[row], INPUT); // make the current row Hi-Z again
     }
-}
-
-template <class Derived, uint8_t NumRows, uint8_t NumCols>
-void ButtonMatrix<Derived, NumRows, NumCols>::begin() {
-    // make all columns input pins and enable
-    // the internal pull-up resistors
-    for (const pin_t &colPin : colPins)
-        pinMode(colPin, INPUT_PULLUP);
-    // make all rows Hi-Z
-    for (const pin_t &rowPin : rowPins)
-        pinMode(rowPin, INPUT);
-}
+    bouncing[row] = stillBouncing;
 
-template <class Derived, uint8_t NumRows, uint8_t NumCols>
-inline uint8_t
-ButtonMatrix<Derived, NumRows, NumCols>::positionToBits(uint8_t col,
-                                                        uint8_t row) {
-    // map from a 2D array of bits to a flat array of bits
-    return col * NumRows + row;
-}
+    ColMask changed = (input ^ rowStates[row]) & ~bouncing[row];
+    if (!changed)
+        return;
+    rowStates[row] ^= changed;
+    bouncing[row] |= changed;
+    for (ColMask c = changed; c; c &= c - 1) {
+        uint8_t col = lowestBit(c);
+        changeTimes[row][col] = now;
+        CRTP(Derived).onButtonChanged(row, col, (input >> col) & 1);
+    }
 
-template <class Derived, uint8_t NumRows, uint8_t NumCols>
-inline uint8_t
-ButtonMatrix<Derived, NumRows, NumCols>::bitsToIndex(uint8_t bits) {
-    return bits >> 3; // bits / 8
+    // Check whether this row now forms a ghosted chord with any other row
+    ColMask pressed = getPressed(row);
+    if (!multipleBits(pressed))
+        return;
+    for (uint8_t other = 0; other < NumRows; ++other) {
+        ColMask common = pressed & getPressed(other);
+        if (other != row && multipleBits(common))
+            CRTP(Derived).onGhostedChord(row, other, common);
+    }
 }
 
 template <class Derived, uint8_t NumRows, uint8_t NumCols>
-inline uint8_t
-ButtonMatrix<Derived, NumRows, NumCols>::bitsToBitmask(uint8_t bits) {
-    return 1 << (bits & 7); // bits % 8
+auto ButtonMatrix<Derived, NumRows, NumCols>::readColumns() -> ColMask {
+    ColMask input = 0;
+    if (colElement != nullptr) {
+        // Read all columns at once
+        pin_int_t start = colPins[0] - colElement->getStart();
+        colElement->updateBufferedInputs();
+        for (uint8_t col = 0; col < NumCols; col += 32) {
+            uint8_t count = NumCols - col < 32 ? NumCols - col : 32;
+            input |= ColMask(colElement->digitalReadBufferedBits(start + col,
+                                                                 count))
+                     << col;
+        }
+    } else {
+        for (uint8_t col = 0; col < NumCols; ++col)
+            if (digitalRead(colPins[col]) == HIGH)
+                input |= ColMask(1) << col;
+    }
+    return input;
 }
 
 template <class Derived, uint8_t NumRows, uint8_t NumCols>
-bool ButtonMatrix<Derived, NumRows, NumCols>::getPrevState(uint8_t col,
-                                                           uint8_t row) {
-    uint8_t bits = positionToBits(col, row);
-    return !!(prevStates[bitsToIndex(bits)] & bitsToBitmask(bits));
+bool ButtonMatrix<Derived, NumRows, NumCols>::isGhosting() const {
+    for (uint8_t r1 = 0; r1 < NumRows; ++r1)
+        for (uint8_t r2 = r1 + 1; r2 < NumRows; ++r2)
+            if (multipleBits(getPressed(r1) & getPressed(r2)))
+                return true;
+    return false;
 }
 
 template <class Derived, uint8_t NumRows, uint8_t NumCols>
-void ButtonMatrix<Derived, NumRows, NumCols>::setPrevState(uint8_t col,
-                                                           uint8_t row,
-                                                           bool state) {
-    uint8_t bits = positionToBits(col, row);
-    if (state)
-        prevStates[bitsToIndex(bits)] |= bitsToBitmask(bits);
-    else
-        prevStates[bitsToIndex(bits)] &= ~bitsToBitmask(bits);
+void ButtonMatrix<Derived, NumRows, NumCols>::begin() {
+    // make all columns input pins and enable
+    // the internal pull-up resistors
+    for (const pin_t &colPin : colPins)
+        pinMode(colPin, INPUT_PULLUP);
+    // make all rows Hi-Z
+    for (const pin_t &rowPin : rowPins)
+        pinMode(rowPin, INPUT);
+    // check if all columns can be read at once
+    colElement = ExtIO::isNativePin(colPins[0])
+                     ? nullptr
+                     : ExtIO::getIOElementOfPinOrNull(colPins[0]);
+    for (uint8_t col = 1; col < NumCols && colElement; ++col)
+        if (colPins[col] != colPins[0] + col ||
+            colPins[col] >= colElement->getEnd())
+            colElement = nullptr;
 }
 
-END_AH_NAMESPACE
\ No newline at end of file
+END_AH_NAMESPACE
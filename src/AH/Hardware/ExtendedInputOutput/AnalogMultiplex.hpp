@@ -16,6 +16,20 @@ BEGIN_AH_NAMESPACE
  * You can use many multiplexers on the same address lines if each of the 
  * multiplexers has a different enable line.
  * 
+ * By default, every call to @ref analogRead selects the address, waits for the
+ * multiplexer to settle, and then reads the input. When reading many inputs
+ * every loop, this is slow, because all address lines are written and the
+ * settling time is spent for every single reading. In buffered mode (see
+ * @ref bufferInputs), @ref updateBufferedInputs reads all inputs at once, and
+ * both @ref analogRead and @ref analogReadBuffered return the stored results
+ * of the last scan. All address lines are written at the start of each scan,
+ * because other multiplexers on the same lines (or unbuffered reads) may have
+ * changed them. The inputs are then scanned in Gray code order, so only a
+ * single address line changes between two consecutive inputs, and the enable
+ * pin stays active during the entire scan. The address of the next input is
+ * selected as soon as the current input has been read, so it can settle while
+ * the result is being stored.
+ * 
  * @tparam  N 
  *          The number of address lines.
  * 
@@ -130,10 +144,14 @@ class AnalogMultiplex : public StaticSizeExtendedIOElement<1 << N> {
     void updateBufferedOutputs() override {} // LCOV_EXCL_LINE
 
     /**
-     * @brief   No periodic updating of the state is necessary, all actions are 
-     *          carried out when the user calls analogRead or digitalRead.
+     * @brief   In buffered mode, read all analog inputs of the multiplexer and
+     *          store the results. Otherwise, no periodic updating of the state
+     *          is necessary, all actions are carried out when the user calls
+     *          analogRead or digitalRead.
+     * 
+     * @see     bufferInputs
      */
-    void updateBufferedInputs() override {} // LCOV_EXCL_LINE
+    void updateBufferedInputs() override;
 
     /**
      * @brief   Specify whether to discard the first analog reading after 
@@ -143,11 +161,37 @@ class AnalogMultiplex : public StaticSizeExtendedIOElement<1 << N> {
         this->discardFirstReading_ = discardFirstReading_;
     }
 
+    /**
+     * @brief   Enable or disable buffered mode (disabled by default).
+     * 
+     * In buffered mode, all inputs are read during @ref updateBufferedInputs,
+     * which is called once per loop by `Control_Surface.loop()`, or manually 
+     * using @ref ExtendedIOElement::updateAllBufferedInputs. Afterwards,
+     * @ref analogRead and @ref analogReadBuffered simply return the value of
+     * the input during this scan, without accessing the hardware. 
+     * Digital reads are not buffered.
+     * 
+     * If the multiplexer has already been initialized, the inputs are scanned
+     * immediately, so the buffer never contains invalid readings.
+     */
+    void bufferInputs(bool bufferInputs_ = true) {
+        this->bufferInputs_ = bufferInputs_;
+        if (bufferInputs_ && initialized)
+            updateBufferedInputs();
+    }
+
   protected:
     const pin_t analogPin;
     const Array<pin_t, N> addressPins;
     const pin_t enablePin;
     bool discardFirstReading_ = true;
+    bool bufferInputs_ = false;
+    bool initialized = false;
+    /// The address that is currently selected, used to skip the address
+    /// lines that don't have to change during a scan.
+    uint8_t currentAddress = 0;
+    /// The results of the last scan in buffered mode.
+    Array<analog_t, 1 << N> bufferedValues = {{}};
 
     /**
      * @brief   Write the pin number/address to the address pins of the 
@@ -158,6 +202,28 @@ class AnalogMultiplex : public StaticSizeExtendedIOElement<1 << N> {
      */
     void setMuxAddress(uint8_t address);
 
+    /**
+     * @brief   Write the pin number/address to all address pins of the 
+     *          multiplexer, without waiting for the multiplexer to settle.
+     * 
+     * @param   address
+     *          The address to select.
+     */
+    void writeMuxAddress(uint8_t address);
+
+    /**
+     * @brief   Select the given address by writing only the address pins that
+     *          differ from the current address, without waiting for the 
+     *          multiplexer to settle.
+     * 
+     * Only valid if no one else has changed the address lines since the last
+     * call to @ref writeMuxAddress, i.e. during a scan.
+     * 
+     * @param   address
+     *          The address to select.
+     */
+    void changeMuxAddress(uint8_t address);
+
     /**
      * @brief   Select the correct address and enable the multiplexer.
      * 
@@ -219,6 +285,8 @@ PinStatus_t AnalogMultiplex<N>::digitalReadBuffered(pin_int_t pin) {
 
 template <uint8_t N>
 analog_t AnalogMultiplex<N>::analogRead(pin_int_t pin) {
+    if (bufferInputs_)
+        return bufferedValues[pin];
     prepareReading(static_cast<uint8_t>(pin));
     if (discardFirstReading_)
         (void)ExtIO::analogRead(analogPin); // Discard first reading
@@ -240,18 +308,73 @@ void AnalogMultiplex<N>::begin() {
         ExtIO::pinMode(enablePin, OUTPUT);
         ExtIO::digitalWrite(enablePin, MUX_DISABLED);
     }
+    initialized = true;
+    if (bufferInputs_)
+        updateBufferedInputs();
+}
+
+template <uint8_t N>
+void AnalogMultiplex<N>::updateBufferedInputs() {
+    if (!bufferInputs_)
+        return;
+    if (enablePin != NO_PIN)
+        ExtIO::digitalWrite(enablePin, MUX_ENABLED);
+    // The address lines may be shared with other multiplexers, or changed by
+    // unbuffered reads, so the cached address cannot be trusted here.
+    writeMuxAddress(0);
+#if !defined(__AVR__) && defined(ARDUINO)
+    unsigned long selectTime = micros();
+#endif
+    for (uint16_t i = 0; i < (1u << N); ++i) {
+        uint8_t address = currentAddress;
+#if !defined(__AVR__) && defined(ARDUINO)
+        while (micros() - selectTime < SELECT_LINE_DELAY)
+            ; // Wait for the multiplexer to settle
+#endif
+        if (discardFirstReading_)
+            (void)ExtIO::analogRead(analogPin); // Discard first reading
+        analog_t value = ExtIO::analogRead(analogPin);
+        // Select the next input in Gray code order before storing the result
+        uint16_t next = i + 1;
+        if (next < (1u << N)) {
+            changeMuxAddress(static_cast<uint8_t>(next ^ (next >> 1)));
+#if !defined(__AVR__) && defined(ARDUINO)
+            selectTime = micros();
+#endif
+        }
+        bufferedValues[address] = value;
+    }
+    afterReading();
 }
 
 template <uint8_t N>
 void AnalogMultiplex<N>::setMuxAddress(uint8_t address) {
+    writeMuxAddress(address);
+#if !defined(__AVR__) && defined(ARDUINO)
+    delayMicroseconds(SELECT_LINE_DELAY);
+#endif
+}
+
+template <uint8_t N>
+void AnalogMultiplex<N>::writeMuxAddress(uint8_t address) {
     uint8_t mask = 1;
     for (const pin_t &addressPin : addressPins) {
         ExtIO::digitalWrite(addressPin, (address & mask) != 0 ? HIGH : LOW);
         mask <<= 1;
     }
-#if !defined(__AVR__) && defined(ARDUINO)
-    delayMicroseconds(SELECT_LINE_DELAY);
-#endif
+    currentAddress = address;
+}
+
+template <uint8_t N>
+void AnalogMultiplex<N>::changeMuxAddress(uint8_t address) {
+    uint8_t changed = address ^ currentAddress;
+    uint8_t mask = 1;
+    for (const pin_t &addressPin : addressPins) {
+        if (changed & mask)
+            ExtIO::digitalWrite(addressPin, (address & mask) != 0 ? HIGH : LOW);
+        mask <<= 1;
+    }
+    currentAddress = address;
 }
 
 template <uint8_t N>
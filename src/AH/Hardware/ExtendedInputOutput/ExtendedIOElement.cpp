@@ -12,10 +12,77 @@ ExtendedIOElement::ExtendedIOElement(pin_int_t length)
                       "recommended."),
                     0x00FF);
     offset = end;
+    invalidatePinIndex();
+}
+
+constexpr uint16_t ExtendedIOElement::NoInputRevision;
+
+uint32_t ExtendedIOElement::digitalReadBufferedBits(pin_int_t pin,
+                                                    uint8_t count) {
+    uint32_t bits = 0;
+    for (uint8_t i = 0; i < count; ++i)
+        if (digitalReadBuffered(pin + i) == HIGH)
+            bits |= uint32_t(1) << i;
+    return bits;
 }
 
 void ExtendedIOElement::beginAll() {
     ExtendedIOElement::applyToAll(&ExtendedIOElement::begin);
+    pinIndexEnabled = true;
+    buildPinIndex();
+}
+
+void ExtendedIOElement::buildPinIndex() {
+    uint16_t size = 0;
+    for (auto &el : updatables) {
+        (void)el;
+        ++size;
+    }
+    pinIndex.reset(new ExtendedIOElement *[size]);
+    pinIndexSize = size;
+    // Insertion sort by start pin: the list is usually sorted already, unless
+    // elements were moved or re-enabled. Equal start pins (moved-from
+    // elements) keep their list order.
+    uint16_t i = 0;
+    for (auto &el : updatables) {
+        uint16_t j = i++;
+        while (j > 0 && pinIndex[j - 1]->start > el.start) {
+            pinIndex[j] = pinIndex[j - 1];
+            --j;
+        }
+        pinIndex[j] = &el;
+    }
+    pinIndexValid = true;
+}
+
+ExtendedIOElement *ExtendedIOElement::findElementOfPin(pin_t pin) {
+    if (pinIndexEnabled && !pinIndexValid)
+        buildPinIndex();
+    if (!pinIndexEnabled) {
+        for (auto &el : updatables)
+            if (pin >= el.start && pin < el.end)
+                return &el;
+        return nullptr;
+    }
+    // Binary search for the first element that starts after the given pin,
+    // the pin can only belong to the element before it.
+    uint16_t lo = 0, hi = pinIndexSize;
+    while (lo < hi) {
+        uint16_t mid = lo + (hi - lo) / 2;
+        if (pinIndex[mid]->start <= pin)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    // Elements with the same start pin (empty or moved-from elements) keep
+    // their list order, return the first one that contains the pin.
+    uint16_t last = lo;
+    while (lo > 1 && pinIndex[lo - 2]->start == pinIndex[lo - 1]->start)
+        --lo;
+    for (; lo > 0 && lo <= last; ++lo)
+        if (pin < pinIndex[lo - 1]->end)
+            return pinIndex[lo - 1];
+    return nullptr;
 }
 
 void ExtendedIOElement::updateAllBufferedOutputs() {
@@ -55,5 +122,9 @@ DoublyLinkedList<ExtendedIOElement> &ExtendedIOElement::getAll() {
 }
 
 pin_t ExtendedIOElement::offset = NUM_DIGITAL_PINS + NUM_ANALOG_INPUTS;
+std::unique_ptr<ExtendedIOElement *[]> ExtendedIOElement::pinIndex;
+uint16_t ExtendedIOElement::pinIndexSize = 0;
+bool ExtendedIOElement::pinIndexEnabled = false;
+bool ExtendedIOElement::pinIndexValid = false;
 
 END_AH_NAMESPACE
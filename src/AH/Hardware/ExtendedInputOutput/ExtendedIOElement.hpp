@@ -5,6 +5,8 @@
 #include "ExtendedInputOutput.hpp"
 #include <AH/Containers/Updatable.hpp>
 #include <AH/Hardware/Hardware-Types.hpp>
+#include <AH/STL/memory>  // unique_ptr
+#include <AH/STL/utility> // move
 
 BEGIN_AH_NAMESPACE
 
@@ -71,10 +73,17 @@ class ExtendedIOElement : public UpdatableCRTP<ExtendedIOElement> {
     ExtendedIOElement &operator=(const ExtendedIOElement &) = delete;
 
     /// Move constructor.
-    ExtendedIOElement(ExtendedIOElement &&) = default;
+    ExtendedIOElement(ExtendedIOElement &&other)
+        : UpdatableCRTP<ExtendedIOElement>(std::move(other)),
+          length(other.length), start(other.start), end(other.end) {
+        invalidatePinIndex();
+    }
     /// Move assignment.
     ExtendedIOElement &operator=(ExtendedIOElement &&) = delete;
 
+  public:
+    virtual ~ExtendedIOElement() { invalidatePinIndex(); }
+
   public:
     /** 
      * @brief   Set the mode of a given pin.
@@ -145,6 +154,24 @@ class ExtendedIOElement : public UpdatableCRTP<ExtendedIOElement> {
      */
     virtual PinStatus_t digitalReadBuffered(pin_int_t pin) = 0;
 
+    /**
+     * @brief   Read the states of multiple consecutive pins from the software
+     *          buffer at once.
+     *
+     * To update the buffer, you have to call @ref updateBufferedInputs first.
+     * The default implementation calls @ref digitalReadBuffered for each pin,
+     * elements that store their inputs as a bit field can override it to
+     * return the bits directly.
+     *
+     * @param   pin
+     *          The (zero-based) pin of this IO element to start reading at.
+     * @param   count
+     *          The number of pins to read, at most 32.
+     * @return  A bit mask where bit @f$ i @f$ is set if pin @f$ pin + i @f$
+     *          is high.
+     */
+    virtual uint32_t digitalReadBufferedBits(pin_int_t pin, uint8_t count);
+
     /**
      * @brief   Write an analog (or PWM) value to the given pin.
      * 
@@ -191,7 +218,8 @@ class ExtendedIOElement : public UpdatableCRTP<ExtendedIOElement> {
     virtual void begin() = 0;
 
     /**
-     * @brief   Initialize all extended IO elements.
+     * @brief   Initialize all extended IO elements, and build the index used
+     *          by @ref findElementOfPin.
      */
     static void beginAll();
 
@@ -211,6 +239,23 @@ class ExtendedIOElement : public UpdatableCRTP<ExtendedIOElement> {
      */
     virtual void updateBufferedInputs() = 0;
 
+    /// Value returned by @ref getInputRevision for elements that don't keep
+    /// track of changes to their inputs.
+    constexpr static uint16_t NoInputRevision = 0xFFFF;
+
+    /**
+     * @brief   Get a number that changes every time the contents of the input
+     *          buffers change.
+     *
+     * Allows users of the buffered inputs to skip processing them if nothing
+     * changed since they last read them, even if other users called
+     * @ref updateBufferedInputs in the meantime.
+     *
+     * @return  The revision of the input buffers, or @ref NoInputRevision if
+     *          this element doesn't keep track of changes.
+     */
+    virtual uint16_t getInputRevision() const { return NoInputRevision; }
+
     /** 
      * @brief   Read the physical state into the input buffers for all extended
      *          IO elements.
@@ -260,11 +305,52 @@ class ExtendedIOElement : public UpdatableCRTP<ExtendedIOElement> {
      */
     static DoublyLinkedList<ExtendedIOElement> &getAll();
 
+    /// @copydoc UpdatableCRTP::enable()
+    void enable() {
+        UpdatableCRTP<ExtendedIOElement>::enable();
+        invalidatePinIndex();
+    }
+    /// @copydoc UpdatableCRTP::disable()
+    void disable() {
+        UpdatableCRTP<ExtendedIOElement>::disable();
+        invalidatePinIndex();
+    }
+    using UpdatableCRTP<ExtendedIOElement>::enable;
+    using UpdatableCRTP<ExtendedIOElement>::disable;
+
+    /**
+     * @brief   Find the extended IO element that the given pin belongs to.
+     *
+     * Once @ref beginAll() has been called, this uses a binary search in an
+     * index of all enabled elements, sorted by pin number. The index is
+     * rebuilt automatically when elements are created, destroyed, enabled or
+     * disabled. Before that, the list of all elements is searched linearly.
+     *
+     * @return  A pointer to the element, or `nullptr` if no enabled element
+     *          contains the given pin.
+     */
+    static ExtendedIOElement *findElementOfPin(pin_t pin);
+
+  private:
+    /// Rebuild the index used by @ref findElementOfPin.
+    static void buildPinIndex();
+    /// Mark the index used by @ref findElementOfPin as outdated.
+    static void invalidatePinIndex() { pinIndexValid = false; }
+
   private:
     const pin_int_t length;
     const pin_t start;
     const pin_t end;
     static pin_t offset;
+
+    /// Pointers to all enabled elements, sorted by their start pin.
+    static std::unique_ptr<ExtendedIOElement *[]> pinIndex;
+    /// The number of elements in @ref pinIndex.
+    static uint16_t pinIndexSize;
+    /// Whether @ref pinIndex is used (set by @ref beginAll).
+    static bool pinIndexEnabled;
+    /// Whether @ref pinIndex is up to date.
+    static bool pinIndexValid;
 };
 
 namespace ExtIO {
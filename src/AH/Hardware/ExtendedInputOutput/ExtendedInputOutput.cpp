@@ -6,18 +6,8 @@ BEGIN_AH_NAMESPACE
 
 namespace ExtIO {
 
-template <class T>
-static bool inRange(T target, T start, T end) {
-    return target >= start && target < end;
-}
-
 ExtendedIOElement *getIOElementOfPinOrNull(pin_t pin) {
-    for (auto &el : ExtendedIOElement::getAll())
-        if (pin < el.getStart())
-            break;
-        else if (inRange(pin, el.getStart(), el.getEnd()))
-            return &el;
-    return nullptr;
+    return ExtendedIOElement::findElementOfPin(pin);
 }
 
 ExtendedIOElement *getIOElementOfPin(pin_t pin) {
@@ -87,6 +77,46 @@ void analogWrite(pin_t pin, analog_t val) {
 }
 void analogWrite(pin_t pin, int val) { analogWrite(pin, (analog_t)val); }
 
+/// Look up the element of the given pin, reusing the element of the previous
+/// pin if possible.
+static ExtendedIOElement *getIOElementOfPinCached(pin_t pin,
+                                                 ExtendedIOElement *&cache) {
+    if (cache == nullptr || pin < cache->getStart() || pin >= cache->getEnd())
+        cache = getIOElementOfPin(pin);
+    return cache;
+}
+
+void digitalReadMany(const pin_t *pins, PinStatus_t *values, size_t count) {
+    ExtendedIOElement *el = nullptr;
+    for (size_t i = 0; i < count; ++i) {
+        pin_t pin = pins[i];
+        if (pin == NO_PIN) {
+            values[i] = LOW;
+        } else if (isNativePin(pin)) {
+            values[i] = ::digitalRead(arduino_pin_cast(pin));
+        } else {
+            getIOElementOfPinCached(pin, el);
+            values[i] = el->digitalRead(pin - el->getStart());
+        }
+    }
+}
+
+void digitalWriteMany(const pin_t *pins, const PinStatus_t *values,
+                      size_t count) {
+    ExtendedIOElement *el = nullptr;
+    for (size_t i = 0; i < count; ++i) {
+        pin_t pin = pins[i];
+        if (pin == NO_PIN) {
+            continue;
+        } else if (isNativePin(pin)) {
+            ::digitalWrite(arduino_pin_cast(pin), values[i]);
+        } else {
+            getIOElementOfPinCached(pin, el);
+            el->digitalWrite(pin - el->getStart(), values[i]);
+        }
+    }
+}
+
 void pinModeBuffered(pin_t pin, PinMode_t mode) {
     if (pin == NO_PIN)
         return; // LCOV_EXCL_LINE
@@ -4,6 +4,7 @@
 
 #include <AH/Hardware/Arduino-Hardware-Types.hpp>
 #include <AH/STL/climits>
+#include <stddef.h> // size_t
 #include <AH/Settings/NamespaceSettings.hpp>
 
 BEGIN_AH_NAMESPACE
@@ -57,6 +58,26 @@ void analogWrite(pin_t pin, analog_t val);
 /// @see    ExtendedIOElement::analogWrite
 void analogWrite(pin_t pin, int val);
 
+/// Read multiple pins at once. Consecutive pins that belong to the same
+/// extended IO element only require a single lookup of that element.
+/// @param  pins
+///         The pins to read.
+/// @param  values
+///         Output array for the values of the pins.
+/// @param  count
+///         The number of pins to read.
+void digitalReadMany(const pin_t *pins, PinStatus_t *values, size_t count);
+/// Write multiple pins at once. Consecutive pins that belong to the same
+/// extended IO element only require a single lookup of that element.
+/// @param  pins
+///         The pins to write to.
+/// @param  values
+///         The values to write to the pins.
+/// @param  count
+///         The number of pins to write to.
+void digitalWriteMany(const pin_t *pins, const PinStatus_t *values,
+                      size_t count);
+
 /// An ExtIO version of the Arduino function
 void shiftOut(pin_t dataPin, pin_t clockPin, BitOrder_t bitOrder, uint8_t val);
 
@@ -9,6 +9,18 @@ BEGIN_AH_NAMESPACE
 /**
  * @brief   Class for MCP23017 I²C I/O expanders.
  * 
+ * If an interrupt pin is specified, the inputs are only read over I²C after
+ * the MCP23017 signaled a change on its interrupt pin. In that case, the
+ * interrupt flags, the captured interrupt values and the current state of the
+ * GPIO pins are read in a single transaction, which also clears the
+ * interrupt. Multiple MCP23017s can share a single interrupt line: the line is
+ * checked again before reading each expander, so once the expanders that
+ * flagged a change have been read, the line is released and the others are
+ * skipped.
+ * 
+ * The pins that changed during the last update of the inputs are available
+ * through @ref getChangedPins.
+ * 
  * @tparam  WireType 
  *          The type of the I²C driver to use.
  *
@@ -41,6 +53,7 @@ class MCP23017 : public StaticSizeExtendedIOElement<16> {
     void pinModeBuffered(pin_int_t pin, PinMode_t mode) override;
     void digitalWriteBuffered(pin_int_t pin, PinStatus_t status) override;
     PinStatus_t digitalReadBuffered(pin_int_t pin) override;
+    uint32_t digitalReadBufferedBits(pin_int_t pin, uint8_t count) override;
     analog_t analogReadBuffered(pin_int_t pin) override;
     void analogWriteBuffered(pin_int_t, analog_t) override;
 
@@ -50,6 +63,23 @@ class MCP23017 : public StaticSizeExtendedIOElement<16> {
     void updateBufferedInputs() override;
     /// Send the new pin modes to the chip after calling `pinModeBuffered`.
     void updateBufferedPinModes();
+    uint16_t getInputRevision() const override { return inputRevision; }
+
+    /**
+     * @brief   Get the pins whose input state changed during the last call to
+     *          @ref updateBufferedInputs.
+     * 
+     * In interrupt mode, this includes the pins whose change was flagged by
+     * the MCP23017, even if they returned to their previous state before they
+     * could be read (e.g. very short button presses).
+     * 
+     * @return  A bit mask where bit @f$ i @f$ is set if pin @f$ i @f$ changed.
+     *          Bits 0-7 correspond to register A, bits 8-15 to register B.
+     */
+    uint16_t getChangedPins() const { return changedPins; }
+    /// Check whether any of the inputs changed during the last call to
+    /// @ref updateBufferedInputs.
+    bool hasChangedPins() const { return changedPins != 0; }
 
     /// Get the identifier of the given pin in register A.
     /// @param  p
@@ -75,10 +105,29 @@ class MCP23017 : public StaticSizeExtendedIOElement<16> {
     bool outputsDirty = true;
     BitArray<16> bufferedOutputs;
     BitArray<16> bufferedInputs;
+    bool inputsStale = true;
+    uint16_t changedPins = 0;
+    uint16_t inputRevision = 0;
 
   private:
     /// Check if any of the pins are configured as inputs.
     bool hasInputs() const;
+    /// Store the newly read GPIO states, and keep track of the changes.
+    void setInputs(uint16_t inputs, uint16_t flagged);
+
+    /**
+     * @brief   Read consecutive registers of the MCP23017.
+     * 
+     * Uses a repeated start condition between selecting the register and
+     * reading it.
+     * 
+     * @param   addr
+     *          The address of the first register to read.
+     * @param   values
+     *          The buffer to read the register values into.
+     */
+    template <size_t N>
+    void readI2C(uint8_t addr, uint8_t (&values)[N]);
 
     /// Write any data to the MCP23017.
     template <size_t N>
@@ -67,6 +67,15 @@ PinStatus_t MCP23017<WireType>::digitalReadBuffered(pin_int_t pin) {
     return bufferedInputs.get(pin) ? HIGH : LOW;
 }
 
+template <class WireType>
+uint32_t MCP23017<WireType>::digitalReadBufferedBits(pin_int_t pin,
+                                                     uint8_t count) {
+    uint32_t bits = bufferedInputs.getByte(0) |
+                    uint32_t(bufferedInputs.getByte(1)) << 8;
+    bits >>= pin;
+    return count < 32 ? bits & ((uint32_t(1) << count) - 1) : bits;
+}
+
 template <class WireType>
 analog_t MCP23017<WireType>::analogReadBuffered(pin_int_t pin) {
     return bufferedInputs.get(pin) ? 1023 : 0;
@@ -83,13 +92,13 @@ void MCP23017<WireType>::begin() {
         ExtIO::pinMode(interruptPin, INPUT_PULLUP);
     // Set the IOCON register (configuration register)
     writeI2C(IOCON, //
-             0b01100100);
+             0b01000100);
     //         │││││││└─ Unimplemented
     //         ││││││└── INTPOL = Active-low
     //         │││││└─── ODR    = Open-drain output (overrides the INTPOL bit)
     //         ││││└──── HAEN   = Disables the MCP23S17 address pins
     //         │││└───── DISSLW = Slew rate enabled
-    //         ││└────── SEQOP  = Sequential operation disabled, address pointer does not increment
+    //         ││└────── SEQOP  = Sequential operation enabled, address pointer increments
     //         │└─────── MIRROR = The INT pins are internally connected
     //         └──────── BANK   = The registers are in the same bank (addresses are sequential)
 }
@@ -110,13 +119,38 @@ void MCP23017<WireType>::updateBufferedInputs() {
     // Only update if at least one pin is configured as input
     if (!hasInputs())
         return;
-    // Only update if a pin change interrupt happened
-    if (interruptPin != NO_PIN && ExtIO::digitalRead(interruptPin) == HIGH)
+    if (interruptPin == NO_PIN) {
+        uint8_t gpio[2];
+        readI2C(GPIOA, gpio);
+        setInputs(gpio[0] | uint16_t(gpio[1]) << 8, 0);
+        return;
+    }
+    // Only update if a pin change interrupt happened (or if the pin modes
+    // changed, in which case the buffered inputs may be out of date)
+    if (!inputsStale && ExtIO::digitalRead(interruptPin) == HIGH) {
+        changedPins = 0;
         return;
-    writeI2C(GPIOA);
-    wire->requestFrom(address, size_t(2));
-    bufferedInputs.setByte(0, wire->read());
-    bufferedInputs.setByte(1, wire->read());
+    }
+    // Read INTFA, INTFB, INTCAPA, INTCAPB, GPIOA, GPIOB at once. Reading the
+    // captured values or the GPIO registers clears the interrupt.
+    uint8_t regs[6];
+    readI2C(INTFA, regs);
+    setInputs(regs[4] | uint16_t(regs[5]) << 8,
+              regs[0] | uint16_t(regs[1]) << 8);
+    inputsStale = false;
+}
+
+template <class WireType>
+void MCP23017<WireType>::setInputs(uint16_t inputs, uint16_t flagged) {
+    uint16_t previous = bufferedInputs.getByte(0) |
+                        uint16_t(bufferedInputs.getByte(1)) << 8;
+    changedPins = (previous ^ inputs) | flagged;
+    if (changedPins == 0)
+        return;
+    bufferedInputs.setByte(0, inputs & 0xFF);
+    bufferedInputs.setByte(1, inputs >> 8);
+    if (++inputRevision == NoInputRevision)
+        inputRevision = 0;
 }
 
 template <class WireType>
@@ -129,12 +163,14 @@ void MCP23017<WireType>::updateBufferedPinModes() {
                  bufferedPinModes.getByte(0), //
                  bufferedPinModes.getByte(1));
         pinModesDirty = false;
+        inputsStale = true;
     }
     if (pullupsDirty) {
         writeI2C(GPPUA,                      //
                  bufferedPullups.getByte(0), //
                  bufferedPullups.getByte(1));
         pullupsDirty = false;
+        inputsStale = true;
     }
 }
 
@@ -158,4 +194,15 @@ void MCP23017<WireType>::writeI2C(uint8_t addr, Args... values) {
     writeI2C(v);
 }
 
+template <class WireType>
+template <size_t N>
+void MCP23017<WireType>::readI2C(uint8_t addr, uint8_t (&values)[N]) {
+    this->wire->beginTransmission(address);
+    this->wire->write(addr);
+    this->wire->endTransmission(false);
+    this->wire->requestFrom(address, size_t(N));
+    for (uint8_t &value : values)
+        value = this->wire->read();
+}
+
 END_AH_NAMESPACE
@@ -0,0 +1,45 @@
+#include "SPIShiftRegisterOut.hpp"
+
+BEGIN_AH_NAMESPACE
+
+void SPIShiftRegisterOutChainLink::chainLink(
+    SPIShiftRegisterOutChainLink &other) {
+    // Already in the same chain
+    for (auto *link = next; link != this; link = link->next)
+        if (link == &other)
+            return;
+    // Swapping the successors of two nodes of different circular lists
+    // merges them into a single circular list
+    auto *tmp = next;
+    next = other.next;
+    other.next = tmp;
+}
+
+void SPIShiftRegisterOutChainLink::unchain() {
+    auto *prev = next;
+    while (prev->next != this)
+        prev = prev->next;
+    prev->next = next;
+    next = this;
+}
+
+bool SPIShiftRegisterOutChainLink::isChainDirty() const {
+    const auto *link = this;
+    do {
+        if (link->isDirty())
+            return true;
+        link = link->next;
+    } while (link != this);
+    return false;
+}
+
+void SPIShiftRegisterOutChainLink::writeChainToBus() {
+    auto *link = this;
+    do {
+        if (link->isDirty())
+            link->writeToBus();
+        link = link->next;
+    } while (link != this);
+}
+
+END_AH_NAMESPACE
@@ -11,9 +11,58 @@ AH_DIAGNOSTIC_POP()
 
 BEGIN_AH_NAMESPACE
 
+/**
+ * @brief   Base class for SPI shift registers that can share a single SPI
+ *          transaction with other shift registers on the same bus.
+ *
+ * The chained registers form a circular linked list. When any of them is
+ * updated, all registers in the chain with new data are written to the bus in
+ * one transaction.
+ *
+ * @see     SPIShiftRegisterOut::chain
+ *
+ * @ingroup AH_ExtIO
+ */
+class SPIShiftRegisterOutChainLink {
+  protected:
+    SPIShiftRegisterOutChainLink() = default;
+    /// Copying not allowed.
+    SPIShiftRegisterOutChainLink(const SPIShiftRegisterOutChainLink &) =
+        delete;
+    /// Copying not allowed.
+    SPIShiftRegisterOutChainLink &
+    operator=(const SPIShiftRegisterOutChainLink &) = delete;
+    /// Remove this register from its chain.
+    ~SPIShiftRegisterOutChainLink() { unchain(); }
+
+    /// Merge the chain of the given register with the chain of this one.
+    void chainLink(SPIShiftRegisterOutChainLink &other);
+    /// Remove this register from its chain.
+    void unchain();
+
+    /// Check if any of the registers in the chain have new data.
+    bool isChainDirty() const;
+    /// Write the buffers of all registers in the chain that have new data,
+    /// the SPI transaction should already have been started.
+    void writeChainToBus();
+
+    /// Check if this register has new data.
+    virtual bool isDirty() const = 0;
+    /// Latch the buffer of this register to its outputs.
+    virtual void writeToBus() = 0;
+
+  private:
+    SPIShiftRegisterOutChainLink *next = this;
+};
+
 /**
  * @brief   A class for serial-in/parallel-out shift registers, 
  *          like the 74HC595 that are connected to the SPI bus.
+ *
+ * The entire buffer is written using a single bulk `transfer(buffer, length)`
+ * call. The SPI driver can implement this using DMA.  
+ * Multiple shift registers on the same bus (with separate latch pins) can be
+ * combined into a single SPI transaction using @ref chain.
  * 
  * @tparam  N
  *          The number of bits in total. Usually, shift registers (e.g. the
@@ -25,7 +74,8 @@ BEGIN_AH_NAMESPACE
  * @ingroup AH_ExtIO
  */
 template <uint16_t N, class SPIDriver = decltype(SPI) &>
-class SPIShiftRegisterOut : public ShiftRegisterOutBase<N> {
+class SPIShiftRegisterOut : public ShiftRegisterOutBase<N>,
+                            public SPIShiftRegisterOutChainLink {
   public:
     /**
      * @brief   Create a new SPIShiftRegisterOut object with a given bit order,
@@ -65,11 +115,39 @@ class SPIShiftRegisterOut : public ShiftRegisterOutBase<N> {
 
     /**
      * @brief   Write the state buffer to the physical outputs.
+     *
+     * If this register is chained to other registers, the buffers of all
+     * chained registers with new data are written in the same transaction.
      */
     void updateBufferedOutputs() override;
 
+    /**
+     * @brief   Share the SPI transaction with the given shift register.
+     *
+     * Both registers must be connected to the same SPI bus, and use the same
+     * bit order. Each register keeps its own latch pin. Updating any of the
+     * chained registers updates all of them.
+     *
+     * @param   other
+     *          The shift register (of any length) to add to the chain of this
+     *          register.
+     */
+    void chain(SPIShiftRegisterOutChainLink &other) { chainLink(other); }
+
+  protected:
+    bool isDirty() const override { return this->dirty && initialized; }
+    void writeToBus() override;
+
   private:
     SPIDriver spi;
+    /// The latch pin, resolved to its extended IO element in @ref begin.
+    ExtIO::CachedExtIOPin latch {NO_PIN};
+    /// Whether @ref begin was called. Chained registers are not written
+    /// before they are initialized.
+    bool initialized = false;
+    /// The bytes in the order they are sent. The buffer is overwritten by
+    /// the data received during the transfer.
+    uint8_t txBuffer[(N + 7) / 8];
 
   public:
     SPISettings settings{SPI_MAX_SPEED, this->bitOrder, SPI_MODE0};
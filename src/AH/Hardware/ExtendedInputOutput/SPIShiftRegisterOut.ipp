@@ -1,5 +1,3 @@
-#ifdef ARDUINO // TODO: I'm too lazy to mock the SPI library
-
 #include "ExtendedInputOutput.hpp"
 #include "SPIShiftRegisterOut.hpp"
 
@@ -18,29 +16,37 @@ SPIShiftRegisterOut<N, SPIDriver>::SPIShiftRegisterOut(SPIDriver spi,
 
 template <uint16_t N, class SPIDriver>
 void SPIShiftRegisterOut<N, SPIDriver>::begin() {
-    ExtIO::pinMode(this->latchPin, OUTPUT);
+    // Look up the latch pin only once, instead of on every update
+    latch = ExtIO::CachedExtIOPin(this->latchPin);
+    ExtIO::pinMode(latch, OUTPUT);
     spi.begin();
+    initialized = true;
     updateBufferedOutputs();
 }
 
 template <uint16_t N, class SPIDriver>
 void SPIShiftRegisterOut<N, SPIDriver>::updateBufferedOutputs() {
-    if (!this->dirty)
+    if (!isChainDirty())
         return;
     spi.beginTransaction(settings);
-    ExtIO::digitalWrite(this->latchPin, LOW);
+    writeChainToBus();
+    spi.endTransaction();
+}
+
+template <uint16_t N, class SPIDriver>
+void SPIShiftRegisterOut<N, SPIDriver>::writeToBus() {
     const uint16_t bufferLength = this->buffer.getBufferLength();
+    // The last byte is shifted out first for MSBFIRST
     if (this->bitOrder == LSBFIRST)
         for (uint16_t i = 0; i < bufferLength; i++)
-            spi.transfer(this->buffer.getByte(i));
+            txBuffer[i] = this->buffer.getByte(i);
     else
-        for (uint16_t i = bufferLength; i-->0;)
-            spi.transfer(this->buffer.getByte(i));
-    ExtIO::digitalWrite(this->latchPin, HIGH);
-    spi.endTransaction();
+        for (uint16_t i = 0; i < bufferLength; i++)
+            txBuffer[i] = this->buffer.getByte(bufferLength - 1 - i);
+    ExtIO::digitalWrite(latch, LOW);
+    spi.transfer(txBuffer, bufferLength);
+    ExtIO::digitalWrite(latch, HIGH);
     this->dirty = false;
 }
 
 END_AH_NAMESPACE
-
-#endif
\ No newline at end of file
@@ -0,0 +1,388 @@
+#pragma once
+
+#include <AH/Containers/Array.hpp>
+#include <AH/Hardware/FilteredAnalog.hpp>
+#include <AH/STL/climits> // CHAR_BIT
+#include <AH/STL/type_traits>
+
+// The NEON implementation hasn't been compiled or tested on ARM64 yet, so it's
+// disabled by default. Define AH_FILTERED_ANALOG_BANK_NEON to enable it.
+#if defined(__ARM_NEON) && defined(__aarch64__) &&                             \
+    defined(AH_FILTERED_ANALOG_BANK_NEON)
+#define AH_FILTERED_ANALOG_BANK_USE_NEON
+#endif
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(AH_FILTERED_ANALOG_BANK_USE_NEON)
+#include <arm_neon.h>
+#endif
+
+BEGIN_AH_NAMESPACE
+
+namespace detail {
+
+/// Apply the EMA filter of @ref EMA::filter to as many of the @p n inputs as
+/// possible using SIMD instructions, eight at a time. The inputs are replaced
+/// by the filtered values.
+/// @return The number of inputs that were filtered.
+template <uint8_t K>
+uint16_t filterEMA_SIMD(uint16_t *states, uint16_t *inputs, uint16_t n) {
+    uint16_t i = 0;
+#if defined(__SSE2__)
+    const __m128i half = _mm_set1_epi16(K > 0 ? int16_t(1 << (K - 1)) : 0);
+    for (; i + 8 <= n; i += 8) {
+        auto *s_ptr = reinterpret_cast<__m128i *>(states + i);
+        auto *x_ptr = reinterpret_cast<__m128i *>(inputs + i);
+        __m128i s = _mm_add_epi16(_mm_loadu_si128(s_ptr),
+                                  _mm_loadu_si128(x_ptr));
+        __m128i y = _mm_srli_epi16(_mm_add_epi16(s, half), K);
+        _mm_storeu_si128(s_ptr, _mm_sub_epi16(s, y));
+        _mm_storeu_si128(x_ptr, y);
+    }
+#elif defined(AH_FILTERED_ANALOG_BANK_USE_NEON)
+    const uint16x8_t half = vdupq_n_u16(K > 0 ? uint16_t(1 << (K - 1)) : 0);
+    const int16x8_t shift = vdupq_n_s16(-int16_t(K));
+    for (; i + 8 <= n; i += 8) {
+        uint16x8_t s = vaddq_u16(vld1q_u16(states + i), vld1q_u16(inputs + i));
+        uint16x8_t y = vshlq_u16(vaddq_u16(s, half), shift);
+        vst1q_u16(states + i, vsubq_u16(s, y));
+        vst1q_u16(inputs + i, y);
+    }
+#else
+    (void)states, (void)inputs, (void)n;
+#endif
+    return i;
+}
+
+/// Only 16-bit types are supported by the SIMD implementation.
+template <uint8_t K, class FilterType, class AnalogType>
+uint16_t filterEMA_SIMD(FilterType *, AnalogType *, uint16_t) {
+    return 0;
+}
+
+/// Apply the hysteresis of @ref Hysteresis::update to as many of the @p n
+/// inputs as possible using SIMD instructions, eight at a time. The bits of
+/// the inputs whose level changed are set in @p changed.
+/// @return The number of inputs that were handled.
+template <uint8_t Bits, class word_t>
+uint16_t applyHysteresisSIMD(uint16_t *levels, const uint16_t *inputs,
+                             uint16_t n, word_t *changed) {
+    // The bounds are calculated using saturating arithmetic, which results
+    // in 0 and 0xFFFF for the lowest and highest levels, like Hysteresis.
+    // Eight inputs never straddle two words of the changed mask.
+    constexpr uint8_t WordBits = sizeof(word_t) * CHAR_BIT;
+    static_assert(WordBits % 8 == 0, "Invalid word size");
+    constexpr uint16_t margin = (1u << Bits) - 1u;
+    constexpr uint16_t offset = Bits >= 1 ? 1u << (Bits - 1) : 0;
+    uint16_t i = 0;
+#if defined(__SSE2__)
+    const __m128i marginv = _mm_set1_epi16(static_cast<int16_t>(margin));
+    const __m128i offsetv = _mm_set1_epi16(static_cast<int16_t>(offset));
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 8 <= n; i += 8) {
+        auto *l_ptr = reinterpret_cast<__m128i *>(levels + i);
+        auto *x_ptr = reinterpret_cast<const __m128i *>(inputs + i);
+        __m128i level = _mm_loadu_si128(l_ptr);
+        __m128i x = _mm_loadu_si128(x_ptr);
+        __m128i full = _mm_or_si128(_mm_slli_epi16(level, Bits), offsetv);
+        __m128i lower = _mm_subs_epu16(full, marginv);
+        __m128i upper = _mm_adds_epu16(full, marginv);
+        // Nonzero if the input is outside of the bounds
+        __m128i outside = _mm_or_si128(_mm_subs_epu16(lower, x),
+                                       _mm_subs_epu16(x, upper));
+        __m128i same = _mm_cmpeq_epi16(outside, zero);
+        __m128i newlevel = _mm_srli_epi16(x, Bits);
+        level = _mm_or_si128(_mm_and_si128(same, level),
+                             _mm_andnot_si128(same, newlevel));
+        _mm_storeu_si128(l_ptr, level);
+        auto mask = ~_mm_movemask_epi8(_mm_packs_epi16(same, zero)) & 0xFF;
+        changed[i / WordBits] |= word_t(mask) << (i % WordBits);
+    }
+#elif defined(AH_FILTERED_ANALOG_BANK_USE_NEON)
+    const uint16x8_t marginv = vdupq_n_u16(margin);
+    const uint16x8_t offsetv = vdupq_n_u16(offset);
+    const int16x8_t shl = vdupq_n_s16(Bits);
+    const int16x8_t shr = vdupq_n_s16(-int16_t(Bits));
+    const uint16_t bits[8] = {1, 2, 4, 8, 16, 32, 64, 128};
+    const uint16x8_t bitsv = vld1q_u16(bits);
+    for (; i + 8 <= n; i += 8) {
+        uint16x8_t level = vld1q_u16(levels + i);
+        uint16x8_t x = vld1q_u16(inputs + i);
+        uint16x8_t full = vorrq_u16(vshlq_u16(level, shl), offsetv);
+        uint16x8_t lower = vqsubq_u16(full, marginv);
+        uint16x8_t upper = vqaddq_u16(full, marginv);
+        uint16x8_t outside =
+            vorrq_u16(vcltq_u16(x, lower), vcgtq_u16(x, upper));
+        level = vbslq_u16(outside, vshlq_u16(x, shr), level);
+        vst1q_u16(levels + i, level);
+        auto mask = vaddvq_u16(vandq_u16(outside, bitsv));
+        changed[i / WordBits] |= word_t(mask) << (i % WordBits);
+    }
+#else
+    (void)levels, (void)inputs, (void)n, (void)changed;
+#endif
+    return i;
+}
+
+/// Only 16-bit types are supported by the SIMD implementation.
+template <uint8_t Bits, class AnalogType, class word_t>
+uint16_t applyHysteresisSIMD(AnalogType *, const AnalogType *, uint16_t,
+                             word_t *) {
+    return 0;
+}
+
+} // namespace detail
+
+/**
+ * @brief   A class that reads and filters many analog inputs at once.
+ *
+ * The result is the same as using a @ref FilteredAnalog for each input: an
+ * exponential moving average filter, an optional mapping function, and
+ * hysteresis are applied to every input. However, instead of storing the state
+ * of each filter in a separate object, the filter states and the hysteresis
+ * levels of all inputs are stored in contiguous arrays (structure-of-arrays
+ * layout), and each step is applied to all inputs in a single pass.
+ * On x86 (SSE2), eight inputs are filtered at once using SIMD instructions,
+ * other platforms use a scalar loop. An experimental ARM64 (NEON)
+ * implementation can be enabled by defining `AH_FILTERED_ANALOG_BANK_NEON`.
+ *
+ * After each update, a bit mask tells which of the inputs changed, so only
+ * those have to be handled (e.g. send a MIDI message).
+ *
+ * @tparam  N
+ *          The number of analog inputs.
+ * @tparam  Precision
+ *          The number of bits of precision the output should have.
+ * @tparam  FilterShiftFactor
+ *          The number of bits used for the EMA filter.
+ *          See @ref FilteredAnalog.
+ * @tparam  FilterType
+ *          The type to use for the intermediate types of the filter.
+ * @tparam  AnalogType
+ *          The type to use for the analog values.
+ * @tparam  IncRes
+ *          The number of bits to increase the resolution of the analog reading
+ *          by.
+ *
+ * @note    The SIMD implementation is only used if both @p FilterType and
+ *          @p AnalogType are `uint16_t` (the default).
+ *
+ * @ingroup AH_HardwareUtils
+ */
+template <uint16_t N, uint8_t Precision = 10,
+          uint8_t FilterShiftFactor = ANALOG_FILTER_SHIFT_FACTOR,
+          class FilterType = ANALOG_FILTER_TYPE, class AnalogType = analog_t,
+          uint8_t IncRes = MaximumFilteredAnalogIncRes<
+              FilterShiftFactor, FilterType, AnalogType>::value>
+class FilteredAnalogBank {
+  public:
+    /// The type of the bit masks of changed inputs.
+    using word_t = uint_fast32_t;
+    /// The number of inputs in one word.
+    constexpr static uint8_t WordBits = sizeof(word_t) * CHAR_BIT;
+    /// The number of words required to store the changes of all inputs.
+    constexpr static uint16_t NumWords = (N + WordBits - 1) / WordBits;
+
+    /// A function pointer to a mapping function to map analog values.
+    /// @see    map()
+    using MappingFunction = AnalogType (*)(AnalogType);
+
+    /**
+     * @brief   Create a new FilteredAnalogBank.
+     *
+     * @param   analogPins
+     *          The analog pins to read from.
+     * @param   initial
+     *          The initial value of the filters.
+     */
+    FilteredAnalogBank(const Array<pin_t, N> &analogPins,
+                       AnalogType initial = 0)
+        : analogPins(analogPins) {
+        reset(initial);
+    }
+
+    /// Reset the filters of all inputs to the given value.
+    void reset(AnalogType value = 0) {
+        AnalogType widevalue = increaseBitDepth<ADC_BITS + IncRes, Precision,
+                                                AnalogType, AnalogType>(value);
+        for (uint16_t i = 0; i < N; ++i)
+            resetInput(i, widevalue);
+    }
+
+    /// Reset the filters to the values that are currently being measured at
+    /// the analog inputs.
+    void resetToCurrentValue() {
+        for (uint16_t i = 0; i < N; ++i)
+            resetInput(i, getRawValue(i));
+    }
+
+    /**
+     * @brief   Specify a mapping function that is applied to the analog values
+     *          of all inputs after filtering and before applying hysteresis.
+     *
+     * @see     GenericFilteredAnalog::map
+     */
+    void map(MappingFunction fn) { mapFn = fn; }
+
+    /// Invert the analog values of all inputs.
+    /// @note   This overrides the mapping function set by the `map` method.
+    void invert() {
+        constexpr AnalogType maxval = getMaxRawValue();
+        map([](AnalogType val) -> AnalogType { return maxval - val; });
+    }
+
+    /**
+     * @brief   Read all analog inputs, and filter them.
+     *
+     * @return  True if the value of any of the inputs changed, false
+     *          otherwise.
+     */
+    bool update() {
+        for (uint16_t i = 0; i < N; ++i)
+            values[i] = getRawValue(i);
+        return filterValues();
+    }
+
+    /**
+     * @brief   Filter the given raw values, instead of reading the analog
+     *          inputs.
+     *
+     * @param   rawValues
+     *          The raw value of each input, with the bit depth already
+     *          increased by @p IncRes, see @ref getRawValue.
+     *
+     * @return  True if the value of any of the inputs changed, false
+     *          otherwise.
+     */
+    bool update(const AnalogType (&rawValues)[N]) {
+        for (uint16_t i = 0; i < N; ++i)
+            values[i] = rawValues[i];
+        return filterValues();
+    }
+
+    /// Get the filtered value of the given input, as a number of `Precision`
+    /// bits wide.
+    AnalogType getValue(uint16_t index) const { return levels[index]; }
+
+    /// Get the filtered value of the given input as a floating point number
+    /// from 0.0 to 1.0.
+    float getFloatValue(uint16_t index) const {
+        return getValue(index) * (1.0f / (ldexpf(1.0f, Precision) - 1.0f));
+    }
+
+    /// The inputs @f$ w \cdot WordBits @f$ through
+    /// @f$ (w + 1) \cdot WordBits - 1 @f$ that changed during the last update.
+    word_t getChanged(uint16_t w) const { return changed[w]; }
+    /// Check whether the given input changed during the last update.
+    bool hasChanged(uint16_t index) const {
+        return changed[index / WordBits] & (word_t(1) << (index % WordBits));
+    }
+
+    /// Read the raw value of the given analog input without any filtering or
+    /// mapping applied, but with its bit depth increased by @c IncRes.
+    AnalogType getRawValue(uint16_t index) const {
+        AnalogType value = ExtIO::analogRead(analogPins[index]);
+#ifdef ESP8266
+        if (value > 1023)
+            value = 1023;
+#endif
+        return increaseBitDepth<ADC_BITS + IncRes, ADC_BITS, AnalogType>(value);
+    }
+
+    /// Get the maximum value that can be returned from @ref getRawValue.
+    constexpr static AnalogType getMaxRawValue() {
+        return (1ul << (ADC_BITS + IncRes)) - 1ul;
+    }
+
+    /// Get the number of inputs.
+    constexpr static uint16_t length() { return N; }
+
+  private:
+    /// Reset the filter of the given input to the given raw value.
+    void resetInput(uint16_t index, AnalogType widevalue) {
+        FilterType value_s = static_cast<FilterType>(widevalue);
+        states[index] = (value_s << FilterShiftFactor) - value_s;
+        levels[index] = widevalue >> HystBits;
+    }
+
+    /// Filter the raw values in @ref values.
+    bool filterValues() {
+        // Low-pass EMA filter
+        uint16_t i = detail::filterEMA_SIMD<FilterShiftFactor>(states, values,
+                                                               N);
+        for (; i < N; ++i)
+            values[i] = filterEMA(states[i], values[i]);
+        // Mapping function
+        if (mapFn != nullptr)
+            for (i = 0; i < N; ++i)
+                values[i] = mapFn(values[i]);
+        // Hysteresis
+        for (word_t &c : changed)
+            c = 0;
+        i = detail::applyHysteresisSIMD<HystBits>(levels, values, N, changed);
+        for (; i < N; ++i)
+            if (applyHysteresis(levels[i], values[i]))
+                changed[i / WordBits] |= word_t(1) << (i % WordBits);
+        word_t any = 0;
+        for (word_t c : changed)
+            any |= c;
+        return any != 0;
+    }
+
+    /// Apply the EMA filter to the given input, see @ref EMA::filter.
+    static AnalogType filterEMA(FilterType &state, AnalogType input) {
+        state += static_cast<FilterType>(input);
+        FilterType output = (state + EMAHalf) >> FilterShiftFactor;
+        state -= output;
+        return static_cast<AnalogType>(output);
+    }
+
+    /// Apply hysteresis to the given input, see @ref Hysteresis::update.
+    static bool applyHysteresis(AnalogType &level, AnalogType input) {
+        constexpr AnalogType max_in = static_cast<AnalogType>(-1);
+        constexpr AnalogType max_out = max_in >> HystBits;
+        AnalogType levelFull = AnalogType(level << HystBits) | HystOffset;
+        AnalogType lower = level > 0 ? levelFull - HystMargin : 0;
+        AnalogType upper = level < max_out ? levelFull + HystMargin : max_in;
+        if (input < lower || input > upper) {
+            level = input >> HystBits;
+            return true;
+        }
+        return false;
+    }
+
+  private:
+    /// The number of bits removed by the hysteresis.
+    constexpr static uint8_t HystBits = ADC_BITS + IncRes - Precision;
+    constexpr static AnalogType HystMargin = (1ul << HystBits) - 1ul;
+    constexpr static AnalogType HystOffset =
+        HystBits >= 1 ? 1ul << (HystBits - 1) : 0;
+    constexpr static FilterType EMAHalf =
+        FilterShiftFactor > 0 ? FilterType(1) << (FilterShiftFactor - 1) : 0;
+
+    static_assert(std::is_unsigned<AnalogType>::value &&
+                      std::is_unsigned<FilterType>::value,
+                  "Error: only unsigned types are supported");
+    static_assert(
+        ADC_BITS + IncRes + FilterShiftFactor <= sizeof(FilterType) * CHAR_BIT,
+        "Error: FilterType is not wide enough to hold the maximum value");
+    static_assert(
+        ADC_BITS + IncRes <= sizeof(AnalogType) * CHAR_BIT,
+        "Error: AnalogType is not wide enough to hold the maximum value");
+    static_assert(
+        Precision <= ADC_BITS + IncRes,
+        "Error: Precision is larger than the increased ADC precision");
+
+    Array<pin_t, N> analogPins;
+    MappingFunction mapFn = nullptr;
+    /// The states of the EMA filters.
+    FilterType states[N];
+    /// The output levels of the hysteresis.
+    AnalogType levels[N];
+    /// The raw and filtered input values of the current update.
+    AnalogType values[N];
+    word_t changed[NumWords] = {};
+};
+
+END_AH_NAMESPACE
@@ -89,6 +89,13 @@ constexpr unsigned long LONG_PRESS_REPEAT_DELAY = 200; // milliseconds
 /// The interval between updating filtered analog inputs, in microseconds.
 constexpr unsigned long FILTERED_INPUT_UPDATE_INTERVAL = 1000; // microseconds
 
+/// The default update intervals of the @ref UpdateRate::Fast,
+/// @ref UpdateRate::Medium and @ref UpdateRate::Slow rate classes of
+/// @ref Updatable, in microseconds.
+constexpr unsigned long UPDATE_INTERVAL_FAST = 1000;    // microseconds
+constexpr unsigned long UPDATE_INTERVAL_MEDIUM = 5000;  // microseconds
+constexpr unsigned long UPDATE_INTERVAL_SLOW = 33333;   // microseconds
+
 constexpr static Frequency SPI_MAX_SPEED = 8_MHz;
 
 // ========================================================================== //
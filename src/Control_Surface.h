@@ -34,6 +34,7 @@
 #include <MIDI_Outputs/CCIncrementDecrementButtons.hpp>
 
 #include <MIDI_Outputs/CCPotentiometer.hpp>
+#include <MIDI_Outputs/CCPotentiometers.hpp>
 
 #include <MIDI_Outputs/NoteButton.hpp>
 #include <MIDI_Outputs/NoteButtonLatched.hpp>
@@ -131,6 +132,9 @@
 #include <MIDI_Interfaces/BluetoothMIDI_Interface.hpp>
 #endif
 #include <MIDI_Interfaces/MIDI_Callbacks.hpp>
+#include <MIDI_Interfaces/CoalescingMIDI_Pipe.hpp>
+#include <MIDI_Interfaces/MIDI_Pipeline.hpp>
+#include <MIDI_Parsers/SysExReassembler.hpp>
 
 // ------------------------- Extended Input Output -------------------------- //
 #include <AH/Hardware/ExtendedInputOutput/AnalogMultiplex.hpp>
@@ -39,6 +39,12 @@ void Control_Surface_::begin() {
     MIDIInputElementCP::beginAll();
     MIDIInputElementPB::beginAll();
     MIDIInputElementSysEx::beginAll();
+    MIDIInputElementNote::rebuildDispatchIndex();
+    MIDIInputElementKP::rebuildDispatchIndex();
+    MIDIInputElementCC::rebuildDispatchIndex();
+    MIDIInputElementPC::rebuildDispatchIndex();
+    MIDIInputElementCP::rebuildDispatchIndex();
+    MIDIInputElementPB::rebuildDispatchIndex();
     Updatable<>::beginAll();
     Updatable<Display>::beginAll();
     displayTimer.begin();
@@ -69,13 +75,26 @@ void Control_Surface_::disconnectMIDI_Interfaces() {
 }
 
 void Control_Surface_::loop() {
+    if (profiler)
+        profiler->beginLoop();
+    beginPhase(LoopPhase::BufferedInputs);
     ExtendedIOElement::updateAllBufferedInputs();
+    beginPhase(LoopPhase::Updatables);
     Updatable<>::updateAll();
+    beginPhase(LoopPhase::MIDIInput);
     updateMidiInput();
+    beginPhase(LoopPhase::Inputs);
     updateInputs();
-    if (displayTimer)
+    if (displayTimer) {
+        beginPhase(LoopPhase::Displays);
         updateDisplays();
+    }
+    beginPhase(LoopPhase::BufferedOutputs);
     ExtendedIOElement::updateAllBufferedOutputs();
+    beginPhase(LoopPhase::MIDIOutput);
+    MIDI_Interface::flushAllLoopBatches();
+    if (profiler)
+        profiler->endLoop();
 }
 
 void Control_Surface_::updateMidiInput() {
@@ -111,37 +130,46 @@ void Control_Surface_::updateMidiInput() {
 
 #if !DISABLE_PIPES
 void Control_Surface_::sendChannelMessageImpl(ChannelMessage msg) {
+    countMessage();
     this->sourceMIDItoPipe(msg);
 }
 void Control_Surface_::sendSysExImpl(SysExMessage msg) {
+    countMessage();
     this->sourceMIDItoPipe(msg);
 }
 void Control_Surface_::sendSysCommonImpl(SysCommonMessage msg) {
+    countMessage();
     this->sourceMIDItoPipe(msg);
 }
 void Control_Surface_::sendRealTimeImpl(RealTimeMessage msg) {
+    countMessage();
     this->sourceMIDItoPipe(msg);
 }
 #else
 void Control_Surface_::sendChannelMessageImpl(ChannelMessage msg) {
+    countMessage();
     if (auto def = MIDI_Interface::getDefault())
         def->send(msg);
 }
 void Control_Surface_::sendSysExImpl(SysExMessage msg) {
+    countMessage();
     if (auto def = MIDI_Interface::getDefault())
         def->send(msg);
 }
 void Control_Surface_::sendSysCommonImpl(SysCommonMessage msg) {
+    countMessage();
     if (auto def = MIDI_Interface::getDefault())
         def->send(msg);
 }
 void Control_Surface_::sendRealTimeImpl(RealTimeMessage msg) {
+    countMessage();
     if (auto def = MIDI_Interface::getDefault())
         def->send(msg);
 }
 #endif
 
 void Control_Surface_::sinkMIDIfromPipe(ChannelMessage midimsg) {
+    countMessage();
 #ifdef DEBUG_MIDI_PACKETS
     if (midimsg.hasTwoDataBytes())
         DEBUG(">>> " << hex << midimsg.header << ' ' << midimsg.data1 << ' '
@@ -229,6 +257,7 @@ void Control_Surface_::sinkMIDIfromPipe(ChannelMessage midimsg) {
 }
 
 void Control_Surface_::sinkMIDIfromPipe(SysExMessage msg) {
+    countMessage();
 #ifdef DEBUG_MIDI_PACKETS
     const uint8_t *data = msg.data;
     size_t len = msg.length;
@@ -245,6 +274,7 @@ void Control_Surface_::sinkMIDIfromPipe(SysExMessage msg) {
 }
 
 void Control_Surface_::sinkMIDIfromPipe(SysCommonMessage msg) {
+    countMessage();
 #ifdef DEBUG_MIDI_PACKETS
     DEBUG_OUT << ">>> " << hex << msg.getMessageType() << ' ' << msg.getData1()
               << ' ' << msg.getData2() << " (" << msg.cable << ')' << dec
@@ -257,6 +287,7 @@ void Control_Surface_::sinkMIDIfromPipe(SysCommonMessage msg) {
 }
 
 void Control_Surface_::sinkMIDIfromPipe(RealTimeMessage rtMessage) {
+    countMessage();
 #ifdef DEBUG_MIDI_PACKETS
     DEBUG(">>> " << hex << rtMessage.message << " ("
                  << rtMessage.cable.getOneBased() << ')' << dec);
@@ -308,15 +339,44 @@ void Control_Surface_::updateDisplays() {
     auto prevIt = it;
     auto previousDisplay = &prevIt->getDisplay();
     bool dirty = false;
+    // Whether all dirty elements reported their bounds, so only the damaged
+    // area has to be redrawn
+    bool partial = true;
+    PixelArea damaged = {0, 0, 0, 0};
     // Loop over all display elements
     while (true) {
-        dirty |= it->getDirty();
+        if (it->getDirty()) {
+            dirty = true;
+            PixelArea bounds;
+            if (partial && it->getBounds(bounds))
+                damaged = damaged.merge(bounds);
+            else
+                partial = false;
+        }
         ++it;
         // If this is the first element on another display
         if (it == end || &it->getDisplay() != previousDisplay) {
+            // Skip this display if the previous frame is still being written
+            // in the background, its elements remain dirty
+            if (dirty && previousDisplay->isBusy())
+                dirty = false;
             // If there was at least one element on the previous display that
             // has to be redrawn
-            if (dirty) {
+            if (dirty && partial) {
+                // Clear the damaged area only
+                previousDisplay->clearAndDrawBackground(damaged.x, damaged.y,
+                                                        damaged.w, damaged.h);
+                // Update all elements that overlap with the damaged area
+                for (auto drawIt = prevIt; drawIt != it; ++drawIt) {
+                    PixelArea bounds;
+                    if (!drawIt->getBounds(bounds) ||
+                        bounds.intersects(damaged))
+                        drawIt->draw();
+                }
+                // Write the damaged area of the buffer to the display
+                previousDisplay->display(damaged.x, damaged.y, damaged.w,
+                                         damaged.h);
+            } else if (dirty) {
                 // Clear the display
                 previousDisplay->clearAndDrawBackground();
                 // Update all elements on that display
@@ -330,6 +390,8 @@ void Control_Surface_::updateDisplays() {
             prevIt = it;
             previousDisplay = &it->getDisplay();
             dirty = false;
+            partial = true;
+            damaged = {0, 0, 0, 0};
         }
     }
 }
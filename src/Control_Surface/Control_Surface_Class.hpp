@@ -5,6 +5,7 @@
 #include <AH/Containers/Updatable.hpp>
 #include <AH/Hardware/FilteredAnalog.hpp>
 #include <AH/Timing/MillisMicrosTimer.hpp>
+#include <Control_Surface/LoopProfiler.hpp>
 #include <Display/DisplayElement.hpp>
 #include <Display/DisplayInterface.hpp>
 #include <MIDI_Interfaces/MIDI_Interface.hpp>
@@ -69,7 +70,9 @@ class Control_Surface_ : public MIDI_Sender<Control_Surface_>,
     /// Initialize all displays that have at least one display element.
     void beginDisplays();
     /// Clear, draw and display all displays that contain display elements that
-    /// have changed.
+    /// have changed. If all changed elements of a display report their bounds
+    /// (see @ref DisplayElement::getBounds), only the damaged area of that
+    /// display is updated.
     void updateDisplays();
 
   private:
@@ -103,6 +106,35 @@ class Control_Surface_ : public MIDI_Sender<Control_Surface_>,
     /// A timer to know when to refresh the displays.
     Timer<micros> displayTimer = {1000000UL / MAX_FPS};
 
+  public:
+    /// @name Profiling
+    /// @{
+
+    /// Measure the duration of each phase of @ref loop() using the given
+    /// profiler. Pass `nullptr` to disable profiling (the default).
+    void setLoopProfiler(LoopProfiler *profiler) {
+        this->profiler = profiler;
+    }
+    /// Get the profiler that was set using @ref setLoopProfiler.
+    LoopProfiler *getLoopProfiler() const { return profiler; }
+
+    /// @}
+
+  private:
+    /// Start timing the given phase of the loop, if profiling is enabled.
+    void beginPhase(LoopPhase phase) {
+        if (profiler)
+            profiler->beginPhase(phase);
+    }
+    /// Count a MIDI message that was sent or received, if profiling is
+    /// enabled.
+    void countMessage() {
+        if (profiler)
+            profiler->countMessage();
+    }
+
+    LoopProfiler *profiler = nullptr;
+
   public:
     /// @name MIDI Input Callbacks
     /// @{
@@ -0,0 +1,97 @@
+#include "LoopProfiler.hpp"
+
+#include <AH/Arduino-Wrapper.h>
+
+BEGIN_CS_NAMESPACE
+
+FlashString_t enum_to_string(LoopPhase phase) {
+    switch (phase) {
+        case LoopPhase::BufferedInputs: return F("BufferedInputs");
+        case LoopPhase::Updatables: return F("Updatables");
+        case LoopPhase::MIDIInput: return F("MIDIInput");
+        case LoopPhase::Inputs: return F("Inputs");
+        case LoopPhase::Displays: return F("Displays");
+        case LoopPhase::BufferedOutputs: return F("BufferedOutputs");
+        case LoopPhase::MIDIOutput: return F("MIDIOutput");
+        case LoopPhase::Total: return F("Total");
+        default: return F("<invalid>");
+    }
+}
+
+uint8_t LoopProfiler::PhaseStats::getBucket(uint32_t duration) {
+    uint8_t bucket = 0;
+    while (duration > 0 && bucket < NumBuckets - 1) {
+        duration >>= 1;
+        ++bucket;
+    }
+    return bucket;
+}
+
+void LoopProfiler::PhaseStats::add(uint32_t duration) {
+    if (count == 0 || duration < min)
+        min = duration;
+    if (count == 0 || duration > max)
+        max = duration;
+    ++count;
+    total += duration;
+    ++histogram[getBucket(duration)];
+}
+
+void LoopProfiler::beginLoop() {
+    loopStart = phaseStart = micros();
+    current = NumPhases;
+}
+
+void LoopProfiler::beginPhase(LoopPhase phase) {
+    unsigned long now = micros();
+    endPhase(now);
+    phaseStart = now;
+    current = static_cast<uint8_t>(phase);
+}
+
+void LoopProfiler::endLoop() {
+    unsigned long now = micros();
+    endPhase(now);
+    stats[static_cast<uint8_t>(LoopPhase::Total)].add(now - loopStart);
+    current = NumPhases;
+}
+
+void LoopProfiler::endPhase(unsigned long now) {
+    if (current < NumPhases)
+        stats[current].add(now - phaseStart);
+}
+
+void LoopProfiler::countMessage() {
+    if (current >= NumPhases)
+        return;
+    ++stats[current].messages;
+    ++stats[static_cast<uint8_t>(LoopPhase::Total)].messages;
+}
+
+void LoopProfiler::reset() {
+    for (PhaseStats &s : stats)
+        s = {};
+}
+
+void LoopProfiler::print(Print &p) const {
+    p << F("Phase\tcount\tmin\tmean\tmax\tmessages\thistogram [us]") << endl;
+    for (uint8_t i = 0; i < NumPhases; ++i) {
+        const PhaseStats &s = stats[i];
+        if (s.count == 0)
+            continue;
+        p << static_cast<LoopPhase>(i) << '\t'                  //
+          << static_cast<unsigned long>(s.count) << '\t'        //
+          << static_cast<unsigned long>(s.min) << '\t'          //
+          << static_cast<unsigned long>(s.getMean()) << '\t'    //
+          << static_cast<unsigned long>(s.max) << '\t'          //
+          << static_cast<unsigned long>(s.messages) << '\t';
+        // Only print the buckets up to the longest duration
+        uint8_t last = PhaseStats::getBucket(s.max);
+        for (uint8_t b = 0; b <= last; ++b)
+            p << (b == 0 ? "" : " ")
+              << static_cast<unsigned long>(s.histogram[b]);
+        p << endl;
+    }
+}
+
+END_CS_NAMESPACE
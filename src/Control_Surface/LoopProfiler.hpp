@@ -0,0 +1,128 @@
+#pragma once
+
+#include <AH/PrintStream/PrintStream.hpp>
+#include <Settings/NamespaceSettings.hpp>
+#include <stdint.h>
+
+BEGIN_CS_NAMESPACE
+
+/// The phases of @ref Control_Surface_::loop() that are timed by the
+/// @ref LoopProfiler.
+enum class LoopPhase : uint8_t {
+    BufferedInputs = 0,  ///< ExtendedIOElement::updateAllBufferedInputs()
+    Updatables = 1,      ///< Updatable<>::updateAll()
+    MIDIInput = 2,       ///< Control_Surface_::updateMidiInput()
+    Inputs = 3,          ///< Control_Surface_::updateInputs()
+    Displays = 4,        ///< Control_Surface_::updateDisplays()
+    BufferedOutputs = 5, ///< ExtendedIOElement::updateAllBufferedOutputs()
+    MIDIOutput = 6,      ///< MIDI_Interface::flushAllLoopBatches()
+    Total = 7,           ///< The entire loop.
+};
+
+FlashString_t enum_to_string(LoopPhase phase);
+inline Print &operator<<(Print &p, LoopPhase phase) {
+    return p << enum_to_string(phase);
+}
+
+/**
+ * @brief   Measures how long each phase of @ref Control_Surface_::loop() takes.
+ *
+ * For every phase, the minimum, maximum and mean duration are recorded, as
+ * well as a histogram of the durations, and the number of MIDI messages that
+ * were sent or received by the Control_Surface during that phase. Durations
+ * are measured using `micros()`.
+ *
+ * Profiling is opt-in, enable it using
+ * @ref Control_Surface_::setLoopProfiler:
+ *
+ * ~~~cpp
+ * LoopProfiler profiler;
+ *
+ * void setup() {
+ *     Control_Surface.setLoopProfiler(&profiler);
+ *     Control_Surface.begin();
+ *     Serial.begin(115200);
+ * }
+ *
+ * void loop() {
+ *     Control_Surface.loop();
+ *     static Timer<millis> timer = 5000;
+ *     if (timer) {
+ *         profiler.print(Serial);
+ *         profiler.reset();
+ *     }
+ * }
+ * ~~~
+ *
+ * @ingroup ControlSurfaceModule
+ */
+class LoopProfiler {
+  public:
+    /// The number of phases, including the total.
+    static constexpr uint8_t NumPhases = 8;
+    /// The number of histogram buckets. Bucket @f$ i > 0 @f$ counts durations
+    /// @f$ d @f$ with @f$ 2^{i-1} \le d < 2^i @f$ µs, bucket 0 counts
+    /// durations of 0 µs, and the last bucket also counts all longer
+    /// durations.
+    static constexpr uint8_t NumBuckets = 16;
+
+    /// The timing statistics of a single phase.
+    struct PhaseStats {
+        /// The number of times the phase was executed.
+        uint32_t count;
+        /// The shortest duration in µs.
+        uint32_t min;
+        /// The longest duration in µs.
+        uint32_t max;
+        /// The sum of all durations in µs.
+        uint64_t total;
+        /// The number of MIDI messages sent or received during this phase.
+        uint32_t messages;
+        /// Histogram of the durations, see @ref NumBuckets.
+        uint32_t histogram[NumBuckets];
+
+        /// Get the mean duration in µs.
+        uint32_t getMean() const { return count ? total / count : 0; }
+        /// Add a duration to the statistics.
+        void add(uint32_t duration);
+        /// Get the histogram bucket of the given duration.
+        static uint8_t getBucket(uint32_t duration);
+    };
+
+    LoopProfiler() { reset(); }
+
+    /// @name   Recording (used by Control_Surface_::loop())
+    /// @{
+
+    /// Start a new iteration of the loop.
+    void beginLoop();
+    /// End the current phase (if any), and start timing the given phase.
+    void beginPhase(LoopPhase phase);
+    /// End the current phase and the loop.
+    void endLoop();
+    /// Count a MIDI message in the current phase.
+    void countMessage();
+
+    /// @}
+
+    /// Get the statistics of the given phase.
+    const PhaseStats &getStats(LoopPhase phase) const {
+        return stats[static_cast<uint8_t>(phase)];
+    }
+    /// Clear all statistics.
+    void reset();
+    /// Print a table with the statistics of all phases that were executed at
+    /// least once.
+    void print(Print &p) const;
+
+  private:
+    /// Record the duration of the current phase.
+    void endPhase(unsigned long now);
+
+    PhaseStats stats[NumPhases];
+    unsigned long loopStart = 0;
+    unsigned long phaseStart = 0;
+    uint8_t current = NumPhases;
+};
+
+END_CS_NAMESPACE
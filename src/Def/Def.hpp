@@ -66,4 +66,36 @@ struct PixelLocation {
     int16_t y;
 };
 
+/// A simple struct representing a rectangular area of pixels, with its
+/// top-left corner at (x, y), a width w and a height h.
+struct PixelArea {
+    int16_t x;
+    int16_t y;
+    int16_t w;
+    int16_t h;
+
+    /// Check whether this area contains no pixels.
+    bool isEmpty() const { return w <= 0 || h <= 0; }
+
+    /// Check whether this area and the given area have any pixels in common.
+    bool intersects(PixelArea other) const {
+        return !isEmpty() && !other.isEmpty() && x < other.x + other.w &&
+               other.x < x + w && y < other.y + other.h && other.y < y + h;
+    }
+
+    /// Get the smallest area that contains both this area and the given
+    /// area. Empty areas are ignored.
+    PixelArea merge(PixelArea other) const {
+        if (other.isEmpty())
+            return *this;
+        if (isEmpty())
+            return other;
+        int16_t x0 = x < other.x ? x : other.x;
+        int16_t y0 = y < other.y ? y : other.y;
+        int16_t x1 = x + w > other.x + other.w ? x + w : other.x + other.w;
+        int16_t y1 = y + h > other.y + other.h ? y + h : other.y + other.h;
+        return {x0, y0, int16_t(x1 - x0), int16_t(y1 - y0)};
+    }
+};
+
 END_CS_NAMESPACE
@@ -28,4 +28,26 @@ template <class T>
 typename std::enable_if<!has_method_begin<T>::value>::type
 begin_if_possible(T &) {}
 
+/// Checks whether the USB MIDI backend `T` can write multiple packets using a
+/// single call to `write(const MIDIUSBPacket_t *, uint32_t)`.
+template <class T, class = void>
+struct has_method_write_multiple : std::false_type {};
+
+template <class T>
+struct has_method_write_multiple<
+    T, void_t<decltype(std::declval<T>().write(
+           std::declval<const typename T::MIDIUSBPacket_t *>(), uint32_t()))>>
+    : std::true_type {};
+
+/// Checks whether the USB MIDI backend `T` can read multiple packets using a
+/// single call to `read(MIDIUSBPacket_t *, uint32_t)`.
+template <class T, class = void>
+struct has_method_read_multiple : std::false_type {};
+
+template <class T>
+struct has_method_read_multiple<
+    T, void_t<decltype(std::declval<T>().read(
+           std::declval<typename T::MIDIUSBPacket_t *>(), uint32_t()))>>
+    : std::true_type {};
+
 END_CS_NAMESPACE
@@ -0,0 +1,14 @@
+#include "AsyncDisplayTransfer.hpp"
+
+BEGIN_CS_NAMESPACE
+
+uint8_t *DoubleBufferedDisplayTransfer::getFrontBuffer(uint16_t length) {
+    wait();
+    if (length > capacity) {
+        front.reset(new uint8_t[length]);
+        capacity = length;
+    }
+    return front.get();
+}
+
+END_CS_NAMESPACE
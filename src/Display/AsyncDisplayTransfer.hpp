@@ -0,0 +1,70 @@
+#pragma once
+
+#include <Settings/NamespaceSettings.hpp>
+#include <stdint.h>
+
+#include <AH/STL/memory> // std::unique_ptr
+
+BEGIN_CS_NAMESPACE
+
+/**
+ * @brief   Interface for transfers that write data to a display in the
+ *          background, e.g. using DMA or a separate thread, so the main loop
+ *          doesn't have to wait for the bus.
+ *
+ * @ingroup DisplayElements
+ */
+class AsyncDisplayTransfer {
+  public:
+    virtual ~AsyncDisplayTransfer() = default;
+
+    /// Start writing the given data to the display. The data is not modified
+    /// until @ref isBusy returns false.
+    virtual void start(const uint8_t *data, uint16_t length) = 0;
+    /// Check whether the previous transfer is still in progress.
+    virtual bool isBusy() = 0;
+};
+
+/**
+ * @brief   Double buffering for asynchronous display transfers.
+ *
+ * The display elements draw to the frame buffer of the display library (the
+ * back buffer). When a frame is complete, the data to be written is copied to
+ * the front buffer, which is then handed to the background transfer. The back
+ * buffer can be used for drawing the next frame while the transfer is still
+ * busy.
+ *
+ * @ingroup DisplayElements
+ */
+class DoubleBufferedDisplayTransfer {
+  public:
+    /// Create a double buffer without a transfer.
+    DoubleBufferedDisplayTransfer() = default;
+    /// @param  transfer
+    ///         The transfer that writes the front buffer to the display.
+    DoubleBufferedDisplayTransfer(AsyncDisplayTransfer &transfer)
+        : transfer(&transfer) {}
+
+    /// Check whether a background transfer was given.
+    bool hasTransfer() const { return transfer != nullptr; }
+    /// Check whether the previous frame is still being written.
+    bool isBusy() { return transfer != nullptr && transfer->isBusy(); }
+    /// Wait until the previous frame has been written.
+    void wait() {
+        while (isBusy())
+            ;
+    }
+
+    /// Get a front buffer with room for at least @p length bytes. Waits for the
+    /// previous transfer to finish, because it uses the same buffer.
+    uint8_t *getFrontBuffer(uint16_t length);
+    /// Start writing the first @p length bytes of the front buffer.
+    void start(uint16_t length) { transfer->start(front.get(), length); }
+
+  private:
+    AsyncDisplayTransfer *transfer = nullptr;
+    std::unique_ptr<uint8_t[]> front;
+    uint16_t capacity = 0;
+};
+
+END_CS_NAMESPACE
@@ -29,6 +29,11 @@ class BitmapDisplay : public DisplayElement {
 
     bool getDirty() const override { return value.getDirty(); }
 
+    bool getBounds(PixelArea &bounds) const override {
+        bounds = {x, y, int16_t(xbm.width), int16_t(xbm.height)};
+        return true;
+    }
+
   private:
     Value_t value;
     const XBitmap &xbm;
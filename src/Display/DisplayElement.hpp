@@ -91,6 +91,25 @@ class DisplayElement : public DoublyLinkable<DisplayElement> {
     /// Check if this DisplayElement has to be re-drawn.
     virtual bool getDirty() const = 0;
 
+    /**
+     * @brief   Get the area of the display that this element draws to.
+     *
+     * When all dirty elements of a display report their bounds, only the
+     * union of these areas is cleared, redrawn and written to the display,
+     * instead of the entire screen.
+     *
+     * @param[out]  bounds
+     *              The area that contains all pixels this element could
+     *              draw, in any state.
+     * @return  True if the bounds are known, false otherwise (the default),
+     *          in which case the entire display is redrawn when this element
+     *          is dirty.
+     */
+    virtual bool getBounds(PixelArea &bounds) const {
+        (void)bounds;
+        return false;
+    }
+
     /// Get a reference to the display that this element draws to.
     DisplayInterface &getDisplay() { return display; }
     /// Get a const reference to the display that this element draws to.
@@ -8,6 +8,14 @@ void DisplayInterface::begin() {
     display();
 }
 
+void DisplayInterface::clear(int16_t x, int16_t y, int16_t w, int16_t h) {
+    fillRect(x, y, w, h, 0);
+}
+
+void DisplayInterface::display(int16_t, int16_t, int16_t, int16_t) {
+    display();
+}
+
 void DisplayInterface::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
                                 uint16_t color) {
     for (int16_t r = y; r < y + h; r++)
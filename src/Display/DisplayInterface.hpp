@@ -25,12 +25,29 @@ class DisplayInterface : public Print {
 
     /// Clear the frame buffer or clear the display.
     virtual void clear() = 0;
+    /// Clear the given area of the frame buffer. Used for partial updates,
+    /// the default implementation fills the area with color 0.
+    virtual void clear(int16_t x, int16_t y, int16_t w, int16_t h);
     /// Draw a custom background.
+    ///
+    /// When only part of the display is updated, the background is drawn on
+    /// top of the pixels outside of the updated area as well, so it should not
+    /// draw over the display elements (e.g. using an inverted color).
     virtual void drawBackground() {}
     /// Write the frame buffer to the display. If your display library writes to
     /// the display directly, without a display buffer in RAM, you can leave
     /// this function empty.
     virtual void display() = 0;
+    /// Write the given area of the frame buffer to the display. Displays that
+    /// can only update the entire screen can leave this function as is, the
+    /// default implementation calls @ref display().
+    virtual void display(int16_t x, int16_t y, int16_t w, int16_t h);
+    /// Check whether the display is still busy writing the previous frame in
+    /// the background (see @ref AsyncDisplayTransfer). Busy displays are
+    /// skipped by @ref Control_Surface_::updateDisplays, their elements stay
+    /// dirty and are drawn in the next frame instead. The default
+    /// implementation writes synchronously, and is never busy.
+    virtual bool isBusy() { return false; }
 
     /// Paint a single pixel with the given color.
     virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
@@ -84,6 +101,16 @@ class DisplayInterface : public Print {
         clear();
         drawBackground();
     }
+    /**
+     * @brief   Clear the given area of the frame buffer, and draw the custom
+     *          background.
+     * @see    clear(int16_t, int16_t, int16_t, int16_t)
+     * @see    drawBackground
+     */
+    void clearAndDrawBackground(int16_t x, int16_t y, int16_t w, int16_t h) {
+        clear(x, y, w, h);
+        drawBackground();
+    }
 };
 
 END_CS_NAMESPACE
\ No newline at end of file
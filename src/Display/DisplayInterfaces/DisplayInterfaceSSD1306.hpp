@@ -1,7 +1,10 @@
 #pragma once
 
 #include <Adafruit_SSD1306.h>
+#include <Display/AsyncDisplayTransfer.hpp>
 #include <Display/DisplayInterface.hpp>
+#include <Wire.h>
+#include <string.h> // memcpy
 
 BEGIN_CS_NAMESPACE
 
@@ -9,21 +12,99 @@ BEGIN_CS_NAMESPACE
  * @brief   This class creates a mapping between the Adafruit_SSD1306 display 
  *          driver and the general display interface used by the Control Surface
  *          library.
+ *
+ * The Adafruit_SSD1306 library can only write the entire frame buffer to the
+ * display. If the display is connected over I²C, and the I²C interface is
+ * passed to the constructor, this class can write the damaged part of the frame
+ * buffer itself, which is much faster when only a small part of the display
+ * changes (e.g. a single VU meter).
+ *
+ * Alternatively, the frame buffer can be written in the background, using an
+ * @ref AsyncDisplayTransfer (e.g. using DMA). The data is copied to a front
+ * buffer first, so the next frame can be drawn while the transfer is busy.
+ *
  * @ingroup DisplayElements
  */
 class SSD1306_DisplayInterface : public DisplayInterface {
   protected:
+    /// @param  display
+    ///         The Adafruit_SSD1306 display to draw to. Partial updates write
+    ///         the entire frame buffer.
     SSD1306_DisplayInterface(Adafruit_SSD1306 &display) : disp(display) {}
+    /// @param  display
+    ///         The Adafruit_SSD1306 display to draw to.
+    /// @param  wire
+    ///         The I²C interface the display is connected to, used to write
+    ///         only the damaged pages of the frame buffer to the display.
+    /// @param  address
+    ///         The I²C address of the display.
+    SSD1306_DisplayInterface(Adafruit_SSD1306 &display, TwoWire &wire,
+                             uint8_t address = 0x3C)
+        : disp(display), wire(&wire), address(address) {}
+    /// @param  display
+    ///         The Adafruit_SSD1306 display to draw to.
+    /// @param  transfer
+    ///         The background transfer that writes the data bytes of the frame
+    ///         buffer to the display (e.g. I²C with control byte 0x40, or SPI
+    ///         with the D/C# pin high). The commands that select the address
+    ///         window are sent by the Adafruit_SSD1306 library before the
+    ///         transfer is started.
+    SSD1306_DisplayInterface(Adafruit_SSD1306 &display,
+                             AsyncDisplayTransfer &transfer)
+        : disp(display), async(transfer) {}
 
   public:
+    using DisplayInterface::clear;
+    using DisplayInterface::display;
+
     /// Clear the frame buffer or clear the display.
     void clear() override { disp.clearDisplay(); }
+    /// Clear the given area of the frame buffer.
+    void clear(int16_t x, int16_t y, int16_t w, int16_t h) override {
+        disp.fillRect(x, y, w, h, BLACK);
+    }
     /// Draw a custom background.
     void drawBackground() override = 0;
     /// Write the frame buffer to the display. If your display library writes to
     /// the display directly, without a display buffer in RAM, you can leave
     /// this function empty.
-    void display() override { disp.display(); }
+    void display() override {
+        if (!async.hasTransfer())
+            return disp.display();
+        int16_t rawWidth = getRawWidth(), rawHeight = getRawHeight();
+        writePages(0, (rawHeight - 1) / 8, 0, rawWidth - 1);
+    }
+    /// Write the pages (rows of 8 pixels) that overlap with the given area of
+    /// the frame buffer to the display. Writes the entire frame buffer if
+    /// neither an I²C interface nor a background transfer was passed to the
+    /// constructor.
+    void display(int16_t x, int16_t y, int16_t w, int16_t h) override {
+        if (wire == nullptr && !async.hasTransfer())
+            return display();
+        // Convert the area to the unrotated coordinates of the frame buffer
+        int16_t rawWidth = getRawWidth(), rawHeight = getRawHeight();
+        int16_t rx, ry, rw, rh;
+        switch (disp.getRotation()) {
+            case 0: rx = x, ry = y, rw = w, rh = h; break;
+            case 1: rx = rawWidth - y - h, ry = x, rw = h, rh = w; break;
+            case 2:
+                rx = rawWidth - x - w, ry = rawHeight - y - h, rw = w, rh = h;
+                break;
+            case 3: rx = y, ry = rawHeight - x - w, rw = h, rh = w; break;
+            default: return display();
+        }
+        // Clip the area to the display
+        int16_t x0 = rx < 0 ? 0 : rx, y0 = ry < 0 ? 0 : ry;
+        int16_t x1 = rx + rw > rawWidth ? rawWidth : rx + rw;
+        int16_t y1 = ry + rh > rawHeight ? rawHeight : ry + rh;
+        if (x0 >= x1 || y0 >= y1)
+            return;
+        writePages(y0 / 8, (y1 - 1) / 8, x0, x1 - 1);
+    }
+
+    /// Check whether the background transfer of the previous frame is still
+    /// busy.
+    bool isBusy() override { return async.isBusy(); }
 
     /// Paint a single pixel with the given color.
     void drawPixel(int16_t x, int16_t y, uint16_t color) override {
@@ -68,8 +149,70 @@ class SSD1306_DisplayInterface : public DisplayInterface {
         disp.drawXBitmap(x, y, bitmap, w, h, color);
     }
 
+  private:
+    /// Width of the display without rotation.
+    int16_t getRawWidth() const {
+        return disp.getRotation() & 1 ? disp.height() : disp.width();
+    }
+    /// Height of the display without rotation.
+    int16_t getRawHeight() const {
+        return disp.getRotation() & 1 ? disp.width() : disp.height();
+    }
+
+    /// Write the given pages and columns of the frame buffer over I²C, or
+    /// using the background transfer.
+    void writePages(uint8_t firstPage, uint8_t lastPage, uint8_t firstColumn,
+                    uint8_t lastColumn) {
+        // The bus can't be used for commands while the transfer is busy
+        async.wait();
+        // Set the address window, the data wraps around to the next page at
+        // the last column
+        disp.ssd1306_command(SSD1306_PAGEADDR);
+        disp.ssd1306_command(firstPage);
+        disp.ssd1306_command(lastPage);
+        disp.ssd1306_command(SSD1306_COLUMNADDR);
+        disp.ssd1306_command(firstColumn);
+        disp.ssd1306_command(lastColumn);
+        const uint8_t *buffer = disp.getBuffer();
+        uint16_t rawWidth = getRawWidth();
+        uint16_t columns = lastColumn - firstColumn + 1;
+        if (async.hasTransfer()) {
+            // Copy the window to the front buffer, and write it in the
+            // background
+            uint16_t length = (lastPage - firstPage + 1) * columns;
+            uint8_t *front = async.getFrontBuffer(length);
+            for (uint16_t page = firstPage; page <= lastPage; ++page) {
+                memcpy(front, buffer + page * rawWidth + firstColumn, columns);
+                front += columns;
+            }
+            async.start(length);
+            return;
+        }
+        // The smallest I²C buffer of the common Arduino cores is 32 bytes, one
+        // of which is used for the control byte
+        constexpr uint16_t MaxI2CData = 31;
+        for (uint16_t page = firstPage; page <= lastPage; ++page) {
+            const uint8_t *data = buffer + page * rawWidth + firstColumn;
+            uint16_t remaining = columns;
+            while (remaining > 0) {
+                uint16_t n = remaining < MaxI2CData ? remaining : MaxI2CData;
+                wire->beginTransmission(address);
+                wire->write(0x40); // Co = 0, D/C# = 1: only data bytes follow
+                wire->write(data, n);
+                wire->endTransmission();
+                data += n;
+                remaining -= n;
+            }
+        }
+    }
+
   protected:
     Adafruit_SSD1306 &disp;
+
+  private:
+    TwoWire *wire = nullptr;
+    uint8_t address = 0x3C;
+    DoubleBufferedDisplayTransfer async;
 };
 
 END_CS_NAMESPACE
\ No newline at end of file
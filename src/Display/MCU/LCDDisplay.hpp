@@ -15,7 +15,7 @@ namespace MCU {
  * 
  * @ingroup DisplayElements
  */
-class LCDDisplay : public DisplayElement {
+class LCDDisplay : public DisplayElement, public LCDSubscriber {
   public:
     /**
      * @brief   Constructor.
@@ -41,7 +41,7 @@ class LCDDisplay : public DisplayElement {
                uint16_t color)
         : DisplayElement(display), lcd(lcd), bank(&bank), track(track - 1),
           line(1), x(loc.x), y(loc.y), size(textSize), color(color) {
-        lcd.addSubscriber();
+        lcd.addSubscriber(*this);
     }
 
     /**
@@ -70,7 +70,7 @@ class LCDDisplay : public DisplayElement {
                uint16_t color)
         : DisplayElement(display), lcd(lcd), bank(&bank), track(track - 1),
           line(line - 1), x(loc.x), y(loc.y), size(textSize), color(color) {
-        lcd.addSubscriber();
+        lcd.addSubscriber(*this);
     }
 
     /**
@@ -94,7 +94,7 @@ class LCDDisplay : public DisplayElement {
                PixelLocation loc, uint8_t textSize, uint16_t color)
         : DisplayElement(display), lcd(lcd), track(track - 1), line(1),
           x(loc.x), y(loc.y), size(textSize), color(color) {
-        lcd.addSubscriber();
+        lcd.addSubscriber(*this);
     }
 
     /**
@@ -121,17 +121,17 @@ class LCDDisplay : public DisplayElement {
                uint16_t color)
         : DisplayElement(display), lcd(lcd), track(track - 1), line(line - 1),
           x(loc.x), y(loc.y), size(textSize), color(color) {
-        lcd.addSubscriber();
+        lcd.addSubscriber(*this);
     }
 
     LCDDisplay(const LCDDisplay &) = delete;
-    ~LCDDisplay() { lcd.removeSubscriber(); }
+    ~LCDDisplay() { lcd.removeSubscriber(*this); }
 
     void draw() override {
+        // Determine the track and line to display
+        uint8_t offset = getOffset();
         // If it's a message across all tracks, don't display anything.
         if (separateTracks()) {
-            // Determine the track and line to display
-            uint8_t offset = bank ? bank->getOffset() + track : track;
             if (offset > 7)
                 ERROR(F("Track out of bounds (") << offset << ')', 0xBA41);
             if (line > 1)
@@ -148,10 +148,22 @@ class LCDDisplay : public DisplayElement {
             display.setTextColor(color);
             display.print(buffer);
         }
-        lcd.clearDirty();
+        clearDirtyRanges();
+        drawnOffset = offset;
+        drawnLine = line;
     }
 
-    bool getDirty() const override { return lcd.getDirty(); }
+    /// Only dirty if the text of this track changed, if one of the separators
+    /// of this line changed, or if the bank setting or line changed.
+    bool getDirty() const override {
+        uint8_t offset = getOffset();
+        if (offset != drawnOffset || line != drawnLine)
+            return true;
+        RangeMask mask = offset < 8 ? getTextMask(offset + 8 * line) : 0;
+        for (uint8_t i = 0; i < 7; ++i)
+            mask |= getSeparatorMask(i + 8 * line);
+        return getDirtyRanges() & mask;
+    }
 
     /**
      * @brief   Check if the display contains a message for each track 
@@ -184,11 +196,19 @@ class LCDDisplay : public DisplayElement {
     ///         Either 1 or 2.
     void setLine(uint8_t line) { this->line = line - 1; }
 
+  private:
+    /// Get the index of the track to display.
+    uint8_t getOffset() const {
+        return bank ? bank->getOffset() + track : track;
+    }
+
   private:
     LCD<> &lcd;
     const OutputBank *bank = nullptr;
     uint8_t track;
     uint8_t line;
+    uint8_t drawnOffset = 0xFF;
+    uint8_t drawnLine = 0xFF;
     int16_t x, y;
     uint8_t size;
     uint16_t color;
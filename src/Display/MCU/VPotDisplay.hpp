@@ -39,6 +39,13 @@ class VPotDisplay : public DisplayElement {
 
     bool getDirty() const override { return vpot.getDirty(); }
 
+    bool getBounds(PixelArea &bounds) const override {
+        int16_t r = radius > innerRadius ? radius : innerRadius;
+        bounds = {int16_t(x - r), int16_t(y - r), int16_t(2 * r + 1),
+                  int16_t(2 * r + 1)};
+        return true;
+    }
+
     void setAngleSpacing(float spacing) { this->angleSpacing = spacing; }
     float getAngleSpacing() const { return this->angleSpacing; }
 
@@ -39,6 +39,14 @@ class VUDisplay : public DisplayElement {
         return vu.getDirty() || shouldStartDecaying() || shouldUpdateDecay();
     }
 
+    bool getBounds(PixelArea &bounds) const override {
+        // The peak indicator of a full-scale VU meter is the highest pixel
+        int16_t height = vu.getMax() * (blockheight + spacing) + spacing;
+        bounds = {x, int16_t(y + blockheight - height), int16_t(width),
+                  height};
+        return true;
+    }
+
   protected:
     virtual void drawPeak(uint8_t peak) {
         display.drawFastHLine(x,                                //
@@ -114,7 +122,7 @@ class AnalogVUDisplay : public DisplayElement {
     AnalogVUDisplay(DisplayInterface &display, VU_t &vu, PixelLocation loc,
                     uint16_t radius, float theta_min, float theta_diff,
                     uint16_t color)
-        : DisplayElement(display), vu(vu), x(loc.x), y(loc.y),
+        : DisplayElement(display), vu(vu), x(loc.x), y(loc.y), radius(radius),
           r_sq(radius * radius), theta_min(theta_min), theta_diff(theta_diff),
           color(color) {}
 
@@ -135,11 +143,18 @@ class AnalogVUDisplay : public DisplayElement {
 
     bool getDirty() const override { return vu.getDirty(); }
 
+    bool getBounds(PixelArea &bounds) const override {
+        bounds = {int16_t(x - radius), int16_t(y - radius),
+                  int16_t(2 * radius + 1), int16_t(2 * radius + 1)};
+        return true;
+    }
+
   private:
     VU_t &vu;
 
     int16_t x;
     int16_t y;
+    int16_t radius;
     uint16_t r_sq;
     float theta_min;
     float theta_diff;
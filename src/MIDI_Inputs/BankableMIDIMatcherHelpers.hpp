@@ -3,6 +3,7 @@
 #include <Banks/Bank.hpp>
 #include <Banks/BankConfig.hpp>
 #include <Def/MIDIAddress.hpp>
+#include <MIDI_Inputs/MIDIInputDispatchIndex.hpp>
 
 BEGIN_CS_NAMESPACE
 
@@ -226,6 +227,46 @@ uint8_t getRangeIndex(MIDIAddress tgt, MIDIAddress base,
                : tgt.getAddress() - base.getAddress();
 }
 
+/**
+ * @brief   Add the dispatch keys of all addresses that are matched by
+ *          @ref matchBankableInRange, for all bank settings.
+ * 
+ * @param   keys
+ *          The collector to add the keys to.
+ * @param   base
+ *          The base address (beginning of the range for bank setting 0).
+ * @param   config
+ *          The bank configuration.
+ * @param   length
+ *          The length of the range.
+ */
+template <uint8_t BankSize>
+void addDispatchKeys(MIDIInputDispatchKeys &keys, MIDIAddress base,
+                     BaseBankConfig<BankSize> config, uint8_t length = 1) {
+    if (!base.isValid())
+        return;
+    const int B = config.bank.getTracksPerBank();
+    const int F = config.bank.getSelectionOffset();
+    const int a = base.getAddress();
+    const int c = base.getRawChannel();
+    const int n = base.getRawCableNumber();
+    if (config.type == BankType::ChangeAddress) {
+        for (int diff = 0; diff < BankSize * B; ++diff)
+            if (diff % B < length)
+                keys.add(a + F * B + diff, c, n);
+        return;
+    }
+    for (int bank = 0; bank < BankSize; ++bank) {
+        const int offset = (F + bank) * B;
+        for (int r = 0; r < length; ++r) {
+            if (config.type == BankType::ChangeChannel)
+                keys.add(a + r, c + offset, n);
+            else if (config.type == BankType::ChangeCable)
+                keys.add(a + r, c, n + offset);
+        }
+    }
+}
+
 } // namespace BankableMIDIMatcherHelpers
 
 END_CS_NAMESPACE
\ No newline at end of file
@@ -93,6 +93,13 @@ class VULEDs : public VU, public VULEDsDriver<NumLEDs> {
 
     void updateDisplay() { this->displayVU(getValue()); }
 
+    void handleDecay() override {
+        bool newdirty = Parent::decay();
+        if (newdirty)
+            updateDisplay();
+        this->dirty |= newdirty;
+    }
+
   public:
     void begin() override {
         Parent::begin();
@@ -104,13 +111,6 @@ class VULEDs : public VU, public VULEDsDriver<NumLEDs> {
         Parent::reset();
         updateDisplay();
     }
-
-    void update() override {
-        bool newdirty = Parent::decay();
-        if (newdirty)
-            updateDisplay();
-        this->dirty |= newdirty;
-    }
 };
 
 // -------------------------------------------------------------------------- //
@@ -189,6 +189,13 @@ class VULEDs : public VU<BankSize>, public VULEDsDriver<NumLEDs> {
 
     void updateDisplay() { this->displayVU(this->getValue()); }
 
+    void handleDecay() override {
+        bool newdirty = Parent::decay();
+        if (newdirty)
+            updateDisplay();
+        this->dirty |= newdirty;
+    }
+
   public:
     void begin() override {
         Parent::begin();
@@ -201,13 +208,6 @@ class VULEDs : public VU<BankSize>, public VULEDsDriver<NumLEDs> {
         updateDisplay();
     }
 
-    void update() override {
-        bool newdirty = Parent::decay();
-        if (newdirty)
-            updateDisplay();
-        this->dirty |= newdirty;
-    }
-
   protected:
     void onBankSettingChange() override {
         Parent::onBankSettingChange();
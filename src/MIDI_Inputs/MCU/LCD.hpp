@@ -1,9 +1,10 @@
 #pragma once
 
+#include <AH/Containers/LinkedList.hpp>
 #include <AH/Debug/Debug.hpp>
 #include <AH/Math/MinMaxFix.hpp>
 #include <MIDI_Inputs/MIDIInputElement.hpp>
-#include <string.h> // memcpy
+#include <string.h> // memcpy, memcmp, memchr
 
 #ifndef ARDUINO
 #include <cassert>
@@ -29,6 +30,57 @@ class LCDCounter {
   private:
     static uint8_t instances;
 };
+
+/**
+ * @brief   Base class for objects that display part of the text of an
+ *          @ref LCD, and that need to know which parts of the text changed.
+ *
+ * The MCU LCD consists of two lines of eight tracks, and each track has seven
+ * characters: six characters of text, followed by a separator (usually a
+ * space). The LCD keeps a bit mask of the ranges that changed for each of its
+ * subscribers:
+ *
+ * - bits 0 through 15 are the six characters of text of track 0 through 15
+ *   (tracks 8 through 15 are the tracks on the second line);
+ * - bits 16 through 31 are the separators of track 0 through 15.
+ *
+ * @see @ref LCD::addSubscriber(LCDSubscriber &)
+ */
+class LCDSubscriber : public DoublyLinkable<LCDSubscriber> {
+  public:
+    /// The type of the bit masks of the ranges of text that changed.
+    using RangeMask = uint32_t;
+
+    /// Get the mask of the text of the given track [0, 15].
+    static RangeMask getTextMask(uint8_t track) {
+        return RangeMask(1) << track;
+    }
+    /// Get the mask of the separator of the given track [0, 15].
+    static RangeMask getSeparatorMask(uint8_t track) {
+        return RangeMask(1) << (16 + track);
+    }
+    /// Get the mask of the range that contains the character with the given
+    /// index [0, 111].
+    static RangeMask getRangeMask(uint16_t index) {
+        uint8_t track = index / 7;
+        if (track >= 16)
+            return 0;
+        return index % 7 == 6 ? getSeparatorMask(track) : getTextMask(track);
+    }
+
+    /// Get the ranges that changed since the last time they were cleared.
+    RangeMask getDirtyRanges() const { return dirtyRanges; }
+    /// Clear the given ranges.
+    void clearDirtyRanges(RangeMask mask = ~RangeMask(0)) {
+        dirtyRanges &= ~mask;
+    }
+    /// Mark the given ranges as changed.
+    void markDirtyRanges(RangeMask mask) { dirtyRanges |= mask; }
+
+  private:
+    RangeMask dirtyRanges = ~RangeMask(0);
+};
+
 /**
  * @brief   A class that represents the Mackie Control Universal LCD display and
  *          saves the text it receives.
@@ -73,10 +125,12 @@ class LCD : public MIDIInputElementSysEx, private LCDCounter {
         if (midimsg.getCable() != this->cable)
             return false;
 
-        // We can't handle chunked SysEx data (yet), and it wouldn't make a ton
-        // of sense, since the default SysEx buffer size is the same size as the
-        // SysEx message we expect, so it shouldn't arrive in chunks.
-        if (!midimsg.isCompleteMessage())
+        // Messages may arrive in chunks (e.g. when SysEx streaming is enabled
+        // in the MIDI interface), so the position within the message is
+        // remembered between chunks.
+        if (midimsg.isFirstChunk())
+            position = 0;
+        else if (position == Idle)
             return false;
 
         // Format:
@@ -85,51 +139,63 @@ class LCD : public MIDIInputElementSysEx, private LCDCounter {
         // nn = model number (10 for Logic Control, 11 for Logic Control XT)
         // oo = offset [0x00, 0x6F]
         // yy... = ASCII data
-        if (midimsg.data[5] != 0x12)
-            return false;
-
-        const uint8_t midiOffset = midimsg.data[6];
-        const uint8_t midiLength = midimsg.length - 8;
-        const uint8_t *text = midimsg.data + 7;
-        const uint8_t midiBufferEnd = midiOffset + midiLength;
-
-        const uint8_t bufferEnd = this->offset + BufferSize;
-
-        // If there's no overlap between incoming range and the range that we're
-        // listening for, return:
-        if (midiOffset >= bufferEnd || this->offset >= midiBufferEnd)
-            // If there are other instances, maybe it'll match one of those,
-            // otherwise, stop handling this message:
-            return getInstances() == 1;
-
-        // Find the ranges that overlap between the text data in the message
-        // (src) and the range of characters we're listening for (dst):
-        uint8_t srcStart = max(0, this->offset - midiOffset);
-        uint8_t dstStart = max(0, midiOffset - this->offset);
-        uint8_t length = midiBufferEnd - midiOffset -
-                         max(0, this->offset - midiOffset) -
-                         max(0, midiBufferEnd - bufferEnd);
-
-        // Copy the interesting part to our buffer:
-#ifdef ARDUINO
-        memcpy(&buffer[dstStart], &text[srcStart], length);
-#else // Tests
-        for (uint8_t i = 0; i < length; ++i) {
-            buffer[dstStart + i] = text[srcStart + i];
-            assert(dstStart + i < BufferSize);
-            assert(srcStart + i < midiLength);
+        const uint8_t *data = midimsg.data;
+        uint16_t length = midimsg.length;
+        // Parse the header, byte by byte
+        for (; length > 0 && position < 7; ++data, --length, ++position) {
+            if (*data == uint8_t(MIDIMessageType::SysExEnd)) {
+                position = Idle;
+                break;
+            } else if (position == 5 && *data != 0x12) {
+                position = Idle;
+                return false;
+            } else if (position == 6) {
+                midiOffset = *data;
+            }
+        }
+        // Copy the text in one go, up to the end of the message
+        if (length > 0 && position != Idle) {
+            auto end = static_cast<const uint8_t *>(
+                memchr(data, uint8_t(MIDIMessageType::SysExEnd), length));
+            uint16_t textLength = end ? end - data : length;
+            copyText(midiOffset + position - 7, data, textLength);
+            position = end ? Idle : position + textLength;
         }
-#endif
-
-        markDirty();
 
         // If this is the only instance, the others don't have to be updated
         // anymore, so we return true to break the loop:
         return getInstances() == 1;
     }
 
+  private:
+    /// Copy the given text to the buffer, if it overlaps with the range we're
+    /// listening for, and update the dirty flags of the ranges that changed.
+    void copyText(uint16_t index, const uint8_t *text, uint16_t length) {
+        uint16_t first = max(index, uint16_t(this->offset));
+        uint16_t last = min(uint16_t(index + length),
+                            uint16_t(this->offset + BufferSize));
+        // Copy the text range by range (the six characters of a track, or a
+        // separator), so only the ranges that actually changed are dirty.
+        bool changed = false;
+        LCDSubscriber::RangeMask changedRanges = 0;
+        while (first < last) {
+            uint16_t next = first - first % 7 + (first % 7 < 6 ? 6 : 7);
+            uint16_t count = min(next, last) - first;
+            char *dst = &buffer[first - this->offset];
+            const uint8_t *src = text + (first - index);
+            if (memcmp(dst, src, count) != 0) {
+                memcpy(dst, src, count);
+                changed = true;
+                changedRanges |= LCDSubscriber::getRangeMask(first);
+            }
+            first += count;
+        }
+        if (changed)
+            markDirty(changedRanges);
+    }
+
   public:
-    void begin() override { markDirty(); }
+    void begin() override { markDirty(~LCDSubscriber::RangeMask(0)); }
 
     /// @name   Data access
     /// @{
@@ -153,8 +219,25 @@ class LCD : public MIDIInputElementSysEx, private LCDCounter {
     }
     /// Set the dirty counter to the number of subscribers (or one).
     void markDirty() { dirty = num_subscribers > 0 ? num_subscribers : 1; }
+    /// Set the dirty counter, and mark the given ranges as changed for all
+    /// subscribers.
+    void markDirty(LCDSubscriber::RangeMask ranges) {
+        markDirty();
+        for (LCDSubscriber &subscriber : subscribers)
+            subscriber.markDirtyRanges(ranges);
+    }
     void addSubscriber() { ++num_subscribers; }
     void removeSubscriber() { --num_subscribers; }
+    /// Add a subscriber that keeps track of the ranges of text that changed.
+    void addSubscriber(LCDSubscriber &subscriber) {
+        subscribers.append(subscriber);
+    }
+    /// Remove a subscriber that was added using
+    /// @ref addSubscriber(LCDSubscriber &).
+    void removeSubscriber(LCDSubscriber &subscriber) {
+        if (subscribers.couldContain(subscriber))
+            subscribers.remove(subscriber);
+    }
 
     /// @}
 
@@ -164,6 +247,13 @@ class LCD : public MIDIInputElementSysEx, private LCDCounter {
     Cable cable;
     uint8_t dirty = 0;
     uint8_t num_subscribers = 0;
+    DoublyLinkedList<LCDSubscriber> subscribers;
+    /// Position within the SysEx message that is being received.
+    uint16_t position = Idle;
+    /// Offset of the text in the SysEx message that is being received.
+    uint8_t midiOffset = 0;
+    /// Value of @ref position when no message is being received.
+    constexpr static uint16_t Idle = 0xFFFF;
 };
 
 } // namespace MCU
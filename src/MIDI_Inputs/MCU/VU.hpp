@@ -1,7 +1,7 @@
 #pragma once
 
-#include <AH/Timing/MillisMicrosTimer.hpp>
 #include <MIDI_Inputs/InterfaceMIDIInputElements.hpp>
+#include <MIDI_Inputs/MCU/VUDecayClock.hpp>
 #include <MIDI_Inputs/MIDIInputElementMatchers.hpp>
 
 BEGIN_CS_NAMESPACE
@@ -20,10 +20,11 @@ struct VUState {
      *          The state of the overload indicator.
      */
     VUState(uint8_t value = 0, bool overload = false)
-        : value(value), overload(overload) {}
+        : value(value), overload(overload), fresh(false) {}
 
     uint8_t value : 4; ///< The value of the VU meter [0, 12].
     bool overload : 1; ///< The state of the overload indicator.
+    bool fresh : 1; ///< Whether the value changed since the last decay tick.
 
     enum Changed {
         NothingChanged = 0,
@@ -62,6 +63,7 @@ struct VUState {
             default: { // set value
                 Changed changed = value != data ? ValueChanged : NothingChanged;
                 value = data;
+                fresh |= changed == ValueChanged;
                 return changed;
             }
         }
@@ -75,6 +77,18 @@ struct VUState {
         value--;
         return true;
     }
+
+    /// Decay the VU value on a tick of the shared @ref VUDecayClock.
+    /// A value that changed since the previous tick is held until the next
+    /// tick, so it is displayed for at least one decay period.
+    /// @return     Returns true if the value changed.
+    bool decayTick() {
+        if (fresh) {
+            fresh = false;
+            return false;
+        }
+        return decay();
+    }
 };
 
 // -------------------------------------------------------------------------- //
@@ -123,6 +137,12 @@ struct VUMatcher {
         return {true, data};
     }
 
+    /// Report the channel and cable of the messages to match.
+    bool getDispatchKeys(MIDIInputDispatchKeys &keys) const {
+        keys.add(address.getChannelCable());
+        return true;
+    }
+
     MIDIAddress address; ///< MIDI address to compare incoming messages with.
 };
 
@@ -155,6 +175,12 @@ struct BankableVUMatcher {
         return {true, data, bankIndex};
     }
 
+    /// Report the channels and cables of the messages to match.
+    bool getDispatchKeys(MIDIInputDispatchKeys &keys) const {
+        BankableMIDIMatcherHelpers::addDispatchKeys(keys, address, config);
+        return true;
+    }
+
     /// @todo   Remove unnecessary methods.
     Bank<BankSize> &getBank() { return config.bank; }
     const Bank<BankSize> &getBank() const { return config.bank; }
@@ -187,7 +213,8 @@ constexpr unsigned int Default = 150;
  */
 class VU : public MatchingMIDIInputElement<MIDIMessageType::ChannelPressure,
                                            VUMatcher>,
-           public Interfaces::MCU::IVU {
+           public Interfaces::MCU::IVU,
+           public VUDecayable {
   public:
     using Matcher = VUMatcher;
     using Parent =
@@ -207,12 +234,14 @@ class VU : public MatchingMIDIInputElement<MIDIMessageType::ChannelPressure,
      *          per division, so the default is 150 ms per step.  
      *          Some software doesn't work if the VU meter decays automatically, 
      *          in that case, you can set the decay time to zero to disable 
-     *          the decay.
+     *          the decay.  
+     *          All VU meters with the same decay time share a single
+     *          @ref MCU::VUDecayClock.
      *          @see    @ref MCU::VUDecay
      */
     VU(uint8_t track, MIDIChannelCable channelCN,
        unsigned int decayTime = VUDecay::Default)
-        : Parent({{track - 1, channelCN}}), IVU(12), decayTimer(decayTime) {}
+        : Parent({{track - 1, channelCN}}), IVU(12), VUDecayable(decayTime) {}
 
     /**
      * @brief   Constructor.
@@ -226,7 +255,9 @@ class VU : public MatchingMIDIInputElement<MIDIMessageType::ChannelPressure,
      *          per division, so the default is 150 ms per step.  
      *          Some software doesn't work if the VU meter decays automatically, 
      *          in that case, you can set the decay time to zero to disable 
-     *          the decay.
+     *          the decay.  
+     *          All VU meters with the same decay time share a single
+     *          @ref MCU::VUDecayClock.
      *          @see    @ref MCU::VUDecay
      */
     VU(uint8_t track, unsigned int decayTime = VUDecay::Default)
@@ -234,28 +265,40 @@ class VU : public MatchingMIDIInputElement<MIDIMessageType::ChannelPressure,
 
   protected:
     bool handleUpdateImpl(typename Matcher::Result match) {
-        auto changed = state.update(match.data);
-        if (changed == VUState::ValueChanged)
-            // reset the timer and fire after one interval
-            decayTimer.beginNextPeriod();
-        return changed;
+        return state.update(match.data);
     }
 
     void handleUpdate(typename Matcher::Result match) override {
         dirty |= handleUpdateImpl(match);
     }
 
-    bool decay() {
-        return decayTimer.getInterval() != VUDecay::Hold && decayTimer &&
-               state.decay();
-    }
+    /// Called by the @ref VUDecayClock.
+    bool decay() { return state.decayTick(); }
+
+    void handleDecay() override { dirty |= decay(); }
 
   public:
     /// Reset all values to zero.
     void reset() override { state = {}; }
 
-    /// Decay the VU meter.
-    void update() override { dirty |= decay(); }
+    /// The VU meter is decayed by the shared @ref VUDecayClock, so there's
+    /// nothing to do here.
+    void update() override {}
+
+    using Parent::disable;
+    using Parent::enable;
+
+    /// @copydoc AH::UpdatableCRTP::enable()
+    void enable() {
+        Parent::enable();
+        resumeDecay();
+    }
+    /// @copydoc AH::UpdatableCRTP::disable()
+    /// Disabled meters are not decayed either.
+    void disable() {
+        Parent::disable();
+        pauseDecay();
+    }
 
   public:
     /// @name Data access
@@ -270,7 +313,6 @@ class VU : public MatchingMIDIInputElement<MIDIMessageType::ChannelPressure,
 
   private:
     VUState state = {};
-    AH::Timer<millis> decayTimer;
 };
 
 // -------------------------------------------------------------------------- //
@@ -290,7 +332,8 @@ template <uint8_t BankSize>
 class VU
     : public BankableMatchingMIDIInputElement<MIDIMessageType::ChannelPressure,
                                               BankableVUMatcher<BankSize>>,
-      public Interfaces::MCU::IVU {
+      public Interfaces::MCU::IVU,
+      public VUDecayable {
   public:
     using Matcher = BankableVUMatcher<BankSize>;
     using Parent =
@@ -314,13 +357,15 @@ class VU
      *          per division, so the default is 150 ms per step.  
      *          Some software doesn't work if the VU meter decays automatically, 
      *          in that case, you can set the decay time to zero to disable 
-     *          the decay.
+     *          the decay.  
+     *          All VU meters with the same decay time share a single
+     *          @ref MCU::VUDecayClock.
      *          @see    @ref MCU::VUDecay
      */
     VU(BankConfig<BankSize> config, uint8_t track, MIDIChannelCable channelCN,
        unsigned int decayTime = VUDecay::Default)
         : Parent({config, {track - 1, channelCN}}), IVU(12),
-          decayTimer(decayTime) {}
+          VUDecayable(decayTime) {}
 
     /**
      * @brief   Constructor.
@@ -336,7 +381,9 @@ class VU
      *          per division, so the default is 150 ms per step.  
      *          Some software doesn't work if the VU meter decays automatically, 
      *          in that case, you can set the decay time to zero to disable 
-     *          the decay.
+     *          the decay.  
+     *          All VU meters with the same decay time share a single
+     *          @ref MCU::VUDecayClock.
      *          @see    @ref MCU::VUDecay
      */
     VU(BankConfig<BankSize> config, uint8_t track,
@@ -346,12 +393,6 @@ class VU
   protected:
     bool handleUpdateImpl(typename Matcher::Result match) {
         auto changed = states[match.bankIndex].update(match.data);
-        if (changed == VUState::ValueChanged &&
-            match.bankIndex == this->getActiveBank())
-            // Only care about active bank's decay.
-            // Other banks will decay as well, but not as precisely.
-            // They aren't visible anyway, so it's a good compromise.
-            decayTimer.beginNextPeriod();
         return changed && match.bankIndex == this->getActiveBank();
         // Only mark dirty if the value of the active bank changed
     }
@@ -360,15 +401,17 @@ class VU
         dirty |= handleUpdateImpl(match);
     }
 
+    /// Called by the @ref VUDecayClock.
     bool decay() {
         bool newdirty = false;
-        if (decayTimer.getInterval() != VUDecay::Hold && decayTimer)
-            for (uint8_t i = 0; i < BankSize; ++i)
-                newdirty |= states[i].decay() && i == this->getActiveBank();
+        for (uint8_t i = 0; i < BankSize; ++i)
+            newdirty |= states[i].decayTick() && i == this->getActiveBank();
         // Only mark dirty if the value of the active bank decayed
         return newdirty;
     }
 
+    void handleDecay() override { dirty |= decay(); }
+
   public:
     /// Reset all values to zero.
     void reset() override {
@@ -376,8 +419,24 @@ class VU
         dirty = true;
     }
 
-    /// Decay the VU meter.
-    void update() override { dirty |= decay(); }
+    /// The VU meter is decayed by the shared @ref VUDecayClock, so there's
+    /// nothing to do here.
+    void update() override {}
+
+    using Parent::disable;
+    using Parent::enable;
+
+    /// @copydoc AH::UpdatableCRTP::enable()
+    void enable() {
+        Parent::enable();
+        resumeDecay();
+    }
+    /// @copydoc AH::UpdatableCRTP::disable()
+    /// Disabled meters are not decayed either.
+    void disable() {
+        Parent::disable();
+        pauseDecay();
+    }
 
   protected:
     void onBankSettingChange() override { dirty = true; }
@@ -406,7 +465,6 @@ class VU
 
   private:
     AH::Array<VUState, BankSize> states = {{}};
-    AH::Timer<millis> decayTimer;
 };
 
 } // namespace Bankable
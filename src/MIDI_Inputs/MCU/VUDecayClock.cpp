@@ -0,0 +1,64 @@
+#include "VUDecayClock.hpp"
+#include <AH/Error/Error.hpp>
+
+BEGIN_CS_NAMESPACE
+namespace MCU {
+
+VUDecayClock &VUDecayClock::get(unsigned int decayTime) {
+    static VUDecayClock clocks[MAX_VU_DECAY_TIMES];
+    VUDecayClock *unused = nullptr;
+    for (VUDecayClock &clock : clocks) {
+        if (clock.users > 0 && clock.getDecayTime() == decayTime)
+            return clock;
+        if (clock.users == 0 && unused == nullptr)
+            unused = &clock;
+    }
+    if (unused == nullptr) {
+        ERROR(F("Too many different VU decay times in use, increase "
+                "MAX_VU_DECAY_TIMES"),
+              0x7512);
+        return clocks[MAX_VU_DECAY_TIMES - 1]; // LCOV_EXCL_LINE
+    }
+    unused->timer.setInterval(decayTime);
+    return *unused;
+}
+
+VUDecayClock &VUDecayClock::acquire(unsigned int decayTime) {
+    VUDecayClock &clock = get(decayTime);
+    ++clock.users;
+    return clock;
+}
+
+VUDecayable::VUDecayable(unsigned int decayTime)
+    : clock(decayTime != 0 ? &VUDecayClock::acquire(decayTime) : nullptr) {
+    if (clock)
+        clock->attach(*this);
+}
+
+VUDecayable::VUDecayable(const VUDecayable &other)
+    : DoublyLinkable<VUDecayable>(other), clock(other.clock) {
+    if (clock) {
+        ++clock->users;
+        clock->attach(*this);
+    }
+}
+
+VUDecayable::~VUDecayable() {
+    if (clock) {
+        clock->detach(*this);
+        clock->release();
+    }
+}
+
+void VUDecayable::resumeDecay() {
+    if (clock)
+        clock->attach(*this);
+}
+
+void VUDecayable::pauseDecay() {
+    if (clock)
+        clock->detach(*this);
+}
+
+} // namespace MCU
+END_CS_NAMESPACE
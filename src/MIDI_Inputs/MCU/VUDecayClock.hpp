@@ -0,0 +1,128 @@
+#pragma once
+
+#include <AH/Containers/LinkedList.hpp>
+#include <AH/Containers/Updatable.hpp>
+#include <AH/Timing/MillisMicrosTimer.hpp>
+#include <Settings/SettingsWrapper.hpp>
+
+BEGIN_CS_NAMESPACE
+
+namespace MCU {
+
+class VUDecayClock;
+
+/// Base class for VU meters that are decayed by a shared @ref VUDecayClock.
+class VUDecayable : public DoublyLinkable<VUDecayable> {
+  protected:
+    /// Register with the shared clock for the given decay time in
+    /// milliseconds. If the decay time is @ref VUDecay::Hold (zero), the meter
+    /// doesn't decay, and it's not registered with any clock.
+    VUDecayable(unsigned int decayTime);
+    VUDecayable(const VUDecayable &other);
+    VUDecayable &operator=(const VUDecayable &) { return *this; }
+
+  public:
+    /// Unregister from the shared clock, and release the clock if no other
+    /// meters use it.
+    ~VUDecayable() override;
+
+  protected:
+    /// Start decaying again after @ref pauseDecay.
+    void resumeDecay();
+    /// Stop decaying, e.g. because the meter was disabled. The meter keeps
+    /// its clock.
+    void pauseDecay();
+
+  protected:
+    friend class VUDecayClock;
+    /// Decay all values of the meter by one step. Called by the clock on each
+    /// tick.
+    virtual void handleDecay() = 0;
+
+  private:
+    VUDecayClock *clock;
+};
+
+/**
+ * @brief   Timer that decays all VU meters with the same decay time at once.
+ *
+ * Instead of polling a timer in every VU meter, the meters register with a
+ * shared clock. The clock is updated once per loop by
+ * @ref Control_Surface_::loop (it is a normal @ref AH::Updatable), and only
+ * checks a single timer. When it fires, all registered meters are decayed in
+ * one pass, so their decay phases are in lockstep.
+ *
+ * There is one clock for every distinct decay time that is in use, up to
+ * @ref MAX_VU_DECAY_TIMES. You don't have to create clocks yourself, the VU
+ * meters request them using @ref get. When all meters that use a clock are
+ * destroyed, the clock can be reused for a different decay time. Using more
+ * decay times at once raises an error.
+ */
+class VUDecayClock : public AH::Updatable<> {
+  public:
+    VUDecayClock() : timer(0) {}
+
+    /// Restart the timer: the next tick is one decay period from now.
+    void begin() override {
+        if (meters.getFirst() != nullptr)
+            timer.beginNextPeriod();
+        restart = false;
+    }
+
+    /// Check the timer, and decay all registered meters if it fired.
+    void update() override {
+        if (meters.getFirst() == nullptr)
+            return;
+        // The timer wasn't checked while there were no meters, don't catch up
+        // on the missed ticks
+        if (restart) {
+            begin();
+            return;
+        }
+        if (!timer)
+            return;
+        for (VUDecayable &meter : meters)
+            meter.handleDecay();
+    }
+
+    /// Get the decay time in milliseconds.
+    unsigned int getDecayTime() const { return timer.getInterval(); }
+
+    /// Get the shared clock for the given decay time in milliseconds. Returns
+    /// the clock that is in use for this decay time, or an unused one.
+    static VUDecayClock &get(unsigned int decayTime);
+
+  private:
+    friend class VUDecayable;
+    /// Get the clock for the given decay time, and count the caller as one
+    /// of its users, so the clock is not reused for a different decay time.
+    static VUDecayClock &acquire(unsigned int decayTime);
+    /// Stop counting the caller as one of the users of this clock.
+    void release() { --users; }
+
+    void attach(VUDecayable &meter) {
+        if (meters.couldContain(meter))
+            return;
+        restart |= meters.getFirst() == nullptr;
+        meters.append(meter);
+    }
+    void detach(VUDecayable &meter) {
+        if (meters.couldContain(meter))
+            meters.remove(meter);
+    }
+
+  private:
+    AH::Timer<millis> timer;
+    /// The meters that are decayed by this clock. Paused meters are not in
+    /// this list, but they still count as users.
+    DoublyLinkedList<VUDecayable> meters;
+    /// The number of meters that use this clock, including paused ones.
+    uint16_t users = 0;
+    /// Whether the timer should be restarted before the next tick, because it
+    /// wasn't checked while there were no meters.
+    bool restart = false;
+};
+
+} // namespace MCU
+
+END_CS_NAMESPACE
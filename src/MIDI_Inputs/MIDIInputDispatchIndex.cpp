@@ -0,0 +1,8 @@
+#include "MIDIInputDispatchIndex.hpp"
+
+BEGIN_CS_NAMESPACE
+
+bool MIDIInputDispatchIndexBase::enabled = false;
+uint32_t MIDIInputDispatchIndexBase::generation = 0;
+
+END_CS_NAMESPACE
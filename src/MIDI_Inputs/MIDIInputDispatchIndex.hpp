@@ -0,0 +1,287 @@
+#pragma once
+
+#include <Def/MIDIAddress.hpp>
+#include <MIDI_Parsers/MIDI_MessageTypes.hpp>
+
+#include <AH/STL/memory> // std::unique_ptr
+
+BEGIN_CS_NAMESPACE
+
+/**
+ * @brief   Collects the (cable, channel, data 1) keys that a MIDI input element
+ *          listens to, so it can be added to a @ref MIDIInputDispatchIndex.
+ *
+ * The collector is used in two passes: first only counting the keys, then
+ * writing them to the storage of the index.
+ */
+class MIDIInputDispatchKeys {
+  public:
+    /// Create a collector that only counts the keys.
+    MIDIInputDispatchKeys() = default;
+    /// Create a collector that writes the keys to the given buffer.
+    MIDIInputDispatchKeys(uint16_t *buffer) : buffer(buffer) {}
+
+    /// Add a single key. Addresses, channels or cables outside of their valid
+    /// ranges are ignored, so bank arithmetic doesn't have to check for
+    /// overflow.
+    void add(int address, int rawChannel, int rawCable) {
+        if (address < 0 || address > 0x7F || rawChannel < 0 ||
+            rawChannel > 0xF || rawCable < 0 || rawCable > 0xF)
+            return;
+        uint16_t key = getKey(address, rawChannel, rawCable);
+        // Bankable one-byte matchers may report the same channel more than
+        // once, there's no need to store duplicates.
+        if (count > 0 && key == previous)
+            return;
+        if (buffer)
+            buffer[count] = key;
+        previous = key;
+        ++count;
+    }
+    /// Add the key of the given MIDI address.
+    void add(MIDIAddress address) {
+        if (address.isValid())
+            add(address.getAddress(), address.getRawChannel(),
+                address.getRawCableNumber());
+    }
+    /// Add the key of the given MIDI channel and cable, the data 1 byte is
+    /// set to zero (for messages with one data byte, e.g. Channel Pressure).
+    void add(MIDIChannelCable address) {
+        if (address.isValid())
+            add(0, address.getRawChannel(), address.getRawCableNumber());
+    }
+
+    /// Get the number of keys that were added.
+    uint16_t getCount() const { return count; }
+
+    /// Combine the address, channel and cable into a 15-bit key.
+    static uint16_t getKey(uint8_t address, uint8_t rawChannel,
+                           uint8_t rawCable) {
+        return (uint16_t(rawCable) << 11) | (uint16_t(rawChannel) << 7) |
+               address;
+    }
+
+  private:
+    uint16_t *buffer = nullptr;
+    uint16_t count = 0;
+    uint16_t previous = 0;
+};
+
+namespace detail {
+template <class Matcher>
+auto getMatcherDispatchKeys(const Matcher &matcher, MIDIInputDispatchKeys &keys,
+                            int) -> decltype(matcher.getDispatchKeys(keys)) {
+    return matcher.getDispatchKeys(keys);
+}
+template <class Matcher>
+bool getMatcherDispatchKeys(const Matcher &, MIDIInputDispatchKeys &, long) {
+    return false;
+}
+} // namespace detail
+
+/// Get the dispatch keys of the given Matcher. Matchers without a
+/// `getDispatchKeys` method cannot be indexed, and return false.
+template <class Matcher>
+bool getMatcherDispatchKeys(const Matcher &matcher,
+                            MIDIInputDispatchKeys &keys) {
+    return detail::getMatcherDispatchKeys(matcher, keys, 0);
+}
+
+/// Settings and invalidation shared by the dispatch indices of all MIDI input
+/// element types.
+class MIDIInputDispatchIndexBase {
+  public:
+    /// Enable or disable the dispatch indices of all MIDI input elements.
+    /// Disabled by default, because the index is allocated dynamically.
+    static void setEnabled(bool enabled) {
+        MIDIInputDispatchIndexBase::enabled = enabled;
+        invalidate();
+    }
+    /// Check whether dispatch indices are enabled.
+    static bool isEnabled() { return enabled; }
+    /// Mark all indices as outdated, they will be rebuilt before dispatching
+    /// the next message. Called automatically when MIDI input elements are
+    /// created, destroyed, enabled or disabled. Selecting a different bank
+    /// doesn't invalidate the indices, because bankable elements report the
+    /// keys of all of their banks.
+    static void invalidate() { ++generation; }
+
+  protected:
+    static bool enabled;
+    static uint32_t generation;
+};
+
+/**
+ * @brief   Hash index that maps the (cable, channel, data 1) key of incoming
+ *          Channel Messages to the MIDI input elements listening to it.
+ *
+ * Elements that can't report their keys (see
+ * @ref MIDIInputElement::getDispatchKeys) are kept in a separate list and are
+ * always checked, after the indexed candidates.
+ *
+ * The keys are stored in a compressed sparse row layout: all entries are
+ * sorted by bucket, and `bucketStarts[b]` is the index of the first entry of
+ * bucket `b`. If the elements report more than @ref MaxKeys keys in total,
+ * all elements are checked linearly instead.
+ *
+ * @tparam  Element
+ *          The MIDI input element base class.
+ * @tparam  HasData1Key
+ *          Whether the first data byte of the message is part of the key
+ *          (Note, Key Pressure and Control Change messages), or whether only
+ *          the cable and channel are used (e.g. Pitch Bend).
+ */
+template <class Element, bool HasData1Key>
+class MIDIInputDispatchIndex : public MIDIInputDispatchIndexBase {
+  public:
+    /// The maximum number of keys in the index (the number of buckets and the
+    /// bucket start indices have to fit in 16 bits).
+    constexpr static uint16_t MaxKeys = 0x8000;
+
+    /// Rebuild the index from the given list of elements.
+    template <class List>
+    void build(List &elements) {
+        // Count the number of indexed keys and non-indexable elements
+        uint32_t totalKeys = 0;
+        uint16_t numElements = 0, numUnindexed = 0;
+        for (Element &el : elements) {
+            MIDIInputDispatchKeys keys;
+            if (el.getDispatchKeys(keys))
+                totalKeys += keys.getCount();
+            else
+                ++numUnindexed;
+            ++numElements;
+        }
+        // Too many keys to index, fall back to checking all elements
+        const bool linear = totalKeys > MaxKeys;
+        if (linear)
+            numUnindexed = numElements;
+        uint16_t numKeys = linear ? 0 : uint16_t(totalKeys);
+        // Power of two number of buckets, load factor of at most one
+        uint16_t numBuckets = 1;
+        while (numBuckets < numKeys)
+            numBuckets <<= 1;
+        bucketMask = numBuckets - 1;
+        bucketStarts.reset(new uint16_t[numBuckets + 1]());
+        entryKeys.reset(new uint16_t[numKeys]);
+        entryElements.reset(new Element *[numKeys]);
+        unindexed.reset(new Element *[numUnindexed]);
+        this->numUnindexed = numUnindexed;
+        // Collect the keys of all elements in list order, and count the number
+        // of entries in each bucket
+        std::unique_ptr<uint16_t[]> keys {new uint16_t[numKeys]};
+        std::unique_ptr<Element *[]> owners {new Element *[numKeys]};
+        uint16_t k = 0, u = 0;
+        for (Element &el : elements) {
+            if (linear) {
+                unindexed[u++] = &el;
+                continue;
+            }
+            MIDIInputDispatchKeys elementKeys = &keys[k];
+            if (!el.getDispatchKeys(elementKeys)) {
+                unindexed[u++] = &el;
+                continue;
+            }
+            for (uint16_t end = k + elementKeys.getCount(); k < end; ++k) {
+                keys[k] = normalize(keys[k]);
+                owners[k] = &el;
+                ++bucketStarts[getBucket(keys[k]) + 1];
+            }
+        }
+        // Prefix sum of the bucket sizes gives the bucket start indices
+        for (uint16_t b = 0; b < numBuckets; ++b)
+            bucketStarts[b + 1] += bucketStarts[b];
+        // Scatter the entries into their buckets, keeping list order within a
+        // bucket
+        std::unique_ptr<uint16_t[]> fill {new uint16_t[numBuckets]};
+        for (uint16_t b = 0; b < numBuckets; ++b)
+            fill[b] = bucketStarts[b];
+        for (uint16_t i = 0; i < numKeys; ++i) {
+            uint16_t pos = fill[getBucket(keys[i])]++;
+            entryKeys[pos] = keys[i];
+            entryElements[pos] = owners[i];
+        }
+        removeDuplicates(numBuckets);
+        builtGeneration = generation;
+        built = true;
+    }
+
+    /// Check whether the index has to be rebuilt before it can be used.
+    bool isOutdated() const { return !built || builtGeneration != generation; }
+
+    /// Free all memory used by the index.
+    void clear() {
+        bucketStarts.reset();
+        entryKeys.reset();
+        entryElements.reset();
+        unindexed.reset();
+        numUnindexed = 0;
+        built = false;
+    }
+
+    /// Pass the message to the candidate elements for its key, until one of
+    /// them accepts it.
+    template <class MessageType>
+    bool updateWith(MessageType midimsg) {
+        uint16_t key = normalize(MIDIInputDispatchKeys::getKey(
+            midimsg.getData1(), midimsg.getChannel().getRaw(),
+            midimsg.getCable().getRaw()));
+        uint16_t bucket = getBucket(key);
+        for (uint16_t i = bucketStarts[bucket]; i < bucketStarts[bucket + 1];
+             ++i)
+            if (entryKeys[i] == key && entryElements[i]->updateWith(midimsg))
+                return true;
+        for (uint16_t i = 0; i < numUnindexed; ++i)
+            if (unindexed[i]->updateWith(midimsg))
+                return true;
+        return false;
+    }
+
+  private:
+    /// Remove entries with the same key and element from each bucket (e.g. a
+    /// bankable element whose banks overlap), so an element is never offered
+    /// the same message twice. Compacts the buckets in place.
+    void removeDuplicates(uint16_t numBuckets) {
+        uint16_t w = 0;
+        for (uint16_t b = 0; b < numBuckets; ++b) {
+            uint16_t begin = bucketStarts[b], end = bucketStarts[b + 1];
+            bucketStarts[b] = w;
+            for (uint16_t i = begin; i < end; ++i) {
+                if (!containsEntry(bucketStarts[b], w, i)) {
+                    entryKeys[w] = entryKeys[i];
+                    entryElements[w] = entryElements[i];
+                    ++w;
+                }
+            }
+        }
+        bucketStarts[numBuckets] = w;
+    }
+    /// Check whether the entries in [begin, end) contain entry @p i.
+    bool containsEntry(uint16_t begin, uint16_t end, uint16_t i) const {
+        for (uint16_t j = begin; j < end; ++j)
+            if (entryKeys[j] == entryKeys[i] &&
+                entryElements[j] == entryElements[i])
+                return true;
+        return false;
+    }
+
+    static uint16_t normalize(uint16_t key) {
+        return HasData1Key ? key : key & ~uint16_t(0x7F);
+    }
+    uint16_t getBucket(uint16_t key) const {
+        // Fold the channel and cable bits onto the address bits
+        return (key ^ (key >> 7) ^ (key >> 11)) & bucketMask;
+    }
+
+  private:
+    std::unique_ptr<uint16_t[]> bucketStarts;
+    std::unique_ptr<uint16_t[]> entryKeys;
+    std::unique_ptr<Element *[]> entryElements;
+    std::unique_ptr<Element *[]> unindexed;
+    uint16_t numUnindexed = 0;
+    uint16_t bucketMask = 0;
+    uint32_t builtGeneration = 0;
+    bool built = false;
+};
+
+END_CS_NAMESPACE
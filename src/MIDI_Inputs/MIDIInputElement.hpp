@@ -4,6 +4,7 @@
 #include <MIDI_Parsers/MIDI_MessageTypes.hpp>
 
 #include <Banks/Bank.hpp> // Bank<N>, BankSettingChangeCallback
+#include <MIDI_Inputs/MIDIInputDispatchIndex.hpp>
 
 #include <AH/Containers/Updatable.hpp>
 #include <AH/STL/type_traits>
@@ -19,11 +20,21 @@ BEGIN_CS_NAMESPACE
  */
 template <MIDIMessageType Type>
 class MIDIInputElement : public AH::UpdatableCRTP<MIDIInputElement<Type>> {
+    using Parent = AH::UpdatableCRTP<MIDIInputElement<Type>>;
+
   protected:
-    MIDIInputElement() = default;
+    MIDIInputElement() { MIDIInputDispatchIndexBase::invalidate(); }
+    MIDIInputElement(const MIDIInputElement &other) : Parent(other) {
+        MIDIInputDispatchIndexBase::invalidate();
+    }
+    MIDIInputElement(MIDIInputElement &&other) : Parent(std::move(other)) {
+        MIDIInputDispatchIndexBase::invalidate();
+    }
+    MIDIInputElement &operator=(const MIDIInputElement &) = default;
+    MIDIInputElement &operator=(MIDIInputElement &&) = default;
 
   public:
-    virtual ~MIDIInputElement() = default;
+    virtual ~MIDIInputElement() { MIDIInputDispatchIndexBase::invalidate(); }
 
   public:
     using MessageType =
@@ -42,8 +53,19 @@ class MIDIInputElement : public AH::UpdatableCRTP<MIDIInputElement<Type>> {
     /// Receive a new MIDI message and update the internal state.
     virtual bool updateWith(MessageType midimsg) = 0;
 
+    /// Report the (cable, channel, data 1) keys of all messages this element
+    /// listens to, so it can be added to the dispatch index.
+    /// @return False if the element cannot be indexed, it will then be offered
+    ///         every incoming message.
+    virtual bool getDispatchKeys(MIDIInputDispatchKeys &keys) const {
+        (void)keys;
+        return false;
+    }
+
     /// Update all
     static bool updateAllWith(MessageType midimsg) {
+        if (MIDIInputDispatchIndexBase::isEnabled())
+            return updateIndexedWith(midimsg);
         for (auto &el : MIDIInputElement::updatables) {
             if (el.updateWith(midimsg)) {
                 el.moveDown();
@@ -53,6 +75,16 @@ class MIDIInputElement : public AH::UpdatableCRTP<MIDIInputElement<Type>> {
         return false;
     }
 
+    /// Rebuild the dispatch index of this message type if it is enabled, or
+    /// free it if it isn't.
+    /// @see    @ref MIDIInputDispatchIndexBase::setEnabled
+    static void rebuildDispatchIndex() {
+        if (MIDIInputDispatchIndexBase::isEnabled())
+            dispatchIndex.build(MIDIInputElement::updatables);
+        else
+            dispatchIndex.clear();
+    }
+
     /// Update all
     static void updateAll() {
         MIDIInputElement::applyToAll(&MIDIInputElement::update);
@@ -67,8 +99,49 @@ class MIDIInputElement : public AH::UpdatableCRTP<MIDIInputElement<Type>> {
     static void resetAll() {
         MIDIInputElement::applyToAll(&MIDIInputElement::reset);
     }
+
+  public:
+    using Parent::disable;
+    using Parent::enable;
+
+    /// @copydoc AH::UpdatableCRTP::enable()
+    void enable() {
+        Parent::enable();
+        MIDIInputDispatchIndexBase::invalidate();
+    }
+    /// @copydoc AH::UpdatableCRTP::disable()
+    void disable() {
+        Parent::disable();
+        MIDIInputDispatchIndexBase::invalidate();
+    }
+
+  private:
+    static bool updateIndexedWith(ChannelMessage midimsg) {
+        if (dispatchIndex.isOutdated())
+            dispatchIndex.build(MIDIInputElement::updatables);
+        return dispatchIndex.updateWith(midimsg);
+    }
+    /// System Exclusive messages have no address to index.
+    static bool updateIndexedWith(SysExMessage midimsg) {
+        for (auto &el : MIDIInputElement::updatables)
+            if (el.updateWith(midimsg))
+                return true;
+        return false;
+    }
+
+    /// Message types where the first data byte is an address rather than a
+    /// value.
+    constexpr static bool HasData1Key = Type == MIDIMessageType::NoteOn ||
+                                        Type == MIDIMessageType::KeyPressure ||
+                                        Type == MIDIMessageType::ControlChange;
+    using DispatchIndex = MIDIInputDispatchIndex<MIDIInputElement, HasData1Key>;
+    static DispatchIndex dispatchIndex;
 };
 
+template <MIDIMessageType Type>
+typename MIDIInputElement<Type>::DispatchIndex
+    MIDIInputElement<Type>::dispatchIndex;
+
 // -------------------------------------------------------------------------- //
 
 /// The @ref MIDIInputElement base class is very general: you give it a MIDI
@@ -101,6 +174,10 @@ class MatchingMIDIInputElement : public MIDIInputElement<Type> {
 
     virtual void handleUpdate(typename Matcher::Result match) = 0;
 
+    bool getDispatchKeys(MIDIInputDispatchKeys &keys) const override {
+        return getMatcherDispatchKeys(matcher, keys);
+    }
+
   protected:
     Matcher matcher;
 };
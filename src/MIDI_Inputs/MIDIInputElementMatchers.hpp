@@ -27,6 +27,11 @@ struct OneByteMIDIMatcher {
         return {true, value};
     }
 
+    bool getDispatchKeys(MIDIInputDispatchKeys &keys) const {
+        keys.add(address);
+        return true;
+    }
+
     MIDIChannelCable address;
 };
 
@@ -50,6 +55,11 @@ struct TwoByteMIDIMatcher {
         return {true, value};
     }
 
+    bool getDispatchKeys(MIDIInputDispatchKeys &keys) const {
+        keys.add(address);
+        return true;
+    }
+
     MIDIAddress address;
 };
 
@@ -71,6 +81,11 @@ struct PitchBendMIDIMatcher {
         return {true, value};
     }
 
+    bool getDispatchKeys(MIDIInputDispatchKeys &keys) const {
+        keys.add(address);
+        return true;
+    }
+
     MIDIChannelCable address;
 };
 
@@ -98,6 +113,15 @@ struct TwoByteRangeMIDIMatcher {
         return {true, value, index};
     }
 
+    bool getDispatchKeys(MIDIInputDispatchKeys &keys) const {
+        if (!address.isValid())
+            return true;
+        for (uint8_t i = 0; i < length; ++i)
+            keys.add(address.getAddress() + i, address.getRawChannel(),
+                     address.getRawCableNumber());
+        return true;
+    }
+
     MIDIAddress address;
     uint8_t length;
 };
@@ -129,6 +153,11 @@ struct BankableOneByteMIDIMatcher {
         return {true, value, bankIndex};
     }
 
+    bool getDispatchKeys(MIDIInputDispatchKeys &keys) const {
+        BankableMIDIMatcherHelpers::addDispatchKeys(keys, address, config);
+        return true;
+    }
+
     Bank<BankSize> &getBank() { return config.bank; }
     const Bank<BankSize> &getBank() const { return config.bank; }
     BankType getBankType() const { return config.type; }
@@ -168,6 +197,11 @@ struct BankableTwoByteMIDIMatcher {
         return {true, value, bankIndex};
     }
 
+    bool getDispatchKeys(MIDIInputDispatchKeys &keys) const {
+        BankableMIDIMatcherHelpers::addDispatchKeys(keys, address, config);
+        return true;
+    }
+
     Bank<BankSize> &getBank() { return config.bank; }
     const Bank<BankSize> &getBank() const { return config.bank; }
     BankType getBankType() const { return config.type; }
@@ -208,6 +242,11 @@ struct BankablePitchBendMIDIMatcher {
         return {true, value, bankIndex};
     }
 
+    bool getDispatchKeys(MIDIInputDispatchKeys &keys) const {
+        BankableMIDIMatcherHelpers::addDispatchKeys(keys, address, config);
+        return true;
+    }
+
     Bank<BankSize> &getBank() { return config.bank; }
     const Bank<BankSize> &getBank() const { return config.bank; }
     BankType getBankType() const { return config.type; }
@@ -251,6 +290,12 @@ struct BankableTwoByteRangeMIDIMatcher {
         return {true, value, bankIndex, rangeIndex};
     }
 
+    bool getDispatchKeys(MIDIInputDispatchKeys &keys) const {
+        BankableMIDIMatcherHelpers::addDispatchKeys(keys, address, config,
+                                                    length);
+        return true;
+    }
+
     Bank<BankSize> &getBank() { return config.bank; }
     const Bank<BankSize> &getBank() const { return config.bank; }
     static constexpr setting_t getBankSize() { return BankSize; }
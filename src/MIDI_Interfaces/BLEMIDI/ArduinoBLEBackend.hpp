@@ -50,13 +50,19 @@ class ArduinoBLEBackend : private PollingBLEMIDISender<ArduinoBLEBackend>,
   public:
     using IncomingMIDIMessage = AnyMIDIMessage;
 
+#if !IGNORE_SYSEX
+    /// @see    @ref BufferedBLEMIDIParser::setSysExStreaming
+    void setSysExStreaming(bool streaming) {
+        parser.setSysExStreaming(streaming);
+    }
+#endif
+
     /// Retrieve and remove a single incoming MIDI message from the buffer.
     bool popMessage(IncomingMIDIMessage &incomingMessage) {
         // This function is assumed to be polled regularly by the higher-level
         // MIDI_Interface, so we check the sender's timer here, and we poll
         // the ArduinoBLE library.
-        auto lck = Sender::acquirePacket();
-        Sender::releasePacketAndNotify(lck);
+        Sender::poll();
         arduino_ble_midi::poll();
         // Actually get a MIDI message from the buffer
         return parser.popMessage(incomingMessage);
@@ -89,8 +95,11 @@ class ArduinoBLEBackend : private PollingBLEMIDISender<ArduinoBLEBackend>,
     using Sender::acquirePacket;
     using Sender::forceMinMTU;
     using Sender::getMinMTU;
+    using Sender::getPacketStatistics;
+    using Sender::pushMessage;
     using Sender::releasePacketAndNotify;
     using Sender::sendNow;
+    using Sender::setConnectionInterval;
     using Sender::setTimeout;
 };
 
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <Settings/NamespaceSettings.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include <MIDI_Interfaces/BLEMIDI/BLEMIDIPacketBuilder.hpp>
+
+BEGIN_CS_NAMESPACE
+
+/// A MIDI Channel, System Common or Real-Time message with its BLE-MIDI
+/// timestamp, that can be added to a BLE-MIDI packet later.
+struct BLEMIDIQueuedMessage {
+    uint8_t header;
+    uint8_t data1;
+    uint8_t data2;
+    /// The number of data bytes (0, 1 or 2).
+    uint8_t numData;
+    /// 13-bit BLE-MIDI timestamp.
+    uint16_t timestamp;
+
+    /// Try adding the message to the given packet.
+    /// @return False if the packet is too full.
+    bool addTo(BLEMIDIPacketBuilder &packet) const {
+        if (header >= 0xF8)
+            return packet.addRealTime(header, timestamp);
+        if (header >= 0xF0)
+            return packet.addSysCommon(numData, header, data1, data2,
+                                       timestamp);
+        if (numData == 2)
+            return packet.add3B(header, data1, data2, timestamp);
+        return packet.add2B(header, data1, timestamp);
+    }
+};
+
+/**
+ * @brief   Bounded lock-free multi-producer, single-consumer FIFO queue.
+ *
+ * Any number of threads can push elements concurrently without locking.
+ * Each slot has a sequence number that tells producers whether the slot is
+ * free, and tells the consumer whether it has been written. A producer claims
+ * a slot by incrementing the write index using a compare-and-swap, writes the
+ * element, and then publishes it by updating the slot's sequence number.
+ *
+ * Only a single thread (at a time) is allowed to consume elements.
+ *
+ * @tparam  T
+ *          The type of the elements.
+ * @tparam  Capacity
+ *          The maximum number of elements in the queue, a power of two.
+ */
+template <class T, size_t Capacity>
+class MPSCQueue {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                  "Capacity should be a power of two");
+
+  public:
+    MPSCQueue() {
+        for (size_t i = 0; i < Capacity; ++i)
+            slots[i].seq.store(i, std::memory_order_relaxed);
+    }
+    MPSCQueue(const MPSCQueue &) = delete;
+    MPSCQueue &operator=(const MPSCQueue &) = delete;
+
+    /// Add an element to the back of the queue. Can be called from any
+    /// thread.
+    /// @return False if the queue is full.
+    bool push(const T &value) {
+        size_t pos = write_idx.load(std::memory_order_relaxed);
+        while (true) {
+            Slot &slot = slots[pos % Capacity];
+            size_t seq = slot.seq.load(std::memory_order_acquire);
+            auto diff = static_cast<ptrdiff_t>(seq - pos);
+            if (diff == 0) {
+                // The slot is free, try to claim it
+                if (write_idx.compare_exchange_weak(
+                        pos, pos + 1, std::memory_order_relaxed)) {
+                    slot.value = value;
+                    slot.seq.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                // The slot still contains an element from the previous lap
+                return false;
+            } else {
+                // Another producer claimed the slot
+                pos = write_idx.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// Get a pointer to the element at the front of the queue, or `nullptr`
+    /// if the queue is empty. Consumer only.
+    const T *front() const {
+        const Slot &slot = slots[read_idx % Capacity];
+        size_t seq = slot.seq.load(std::memory_order_acquire);
+        return seq == read_idx + 1 ? &slot.value : nullptr;
+    }
+
+    /// Remove the element at the front of the queue. The queue should not be
+    /// empty. Consumer only.
+    void pop() {
+        Slot &slot = slots[read_idx % Capacity];
+        slot.seq.store(read_idx + Capacity, std::memory_order_release);
+        ++read_idx;
+    }
+
+    /// Remove the element at the front of the queue, and return it.
+    /// Consumer only.
+    /// @return False if the queue is empty.
+    bool pop(T &value) {
+        const T *f = front();
+        if (f == nullptr)
+            return false;
+        value = *f;
+        pop();
+        return true;
+    }
+
+    /// Check whether the queue is empty. Elements that are still being
+    /// written by a producer are not counted. Consumer only.
+    bool empty() const { return front() == nullptr; }
+
+  private:
+    struct Slot {
+        std::atomic_size_t seq;
+        T value;
+    };
+    Slot slots[Capacity];
+    /// Index of the next slot to write to, shared by the producers.
+    alignas(64) std::atomic_size_t write_idx {0};
+    /// Index of the next slot to read from, only used by the consumer.
+    alignas(64) size_t read_idx = 0;
+};
+
+END_CS_NAMESPACE
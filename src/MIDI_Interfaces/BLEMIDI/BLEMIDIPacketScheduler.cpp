@@ -0,0 +1,85 @@
+#include "BLEMIDIPacketScheduler.hpp"
+
+BEGIN_CS_NAMESPACE
+
+void BLEMIDIPacketScheduler::setConnectionInterval(unsigned long interval_us) {
+    interval = interval_us;
+    synced = false;
+}
+
+bool BLEMIDIPacketScheduler::isHighPriority(const BLEMIDIQueuedMessage &msg) {
+    switch (msg.header & 0xF0) {
+        case 0xA0: // Key pressure
+        case 0xB0: // Control change
+        case 0xD0: // Channel pressure
+        case 0xE0: // Pitch bend
+            return false;
+        default: return true;
+    }
+}
+
+bool BLEMIDIPacketScheduler::push(const BLEMIDIQueuedMessage &msg) {
+    return queues[isHighPriority(msg) ? 0 : 1].push(msg);
+}
+
+unsigned long
+BLEMIDIPacketScheduler::getTimeUntilSlot(unsigned long now) const {
+    if (!synced)
+        return 0;
+    long remaining = static_cast<long>(next_slot - now);
+    return remaining > 0 ? remaining : 0;
+}
+
+void BLEMIDIPacketScheduler::startSlot(unsigned long now) {
+    // If we missed a connection event, the link was idle, so we can send the
+    // new data right away, and the following slots are aligned to this one.
+    if (!synced || static_cast<long>(now - next_slot) >= long(interval)) {
+        next_slot = now;
+        synced = true;
+    }
+    // Flushing before the slot is due doesn't give us a new packet budget
+    if (static_cast<long>(now - next_slot) < 0)
+        return;
+    packets_in_slot = 0;
+    next_slot += interval;
+}
+
+uint16_t BLEMIDIPacketScheduler::fillPacket(BLEMIDIPacketBuilder &packet) {
+    uint16_t count = 0;
+    uint16_t last_timestamp = 0;
+    for (Queue &queue : queues) {
+        while (queue.count > 0) {
+            BLEMIDIQueuedMessage msg = queue.front();
+            // Low priority messages can be older than the high priority
+            // messages before them in the packet, but the timestamps cannot go
+            // back in time, because the receiver would interpret that as a
+            // wrap-around of the timestamp. Send them as if they were sent at
+            // the same time as the previous message instead.
+            uint16_t delta = (msg.timestamp - last_timestamp) & 0x1FFF;
+            if (count > 0 && delta >= 0x1000)
+                msg.timestamp = last_timestamp;
+            bool was_empty = packet.empty();
+            if (!msg.addTo(packet)) {
+                if (!was_empty)
+                    return count;
+                // Doesn't fit in an empty packet either (MTU too small), drop
+                // it, otherwise the callers would keep on trying forever
+                packet.reset();
+                queue.pop();
+                continue;
+            }
+            last_timestamp = msg.timestamp;
+            queue.pop();
+            ++count;
+        }
+    }
+    return count;
+}
+
+void BLEMIDIPacketScheduler::packetSent(uint16_t messages) {
+    ++packets_in_slot;
+    ++statistics.packets;
+    statistics.messages += messages;
+}
+
+END_CS_NAMESPACE
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <Settings/NamespaceSettings.hpp>
+
+#include <MIDI_Interfaces/BLEMIDI/BLEMIDIMessageQueue.hpp>
+#include <MIDI_Interfaces/BLEMIDI/BLEMIDIPacketBuilder.hpp>
+
+BEGIN_CS_NAMESPACE
+
+/**
+ * @brief   Decides when to send BLE-MIDI packets and what to put in them.
+ *
+ * The peripheral can only send data during the connection events of the BLE
+ * link, which happen once every connection interval. Sending more than one
+ * batch of packets per interval doesn't lower the latency, it only results in
+ * more, smaller packets. Therefore, the scheduler collects the outgoing
+ * messages, and releases them once per connection interval, packed into as few
+ * packets (of the size of the minimum MTU) as possible.
+ *
+ * Since the BLE stack can only send a limited number of packets per
+ * connection event, the number of packets per interval is limited as well.
+ * When there are more messages than fit in these packets, the messages with a
+ * high priority (notes, real-time messages, program changes and system common
+ * messages) are sent first. Continuous controller messages (control change,
+ * pitch bend and aftertouch) are held back until the next interval. The order
+ * of messages with the same priority is always preserved.
+ *
+ * The scheduler doesn't send any data itself, it is used by
+ * @ref ThreadedBLEMIDISender and @ref PollingBLEMIDISender.
+ */
+class BLEMIDIPacketScheduler {
+  public:
+    /// The number of messages of each priority that can be buffered.
+    constexpr static uint8_t QueueSize = 32;
+
+    /// Statistics about the packets sent by the scheduler.
+    struct Statistics {
+        /// The total number of packets sent.
+        uint32_t packets = 0;
+        /// The total number of messages in those packets.
+        uint32_t messages = 0;
+        /// The average number of messages per packet.
+        float getMessagesPerPacket() const {
+            return packets == 0 ? 0 : float(messages) / float(packets);
+        }
+    };
+
+    /// Set the connection interval of the BLE link in microseconds.
+    /// Zero disables the scheduler.
+    void setConnectionInterval(unsigned long interval_us);
+    /// Get the connection interval of the BLE link in microseconds.
+    unsigned long getConnectionInterval() const { return interval; }
+    /// Check whether a connection interval has been set.
+    bool isEnabled() const { return interval != 0; }
+
+    /// Set the maximum number of packets to send per connection interval.
+    void setMaxPacketsPerInterval(uint8_t packets) {
+        max_packets = packets > 0 ? packets : 1;
+    }
+    /// Get the maximum number of packets to send per connection interval.
+    uint8_t getMaxPacketsPerInterval() const { return max_packets; }
+
+    /// Check whether the given message has a high priority.
+    static bool isHighPriority(const BLEMIDIQueuedMessage &msg);
+
+    /// Add a message to the queue of its priority.
+    /// @return False if that queue is full.
+    bool push(const BLEMIDIQueuedMessage &msg);
+    /// Check whether there are any messages waiting to be sent.
+    bool empty() const { return queues[0].count == 0 && queues[1].count == 0; }
+
+    /// Get the number of microseconds until the next connection event at
+    /// which packets can be sent, zero if they can be sent right away.
+    unsigned long getTimeUntilSlot(unsigned long now) const;
+    /// Start sending the packets for the current connection event. Resets the
+    /// packet budget if the slot is due. The first slot (and the first slot
+    /// after the link was idle) starts immediately, later slots follow one
+    /// connection interval after each other.
+    void startSlot(unsigned long now);
+    /// Check whether another packet can be sent during the current slot.
+    bool canSendPacket() const { return packets_in_slot < max_packets; }
+
+    /// Move as many messages as possible into the given packet, high priority
+    /// messages first. Messages that don't even fit in an empty packet are
+    /// dropped, so the scheduler is always emptied by calling this function
+    /// and sending the packet until @ref empty() returns true.
+    /// @return The number of messages added to the packet.
+    uint16_t fillPacket(BLEMIDIPacketBuilder &packet);
+    /// Should be called after sending a packet.
+    /// @param  messages
+    ///         The number of messages that were added to the packet by
+    ///         @ref fillPacket().
+    void packetSent(uint16_t messages);
+
+    /// Get the statistics of the packets sent so far.
+    Statistics getStatistics() const { return statistics; }
+    /// Reset the statistics.
+    void resetStatistics() { statistics = {}; }
+
+  private:
+    /// Simple FIFO ring buffer of messages.
+    struct Queue {
+        BLEMIDIQueuedMessage messages[QueueSize];
+        uint8_t start = 0;
+        uint8_t count = 0;
+        const BLEMIDIQueuedMessage &front() const { return messages[start]; }
+        void pop() {
+            start = (start + 1) % QueueSize;
+            --count;
+        }
+        bool push(const BLEMIDIQueuedMessage &msg) {
+            if (count == QueueSize)
+                return false;
+            messages[(start + count++) % QueueSize] = msg;
+            return true;
+        }
+    };
+    /// High priority (index 0) and low priority (index 1) messages.
+    Queue queues[2];
+
+    /// Connection interval in microseconds.
+    unsigned long interval = 0;
+    /// Time of the next connection event slot.
+    unsigned long next_slot = 0;
+    /// False if the timing of the slots is unknown (link was idle).
+    bool synced = false;
+    uint8_t max_packets = 4;
+    uint8_t packets_in_slot = 0;
+    Statistics statistics;
+};
+
+END_CS_NAMESPACE
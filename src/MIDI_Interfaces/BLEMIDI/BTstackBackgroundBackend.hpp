@@ -87,12 +87,18 @@ class BTstackBackgroundBackend
   public:
     using IncomingMIDIMessage = AnyMIDIMessage;
 
+#if !IGNORE_SYSEX
+    /// @see    @ref BufferedBLEMIDIParser::setSysExStreaming
+    void setSysExStreaming(bool streaming) {
+        parser.setSysExStreaming(streaming);
+    }
+#endif
+
     /// Retrieve and remove a single incoming MIDI message from the buffer.
     bool popMessage(IncomingMIDIMessage &incomingMessage) {
         // This function is assumed to be polled regularly by the higher-level
         // MIDI_Interface, so we check the sender's timer here.
-        auto lck = Sender::acquirePacket();
-        Sender::releasePacketAndNotify(lck);
+        Sender::poll();
         // Actually get a MIDI message from the buffer
         return parser.popMessage(incomingMessage);
     }
@@ -127,8 +133,11 @@ class BTstackBackgroundBackend
     using Sender::acquirePacket;
     using Sender::forceMinMTU;
     using Sender::getMinMTU;
+    using Sender::getPacketStatistics;
+    using Sender::pushMessage;
     using Sender::releasePacketAndNotify;
     using Sender::sendNow;
+    using Sender::setConnectionInterval;
     using Sender::setTimeout;
 };
 
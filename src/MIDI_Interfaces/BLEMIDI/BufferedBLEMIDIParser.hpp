@@ -31,10 +31,37 @@ class BufferedBLEMIDIParser {
         return ble_buffer.push(packet, type);
     }
 
+#if !IGNORE_SYSEX
+    /// Enable or disable streaming SysEx mode. Instead of copying SysEx data
+    /// to a buffer of @ref SYSEX_BUFFER_SIZE bytes, the data bytes are returned
+    /// as chunks that point directly into the BLE buffer. The chunks are only
+    /// valid until the next call to @ref popMessage.
+    /// @see    @ref SerialMIDI_Parser::setSysExStreaming
+    void setSysExStreaming(bool streaming) {
+        parser.setSysExStreaming(streaming);
+    }
+    /// Check whether streaming SysEx mode is enabled.
+    bool isSysExStreaming() const { return parser.isSysExStreaming(); }
+#endif
+
     /// Retrieve and remove a single incoming MIDI message from the buffer.
     bool popMessage(IncomingMIDIMessage &incomingMessage) {
         // Try reading a MIDI message from the parser
         auto try_read = [&] {
+#if !IGNORE_SYSEX
+            // In streaming mode, SysEx data bytes are passed on directly,
+            // only the status bytes go through the MIDI parser
+            const uint8_t *sysexData;
+            size_t sysexLength;
+            if (parser.isSysExStreaming() && parser.isReceivingSysEx() &&
+                ble_parser.pullData(sysexData, sysexLength)) {
+                incomingMessage = {
+                    SysExMessage(sysexData, uint16_t(sysexLength)),
+                    ble_parser.getTimestamp(),
+                };
+                return true;
+            }
+#endif
             MIDIReadEvent event = parser.pull(ble_parser);
             switch (event) {
                 case MIDIReadEvent::CHANNEL_MESSAGE:
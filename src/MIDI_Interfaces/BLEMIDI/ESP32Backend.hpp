@@ -112,6 +112,11 @@ class ESP32BLEBackend : private ThreadedBLEMIDISender<ESP32BLEBackend<Impl>>,
 
   public:
     using IncomingMIDIMessage = AnyMIDIMessage;
+#if !IGNORE_SYSEX
+    void setSysExStreaming(bool streaming) {
+        parser.setSysExStreaming(streaming);
+    }
+#endif
     bool popMessage(IncomingMIDIMessage &incomingMessage) {
         return parser.popMessage(incomingMessage);
     }
@@ -132,8 +137,11 @@ class ESP32BLEBackend : private ThreadedBLEMIDISender<ESP32BLEBackend<Impl>>,
     using Sender::acquirePacket;
     using Sender::forceMinMTU;
     using Sender::getMinMTU;
+    using Sender::getPacketStatistics;
+    using Sender::pushMessage;
     using Sender::releasePacketAndNotify;
     using Sender::sendNow;
+    using Sender::setConnectionInterval;
     using Sender::setTimeout;
 };
 
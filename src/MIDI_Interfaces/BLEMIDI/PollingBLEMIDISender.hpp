@@ -5,7 +5,9 @@
 #include <chrono>
 
 #include "BLEAPI.hpp"
+#include <MIDI_Interfaces/BLEMIDI/BLEMIDIMessageQueue.hpp>
 #include <MIDI_Interfaces/BLEMIDI/BLEMIDIPacketBuilder.hpp>
+#include <MIDI_Interfaces/BLEMIDI/BLEMIDIPacketScheduler.hpp>
 
 BEGIN_CS_NAMESPACE
 
@@ -21,9 +23,20 @@ class PollingBLEMIDISender {
     /// Initialize.
     void begin();
 
+    /// Add a message to the scheduler, if it is enabled (see
+    /// @ref setConnectionInterval()).
+    /// @return False if the scheduler is disabled or full, in which case the
+    ///         message should be added to the packet using
+    ///         @ref acquirePacket() instead.
+    bool pushMessage(const BLEMIDIQueuedMessage &msg) {
+        return scheduler.isEnabled() && scheduler.push(msg);
+    }
+
     /// RAII lock for access to the packet builder.
     struct ProtectedBuilder;
     /// Acquire exclusive access to the buffer.
+    /// All messages that are held by the scheduler are first added to the
+    /// buffer, so they are sent before anything you add to it.
     /// @return A RAII wrapper that automatically releases the buffer upon
     ///         destruction. Just make sure you don't keep any pointers to the
     ///         `packet` member.
@@ -35,6 +48,10 @@ class PollingBLEMIDISender {
     /// Sends the data immediately without waiting for the timeout.
     void sendNow(ProtectedBuilder &lck);
 
+    /// Send the packet if the timeout expired, or the packets for the current
+    /// connection event if it is due. Should be called regularly.
+    void poll();
+
     /// Set the maximum transmission unit of the Bluetooth link. Used to compute
     /// the MIDI BLE packet size.
     void updateMTU(uint16_t mtu);
@@ -47,9 +64,26 @@ class PollingBLEMIDISender {
     /// messages.
     void setTimeout(std::chrono::milliseconds timeout);
 
+    /// Send the buffered messages once per connection interval of the BLE link
+    /// instead of after the timeout, prioritizing notes and real-time messages.
+    /// @see    @ref BLEMIDIPacketScheduler
+    /// @param  interval
+    ///         The connection interval, zero to use the timeout again.
+    /// @param  max_packets_per_interval
+    ///         The maximum number of packets to send per connection event.
+    void setConnectionInterval(std::chrono::microseconds interval,
+                               uint8_t max_packets_per_interval = 4);
+    /// Get the number of packets and messages sent at the connection
+    /// intervals.
+    BLEMIDIPacketScheduler::Statistics getPacketStatistics() const {
+        return scheduler.getStatistics();
+    }
+
   private:
     /// Actually perform the BLE notification with the given data.
     void sendData(BLEDataView) = delete; // should be implemented by subclass
+    /// Send the packets for the current connection event if it is due.
+    void sendScheduledPackets();
 
   private:
     /// View of the data to send
@@ -59,6 +93,8 @@ class PollingBLEMIDISender {
     unsigned long timeout {10};
     /// Time point when the packet was started.
     unsigned long packet_start_time {0};
+    /// Aligns the packets to the connection interval (if enabled).
+    BLEMIDIPacketScheduler scheduler;
 
   private:
     /// The minimum MTU of all connected clients.
@@ -14,15 +14,53 @@ template <class Derived>
 auto PollingBLEMIDISender<Derived>::acquirePacket() -> ProtectedBuilder {
     if (packet.getSize() == 0)
         packet_start_time = millis();
-    return {&packet};
+    ProtectedBuilder lck {&packet};
+    // The messages held back by the scheduler should be sent first
+    while (!scheduler.empty()) {
+        scheduler.fillPacket(packet);
+        if (!scheduler.empty())
+            sendNow(lck);
+    }
+    return lck;
 }
 
 template <class Derived>
 void PollingBLEMIDISender<Derived>::releasePacketAndNotify(ProtectedBuilder &lck) {
-    if (lck.packet->getSize() > 0 && millis() - packet_start_time > timeout)
+    if (scheduler.isEnabled())
+        sendScheduledPackets();
+    else if (!lck.packet->empty() && millis() - packet_start_time > timeout)
         sendNow(lck);
 }
 
+template <class Derived>
+void PollingBLEMIDISender<Derived>::poll() {
+    if (scheduler.isEnabled()) {
+        // Don't use acquirePacket, it would empty the scheduler
+        sendScheduledPackets();
+    } else {
+        auto lck = acquirePacket();
+        releasePacketAndNotify(lck);
+    }
+}
+
+template <class Derived>
+void PollingBLEMIDISender<Derived>::sendScheduledPackets() {
+    if (packet.empty() && scheduler.empty())
+        return;
+    unsigned long now = micros();
+    if (scheduler.getTimeUntilSlot(now) > 0)
+        return;
+    scheduler.startSlot(now);
+    ProtectedBuilder lck {&packet};
+    while (scheduler.canSendPacket()) {
+        uint16_t count = scheduler.fillPacket(packet);
+        if (packet.empty())
+            break;
+        sendNow(lck);
+        scheduler.packetSent(count);
+    }
+}
+
 template <class Derived>
 void PollingBLEMIDISender<Derived>::sendNow(ProtectedBuilder &lck) {
     BLEDataView data {lck.packet->getBuffer(), lck.packet->getSize()};
@@ -56,4 +94,11 @@ void PollingBLEMIDISender<Derived>::setTimeout(std::chrono::milliseconds timeout
     this->timeout = timeout.count();
 }
 
+template <class Derived>
+void PollingBLEMIDISender<Derived>::setConnectionInterval(
+    std::chrono::microseconds interval, uint8_t max_packets_per_interval) {
+    scheduler.setConnectionInterval(interval.count());
+    scheduler.setMaxPacketsPerInterval(max_packets_per_interval);
+}
+
 END_CS_NAMESPACE
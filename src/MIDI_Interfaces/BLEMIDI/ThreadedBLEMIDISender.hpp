@@ -2,13 +2,16 @@
 
 #include <Settings/NamespaceSettings.hpp>
 
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
 #include <mutex>
 #include <thread>
 
 #include "BLEAPI.hpp"
+#include <MIDI_Interfaces/BLEMIDI/BLEMIDIMessageQueue.hpp>
 #include <MIDI_Interfaces/BLEMIDI/BLEMIDIPacketBuilder.hpp>
+#include <MIDI_Interfaces/BLEMIDI/BLEMIDIPacketScheduler.hpp>
 
 BEGIN_CS_NAMESPACE
 
@@ -26,7 +29,16 @@ class ThreadedBLEMIDISender {
 
     struct ProtectedBuilder;
 
+    /// Add a message to the lock-free queue of the sender thread, without
+    /// waiting for the packet buffer. Can be called from multiple threads
+    /// simultaneously.
+    /// @return False if the queue is full, in which case the message should be
+    ///         added to the packet using @ref acquirePacket() instead.
+    bool pushMessage(const BLEMIDIQueuedMessage &msg);
+
     /// Acquire exclusive access to the buffer to be sent by the timer.
+    /// All messages that were queued by @ref pushMessage() are first added to
+    /// the buffer, so they are sent before anything you add to it.
     /// @return A RAII wrapper that automatically releases the buffer upon
     ///         destruction. Just make sure you don't keep any pointers to the
     ///         `packet` member.
@@ -50,6 +62,19 @@ class ThreadedBLEMIDISender {
     /// messages.
     void setTimeout(std::chrono::milliseconds timeout);
 
+    /// Send the queued messages once per connection interval of the BLE link
+    /// instead of after the timeout, prioritizing notes and real-time messages.
+    /// @see    @ref BLEMIDIPacketScheduler
+    /// @param  interval
+    ///         The connection interval, zero to use the timeout again.
+    /// @param  max_packets_per_interval
+    ///         The maximum number of packets to send per connection event.
+    void setConnectionInterval(std::chrono::microseconds interval,
+                               uint8_t max_packets_per_interval = 4);
+    /// Get the number of packets and messages sent at the connection
+    /// intervals.
+    BLEMIDIPacketScheduler::Statistics getPacketStatistics();
+
   private:
     /// Actually perform the BLE notification with the given data.
     void sendData(BLEDataView) = delete; // should be implemented by subclass
@@ -59,6 +84,23 @@ class ThreadedBLEMIDISender {
     /// after the first data was added to the packet), or immediately when it
     /// receives a flush signal from the main thread.
     bool handleSendEvents();
+    /// Current time of the steady clock in microseconds, used by the scheduler.
+    static unsigned long microsSinceEpoch() {
+        using namespace std::chrono;
+        auto now = steady_clock::now().time_since_epoch();
+        return duration_cast<microseconds>(now).count();
+    }
+    /// Send the packets for the current connection event (the mutex should be
+    /// locked).
+    void sendScheduledPackets();
+    /// Move the messages held by the scheduler and the queued messages into
+    /// the packet buffer (the mutex should be locked). When the packet is
+    /// full, it is sent by @p send_full_packet.
+    template <class F>
+    void drainQueue(F send_full_packet);
+    /// Send the packet buffer over BLE and start a new one (the mutex should
+    /// be locked).
+    void sendPacket();
 
   private:
     struct {
@@ -78,6 +120,15 @@ class ThreadedBLEMIDISender {
     /// data to send, and for the main thread to wait for the data to be flushed
     /// by the sender thread.
     std::condition_variable cv;
+    /// Messages added by @ref pushMessage() that haven't been added to the
+    /// packet yet. Consumed only while holding the mutex.
+    MPSCQueue<BLEMIDIQueuedMessage, 64> queue;
+    /// Aligns the packets to the connection interval (if enabled). Protected
+    /// by the mutex.
+    BLEMIDIPacketScheduler scheduler;
+    /// Set by the sender thread when it waits for data, so that producers
+    /// know they have to wake it up.
+    std::atomic_bool sleeping {false};
     /// Lock type used to lock the mutex
     using lock_t = std::unique_lock<std::mutex>;
     /// The background thread responsible for sending the data.
@@ -12,7 +12,7 @@ ThreadedBLEMIDISender<Derived>::~ThreadedBLEMIDISender() {
     // Tell the sender to not to wait for the timeout
     shared.flush = true;
     lck.unlock();
-    cv.notify_one();
+    cv.notify_all();
     // Wait for it to be sent, and join the thread when done
     if (send_thread.joinable())
         send_thread.join();
@@ -27,16 +27,41 @@ void ThreadedBLEMIDISender<Derived>::begin() {
     });
 }
 
+template <class Derived>
+bool ThreadedBLEMIDISender<Derived>::pushMessage(
+    const BLEMIDIQueuedMessage &msg) {
+    if (!queue.push(msg))
+        return false;
+    // Only wake up the sender thread if it is waiting for data. The fence
+    // orders the push before the load of the flag, the sender thread does the
+    // opposite, so at least one of both threads sees the other's write.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (sleeping.load(std::memory_order_relaxed) && sleeping.exchange(false)) {
+        // Locking the mutex ensures that the sender thread is either still
+        // checking its condition (and will see the new message), or that it is
+        // already waiting (and will receive the notification).
+        shared.mtx.lock();
+        shared.mtx.unlock();
+        cv.notify_all();
+    }
+    return true;
+}
+
 template <class Derived>
 auto ThreadedBLEMIDISender<Derived>::acquirePacket() -> ProtectedBuilder {
-    return {&shared.packet, lock_t {shared.mtx}};
+    ProtectedBuilder lck {&shared.packet, lock_t {shared.mtx}};
+    // Messages that were queued earlier should be sent first. Note that the
+    // mutex is released while flushing, so a message is only removed from
+    // the queue once it has been added to the packet.
+    drainQueue([&] { sendNow(lck); });
+    return lck;
 }
 
 template <class Derived>
 void ThreadedBLEMIDISender<Derived>::releasePacketAndNotify(
     ProtectedBuilder &lck) {
     lck.lck.unlock();
-    cv.notify_one();
+    cv.notify_all();
 }
 
 template <class Derived>
@@ -49,7 +74,7 @@ void ThreadedBLEMIDISender<Derived>::sendNow(ProtectedBuilder &lck) {
     // Tell the background sender thread to send the packet now
     shared.flush = true;
     lck.lck.unlock();
-    cv.notify_one();
+    cv.notify_all();
 
     // Wait for flush to complete (when the sender clears the flush flag)
     lck.lck.lock();
@@ -83,22 +108,46 @@ void ThreadedBLEMIDISender<Derived>::setTimeout(
 }
 
 template <class Derived>
-bool ThreadedBLEMIDISender<Derived>::handleSendEvents() {
+void ThreadedBLEMIDISender<Derived>::setConnectionInterval(
+    std::chrono::microseconds interval, uint8_t max_packets_per_interval) {
     lock_t lck(shared.mtx);
+    scheduler.setConnectionInterval(interval.count());
+    scheduler.setMaxPacketsPerInterval(max_packets_per_interval);
+}
 
-    // Wait for a packet to be started (or for a stop signal)
-    cv.wait(lck, [this] { return !shared.packet.empty() || shared.stop; });
-    // Wait for flush signal or timeout.
-    auto timeout = shared.timeout;
-    cv.wait_for(lck, timeout, [this] { return shared.flush; });
+template <class Derived>
+BLEMIDIPacketScheduler::Statistics
+ThreadedBLEMIDISender<Derived>::getPacketStatistics() {
+    lock_t lck(shared.mtx);
+    return scheduler.getStatistics();
+}
 
-    // Stop this thread
-    if (shared.stop)
-        return false;
-    // Note: do not send anything in this case, because we might be in the base
-    // class destructor, and the subclass implementing the sendData function
-    // might already be destroyed.
+template <class Derived>
+template <class F>
+void ThreadedBLEMIDISender<Derived>::drainQueue(F send_full_packet) {
+    // The messages held back by the scheduler are older than the queued ones
+    while (!scheduler.empty()) {
+        scheduler.fillPacket(shared.packet);
+        if (!scheduler.empty())
+            send_full_packet();
+    }
+    while (const BLEMIDIQueuedMessage *msg = queue.front()) {
+        bool was_empty = shared.packet.empty();
+        if (msg->addTo(shared.packet)) {
+            queue.pop();
+        } else if (was_empty) {
+            // Doesn't fit in an empty packet either (MTU too small), drop it.
+            // The packet may contain the header of the failed attempt.
+            shared.packet.reset();
+            queue.pop();
+        } else {
+            send_full_packet();
+        }
+    }
+}
 
+template <class Derived>
+void ThreadedBLEMIDISender<Derived>::sendPacket() {
     // Send the packet over BLE, empty the buffer, and update the buffer
     // size based on the MTU of the connected clients.
     BLEDataView data {shared.packet.getBuffer(), shared.packet.getSize()};
@@ -111,12 +160,69 @@ bool ThreadedBLEMIDISender<Derived>::handleSendEvents() {
     // updating the MTU while a transmission is already going on is rare, we
     // don't handle this case, as it would require parsing and re-encoding the
     // buffer into two or more packets.
+}
+
+template <class Derived>
+void ThreadedBLEMIDISender<Derived>::sendScheduledPackets() {
+    scheduler.startSlot(microsSinceEpoch());
+    // When flushing, all data is sent, otherwise, the remaining data has to
+    // wait for the next connection event. If the slot isn't due yet, the
+    // packet budget of the current slot may already be used up.
+    while (shared.flush || scheduler.canSendPacket()) {
+        while (const BLEMIDIQueuedMessage *msg = queue.front()) {
+            if (!scheduler.push(*msg))
+                break;
+            queue.pop();
+        }
+        uint16_t count = scheduler.fillPacket(shared.packet);
+        if (shared.packet.empty())
+            break;
+        sendPacket();
+        scheduler.packetSent(count);
+    }
+}
+
+template <class Derived>
+bool ThreadedBLEMIDISender<Derived>::handleSendEvents() {
+    lock_t lck(shared.mtx);
+
+    // Wait for a packet to be started or a message to be queued (or for a
+    // stop signal)
+    sleeping.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    cv.wait(lck, [this] {
+        return !shared.packet.empty() || !queue.empty() || !scheduler.empty() ||
+               shared.stop;
+    });
+    sleeping.store(false, std::memory_order_relaxed);
+    // Wait for flush signal or timeout (or the next connection event).
+    std::chrono::microseconds timeout = shared.timeout;
+    if (scheduler.isEnabled())
+        timeout = std::chrono::microseconds {
+            scheduler.getTimeUntilSlot(microsSinceEpoch())};
+    cv.wait_for(lck, timeout, [this] { return shared.flush; });
+
+    // Stop this thread
+    if (shared.stop)
+        return false;
+    // Note: do not send anything in this case, because we might be in the base
+    // class destructor, and the subclass implementing the sendData function
+    // might already be destroyed.
+
+    if (scheduler.isEnabled()) {
+        sendScheduledPackets();
+    } else {
+        // Add the queued messages to the packet, sending all full packets,
+        // and then send the remainder.
+        drainQueue([this] { sendPacket(); });
+        sendPacket();
+    }
 
     // Notify the main thread that the flush was done.
     if (shared.flush) {
         shared.flush = false;
         lck.unlock();
-        cv.notify_one();
+        cv.notify_all();
     }
     return true;
 }
@@ -0,0 +1,189 @@
+#pragma once
+
+#include <Settings/SettingsWrapper.hpp>
+#if !DISABLE_PIPES
+
+#include "MIDI_Pipes.hpp"
+#include <AH/Containers/Updatable.hpp>
+#include <MIDI_Constants/Control_Change.hpp>
+
+BEGIN_CS_NAMESPACE
+
+/**
+ * @brief   A MIDI pipe that only keeps the newest value of Control Change and
+ *          Pitch Bend messages, and sends them in bounded slices once per
+ *          loop.
+ *
+ * When many potentiometers or faders move at once, they can produce messages
+ * faster than the MIDI interface can transmit them (especially for Bluetooth).
+ * Instead of sending every intermediate value, this pipe stores the messages
+ * in a table keyed by (cable, channel, controller). A new value for a key that
+ * is already pending simply replaces the old value, without changing its
+ * position in the queue. The pending messages are sent in first-in, first-out
+ * order, at most @p maxPerUpdate every time @ref update() is called (once per
+ * iteration of @ref Control_Surface_::loop()).
+ *
+ * All other messages are forwarded immediately. To preserve their order
+ * relative to the controllers, pending messages on the same cable and channel
+ * are sent first. The (N)RPN and data increment/decrement controllers and the
+ * channel mode messages are never coalesced, because their order is
+ * significant.
+ *
+ * Usage:
+ *
+ * ~~~cpp
+ * USBMIDI_Interface midi;
+ * CoalescingMIDI_Pipe<32> coalescer;
+ * MIDI_Pipe inpipe;
+ *
+ * void setup() {
+ *     Control_Surface >> coalescer >> midi;
+ *     Control_Surface << inpipe << midi;
+ *     Control_Surface.begin();
+ * }
+ * ~~~
+ *
+ * @tparam  N
+ *          The maximum number of pending messages. When the table is full, the
+ *          oldest message is sent to make room for a new key.
+ *
+ * @ingroup MIDI_Routing
+ */
+template <uint8_t N>
+class CoalescingMIDI_Pipe : public MIDI_Pipe, public AH::Updatable<> {
+  public:
+    /// @param  maxPerUpdate
+    ///         The maximum number of pending messages to send per call to
+    ///         @ref update().
+    CoalescingMIDI_Pipe(uint8_t maxPerUpdate = N)
+        : maxPerUpdate(maxPerUpdate) {}
+
+    void begin() override {}
+    /// Send at most @p maxPerUpdate pending messages.
+    void update() override { flush(maxPerUpdate); }
+
+    /// Send at most @p max pending messages, oldest first. Nothing is sent
+    /// while the pipe is stalled.
+    void flush(uint8_t max = N) {
+        if (isStalled())
+            return;
+        uint8_t count = max < size ? max : size;
+        for (uint8_t i = 0; i < count; ++i)
+            sourceMIDItoSink(pending[i].toMessage());
+        remove(0, count);
+    }
+
+    /// Get the number of messages that are waiting to be sent.
+    uint8_t getNumPending() const { return size; }
+
+    /// Set the maximum number of pending messages to send per call to
+    /// @ref update().
+    void setMaxPerUpdate(uint8_t maxPerUpdate) {
+        this->maxPerUpdate = maxPerUpdate;
+    }
+    /// Get the maximum number of pending messages to send per call to
+    /// @ref update().
+    uint8_t getMaxPerUpdate() const { return maxPerUpdate; }
+
+    /// Check whether the given message can be coalesced.
+    static bool isCoalescable(ChannelMessage msg) {
+        if (msg.getMessageType() == MIDIMessageType::PitchBend)
+            return true;
+        if (msg.getMessageType() != MIDIMessageType::ControlChange)
+            return false;
+        switch (msg.getData1()) {
+            case MIDI_CC::Data_Entry_MSB:
+            case MIDI_CC::Data_Entry_LSB:
+            case MIDI_CC::Data_Increment:
+            case MIDI_CC::Data_Decrement:
+            case MIDI_CC::NRPN_LSB:
+            case MIDI_CC::NRPN_MSB:
+            case MIDI_CC::RPN_LSB:
+            case MIDI_CC::RPN_MSB: return false;
+            // Channel Mode Messages are never coalesced
+            default: return msg.getData1() < MIDI_CC::All_Sound_Off;
+        }
+    }
+
+  private:
+    void mapForwardMIDI(ChannelMessage msg) override {
+        if (!isCoalescable(msg)) {
+            flushChannel(msg);
+            sourceMIDItoSink(msg);
+            return;
+        }
+        for (uint8_t i = 0; i < size; ++i) {
+            if (pending[i].hasSameKey(msg)) {
+                pending[i] = msg;
+                return;
+            }
+        }
+        if (size == N) {
+            sourceMIDItoSink(pending[0].toMessage());
+            remove(0, 1);
+        }
+        pending[size++] = msg;
+    }
+
+    /// Send and remove all pending messages on the same cable and channel as
+    /// the given message.
+    void flushChannel(ChannelMessage msg) {
+        uint8_t kept = 0;
+        for (uint8_t i = 0; i < size; ++i) {
+            if (pending[i].isOnSameChannel(msg))
+                sourceMIDItoSink(pending[i].toMessage());
+            else
+                pending[kept++] = pending[i];
+        }
+        size = kept;
+    }
+
+    /// Remove @p count messages starting at index @p first, keeping the order
+    /// of the other messages.
+    void remove(uint8_t first, uint8_t count) {
+        for (uint8_t i = first; i + count < size; ++i)
+            pending[i] = pending[i + count];
+        size -= count;
+    }
+
+  private:
+    /// Compact storage for a pending message (ChannelMessage has no default
+    /// constructor).
+    struct Pending {
+        uint8_t header;
+        uint8_t data1;
+        uint8_t data2;
+        uint8_t cable;
+
+        Pending &operator=(ChannelMessage msg) {
+            header = msg.header;
+            data1 = msg.data1;
+            data2 = msg.data2;
+            cable = msg.cable.getRaw();
+            return *this;
+        }
+        ChannelMessage toMessage() const {
+            return {header, data1, data2, Cable(cable)};
+        }
+        /// Same channel and cable.
+        bool isOnSameChannel(ChannelMessage msg) const {
+            return (header & 0x0F) == (msg.header & 0x0F) &&
+                   cable == msg.cable.getRaw();
+        }
+        /// Same message type, channel, cable and (for Control Change)
+        /// controller number.
+        bool hasSameKey(ChannelMessage msg) const {
+            return header == msg.header && cable == msg.cable.getRaw() &&
+                   (msg.getMessageType() == MIDIMessageType::PitchBend ||
+                    data1 == msg.data1);
+        }
+    };
+
+    Pending pending[N];
+    uint8_t size = 0;
+    uint8_t maxPerUpdate;
+};
+
+END_CS_NAMESPACE
+
+#endif
@@ -3,6 +3,7 @@
 #include <AH/Error/Error.hpp>
 
 #include "BLEMIDI/BLEAPI.hpp"
+#include "BLEMIDI/BLEMIDIPacketScheduler.hpp"
 #include "MIDI_Interface.hpp"
 
 #include <chrono>
@@ -78,6 +79,15 @@ class GenericBLEMIDI_Interface : public MIDI_Interface {
     /// Get the BLE-MIDI timestamp of the latest MIDI message.
     /// @note Invalid for SysEx chunks (except the last chunk of a message).
     uint16_t getTimestamp() const;
+#if !IGNORE_SYSEX
+    /// Pass on incoming SysEx data as chunks that point directly into the BLE
+    /// receive buffer, instead of copying it to a buffer of
+    /// @ref SYSEX_BUFFER_SIZE bytes. Allows receiving messages of any length.
+    /// Use @ref SysExReassembler if you need complete messages.
+    void setSysExStreaming(bool streaming = true) {
+        backend.setSysExStreaming(streaming);
+    }
+#endif
 
     /// @}
 
@@ -103,6 +113,22 @@ class GenericBLEMIDI_Interface : public MIDI_Interface {
     void setTimeout(std::chrono::milliseconds timeout) {
         backend.setTimeout(timeout);
     }
+    /// Align the outgoing packets to the connection interval of the BLE link
+    /// instead of using the timeout. The buffered messages are sent once per
+    /// connection interval, in as few packets as possible. If there is more
+    /// data than fits in @p max_packets_per_interval packets, notes and
+    /// real-time messages are sent before continuous controllers.
+    /// Set the interval to zero to use the timeout again.
+    /// @see    @ref BLEMIDIPacketScheduler
+    void setConnectionInterval(std::chrono::microseconds interval,
+                               uint8_t max_packets_per_interval = 4) {
+        backend.setConnectionInterval(interval, max_packets_per_interval);
+    }
+    /// Get the number of packets and messages that were sent at the connection
+    /// intervals, see @ref setConnectionInterval().
+    BLEMIDIPacketScheduler::Statistics getPacketStatistics() {
+        return backend.getPacketStatistics();
+    }
     /// BLE backend configuration option.
     BLESettings ble_settings;
 
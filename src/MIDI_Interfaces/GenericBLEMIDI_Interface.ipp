@@ -29,6 +29,11 @@ template <class BackendT>
 void GenericBLEMIDI_Interface<BackendT>::sendChannelMessageImpl(
     ChannelMessage msg) {
     uint16_t timestamp = millis(); // BLE MIDI timestamp
+    // Try the lock-free queue of the sender thread first
+    uint8_t numData = msg.hasTwoDataBytes() ? 2 : 1;
+    if (backend.pushMessage(
+            {msg.header, msg.data1, msg.data2, numData, timestamp}))
+        return;
     auto lck = backend.acquirePacket();
     if (msg.hasTwoDataBytes()) {
         sendImpl(lck, [&] {
@@ -45,6 +50,8 @@ void GenericBLEMIDI_Interface<BackendT>::sendChannelMessageImpl(
 template <class BackendT>
 void GenericBLEMIDI_Interface<BackendT>::sendRealTimeImpl(RealTimeMessage msg) {
     uint16_t timestamp = millis(); // BLE MIDI timestamp
+    if (backend.pushMessage({msg.message, 0, 0, 0, timestamp}))
+        return;
     auto lck = backend.acquirePacket();
     sendImpl(lck,
              [&] { return lck.packet->addRealTime(msg.message, timestamp); });
@@ -54,10 +61,14 @@ template <class BackendT>
 void GenericBLEMIDI_Interface<BackendT>::sendSysCommonImpl(
     SysCommonMessage msg) {
     uint16_t timestamp = millis(); // BLE MIDI timestamp
+    uint8_t numData = msg.getNumberOfDataBytes();
+    if (backend.pushMessage(
+            {msg.header, msg.data1, msg.data2, numData, timestamp}))
+        return;
     auto lck = backend.acquirePacket();
     sendImpl(lck, [&] {
-        return lck.packet->addSysCommon(msg.getNumberOfDataBytes(), msg.header,
-                                        msg.data1, msg.data2, timestamp);
+        return lck.packet->addSysCommon(numData, msg.header, msg.data1,
+                                        msg.data2, timestamp);
     });
 }
 
@@ -11,12 +11,29 @@ class MIDI_Interface;
 
 /**
  * @brief   A class for callbacks from MIDI input.
+ * 
+ * @note    Incoming Channel messages are collected in batches (see
+ *          @ref MIDI_CALLBACK_BATCH_SIZE): all messages of a batch are first
+ *          sent to the pipes, and only then are the Channel message callbacks
+ *          called for them. Earlier versions called the callback for each
+ *          message right after sending it to the pipes. Messages of other
+ *          types are not batched, and the order of all callbacks is always
+ *          the order in which the messages arrived.
  */
 class MIDI_Callbacks {
   public:
     /// Callback for incoming MIDI Channel Messages (notes, control change,
     /// pitch bend, etc.)
     virtual void onChannelMessage(MIDI_Interface &, ChannelMessage) {}
+    /// Callback for a run of consecutive incoming MIDI Channel Messages, e.g.
+    /// all messages that were read from a single USB or BLE packet.
+    /// Calls @ref onChannelMessage for each message by default.
+    virtual void onChannelMessages(MIDI_Interface &iface,
+                                   const ChannelMessage *messages,
+                                   size_t count) {
+        for (size_t i = 0; i < count; ++i)
+            onChannelMessage(iface, messages[i]);
+    }
     /// Callback for incoming MIDI System Exclusive Messages.
     virtual void onSysExMessage(MIDI_Interface &, SysExMessage) {}
     /// Callback for incoming MIDI System Common Messages.
@@ -55,10 +72,26 @@ class FineGrainedMIDI_Callbacks : public MIDI_Callbacks {
     void onStop(Cable cable);
     void onActiveSensing(Cable cable);
     void onSystemReset(Cable cable);
+    void onChannelMessageBatch(const ChannelMessage *messages, size_t count);
     // clang-format on
     /// @}
 
     void onChannelMessage(MIDI_Interface &, ChannelMessage msg) override {
+        dispatchChannelMessage(msg);
+    }
+
+    /// A run of Channel messages only results in a single call into the
+    /// derived class: by default, @ref onChannelMessageBatch calls the
+    /// individual callbacks for each message (e.g. @ref onNoteOn) without
+    /// any virtual function calls. Derived classes can handle the whole batch
+    /// at once by defining their own `onChannelMessageBatch` function.
+    void onChannelMessages(MIDI_Interface &, const ChannelMessage *messages,
+                           size_t count) override {
+        CRTP(Derived).onChannelMessageBatch(messages, count);
+    }
+
+    /// Call the callback function for the given Channel message.
+    void dispatchChannelMessage(ChannelMessage msg) {
         using MMT = MIDIMessageType;
         switch (msg.getMessageType()) {
             case MMT::None: break;
@@ -224,6 +257,7 @@ class FineGrainedMIDI_Callbacks : public MIDI_Callbacks {
         static_assert(same_return_type_and_arguments(&Derived::onStop, &FineGrainedMIDI_Callbacks::onStop), "Incorrect signature for onStop");
         static_assert(same_return_type_and_arguments(&Derived::onActiveSensing, &FineGrainedMIDI_Callbacks::onActiveSensing), "Incorrect signature for onActiveSensing");
         static_assert(same_return_type_and_arguments(&Derived::onSystemReset, &FineGrainedMIDI_Callbacks::onSystemReset), "Incorrect signature for onSystemReset");
+        static_assert(same_return_type_and_arguments(&Derived::onChannelMessageBatch, &FineGrainedMIDI_Callbacks::onChannelMessageBatch), "Incorrect signature for onChannelMessageBatch");
         // clang-format on
     }
 
@@ -250,5 +284,12 @@ template <class Derived> inline void FineGrainedMIDI_Callbacks<Derived>::onStop(
 template <class Derived> inline void FineGrainedMIDI_Callbacks<Derived>::onActiveSensing(Cable) {}
 template <class Derived> inline void FineGrainedMIDI_Callbacks<Derived>::onSystemReset(Cable) {}
 // clang-format on
+template <class Derived>
+inline void
+FineGrainedMIDI_Callbacks<Derived>::onChannelMessageBatch(
+    const ChannelMessage *messages, size_t count) {
+    for (size_t i = 0; i < count; ++i)
+        dispatchChannelMessage(messages[i]);
+}
 
 END_CS_NAMESPACE
@@ -30,6 +30,15 @@ MIDI_Interface *MIDI_Interface::DefaultMIDI_Interface = nullptr;
 
 // -------------------------------------------------------------------------- //
 
+// Batching outgoing MIDI messages
+
+void MIDI_Interface::flushAllLoopBatches() {
+    for (auto &iface : updatables)
+        DOWN_CAST<MIDI_Interface &>(iface).flushLoopBatch();
+}
+
+// -------------------------------------------------------------------------- //
+
 // Handling incoming MIDI events
 
 void MIDI_Interface::onChannelMessage(ChannelMessage message) {
@@ -38,6 +47,24 @@ void MIDI_Interface::onChannelMessage(ChannelMessage message) {
         callbacks->onChannelMessage(*this, message);
 }
 
+void MIDI_Interface::onChannelMessage(ChannelMessage message,
+                                      ChannelMessageBatch &batch) {
+    sourceMIDItoPipe(message);
+    if (!callbacks)
+        return;
+    if (batch.full())
+        flushChannelMessages(batch);
+    batch.push(message);
+}
+
+void MIDI_Interface::flushChannelMessages(ChannelMessageBatch &batch) {
+    if (batch.empty())
+        return;
+    if (callbacks)
+        callbacks->onChannelMessages(*this, batch.data(), batch.size());
+    batch.clear();
+}
+
 void MIDI_Interface::onSysExMessage(SysExMessage message) {
     sourceMIDItoPipe(message);
     if (callbacks)
@@ -49,6 +49,19 @@ class MIDI_Interface : public TrueMIDI_SinkSource,
 
     /// @}
 
+    /// @name   Batching outgoing MIDI messages
+    /// @{
+
+    /// Send the messages that were batched during the current iteration of the
+    /// main loop (see e.g. @ref GenericUSBMIDI_Interface::sendOncePerLoop()).
+    /// Has no effect for interfaces that don't batch their messages per loop.
+    virtual void flushLoopBatch() {}
+    /// Call @ref flushLoopBatch() for all MIDI interfaces. This is done at the
+    /// end of @ref Control_Surface_::loop().
+    static void flushAllLoopBatches();
+
+    /// @}
+
     /// @name   MIDI Input Callbacks
     /// @{
 
@@ -109,6 +122,31 @@ class MIDI_Interface : public TrueMIDI_SinkSource,
     /// pipe.
     void onRealTimeMessage(RealTimeMessage message);
 
+    /// Consecutive incoming MIDI Channel messages that haven't been passed to
+    /// the callbacks yet.
+    class ChannelMessageBatch {
+      public:
+        ChannelMessageBatch() {} // Messages are left uninitialized
+        void push(ChannelMessage msg) { messages[count++] = msg; }
+        void clear() { count = 0; }
+        bool empty() const { return count == 0; }
+        bool full() const { return count == MIDI_CALLBACK_BATCH_SIZE; }
+        const ChannelMessage *data() const { return messages; }
+        uint8_t size() const { return count; }
+
+      private:
+        union {
+            ChannelMessage messages[MIDI_CALLBACK_BATCH_SIZE];
+        };
+        uint8_t count = 0;
+    };
+    /// Send the channel message to the sink pipe, and add it to the batch for
+    /// the callbacks.
+    void onChannelMessage(ChannelMessage message, ChannelMessageBatch &batch);
+    /// Call the batched channel message callback for all messages in the
+    /// batch, and clear it.
+    void flushChannelMessages(ChannelMessageBatch &batch);
+
   public:
     /// Read, parse and dispatch incoming MIDI messages on the given interface.
     template <class MIDIInterface_t>
@@ -116,6 +154,12 @@ class MIDI_Interface : public TrueMIDI_SinkSource,
     /// Dispatch the given type of MIDI message from the given interface.
     template <class MIDIInterface_t>
     static void dispatchIncoming(MIDIInterface_t *iface, MIDIReadEvent event);
+    /// Dispatch the given type of MIDI message from the given interface,
+    /// collecting consecutive Channel messages in the given batch (if not
+    /// null).
+    template <class MIDIInterface_t>
+    static void dispatchIncoming(MIDIInterface_t *iface, MIDIReadEvent event,
+                                 ChannelMessageBatch *batch);
 #if !DISABLE_PIPES
     /// Un-stall the given MIDI interface. Assumes the interface has been
     /// stalled because of a chunked SysEx messages. Waits until that message
@@ -125,6 +169,20 @@ class MIDI_Interface : public TrueMIDI_SinkSource,
     using MIDIStaller::handleStall;
 #endif
 
+  private:
+    /// Read and dispatch incoming MIDI messages, starting with the given
+    /// event, collecting consecutive Channel messages in the given batch (if
+    /// not null).
+    template <class MIDIInterface_t>
+    static void readIncoming(MIDIInterface_t *iface, MIDIReadEvent event,
+                             ChannelMessageBatch *batch);
+    /// @ref readIncoming with a batch for the callbacks. Not inlined, so the
+    /// batch only takes up stack space if there are callbacks.
+    template <class MIDIInterface_t>
+    static void updateIncomingBatched(MIDIInterface_t *iface,
+                                      MIDIReadEvent event)
+        __attribute__((noinline));
+
   private:
     MIDI_Callbacks *callbacks = nullptr;
 
@@ -134,22 +192,43 @@ class MIDI_Interface : public TrueMIDI_SinkSource,
 
 template <class MIDIInterface_t>
 void MIDI_Interface::updateIncoming(MIDIInterface_t *self) {
-#if DISABLE_PIPES
-    MIDIReadEvent event = self->read();
-    while (event != MIDIReadEvent::NO_MESSAGE) {
-        dispatchIncoming(self, event);
-        event = self->read();
-    }
-#else
     MIDIReadEvent event = self->read();
     if (event == MIDIReadEvent::NO_MESSAGE)
         return;
+#if !DISABLE_PIPES
     if (self->getStaller() == self)
         self->unstall(self);
+#endif
+    // Only reserve stack space for the batch if there are callbacks to pass it
+    // to
+    if (self->callbacks)
+        updateIncomingBatched(self, event);
+    else
+        readIncoming(self, event, nullptr);
+}
+
+template <class MIDIInterface_t>
+void MIDI_Interface::updateIncomingBatched(MIDIInterface_t *self,
+                                           MIDIReadEvent event) {
+    ChannelMessageBatch batch;
+    readIncoming(self, event, &batch);
+}
+
+template <class MIDIInterface_t>
+void MIDI_Interface::readIncoming(MIDIInterface_t *self, MIDIReadEvent event,
+                                  ChannelMessageBatch *batch) {
+#if DISABLE_PIPES
+    while (event != MIDIReadEvent::NO_MESSAGE) {
+        dispatchIncoming(self, event, batch);
+        event = self->read();
+    }
+    if (batch)
+        self->flushChannelMessages(*batch);
+#else
     int16_t size_rem = 512 * 3 / 4; // Don't keep on reading for too long
     bool chunked = false; // Whether there's an unterminated SysEx chunk
     while (event != MIDIReadEvent::NO_MESSAGE) {
-        dispatchIncoming(self, event);
+        dispatchIncoming(self, event, batch);
         if (event == MIDIReadEvent::SYSEX_CHUNK) {
             size_rem -= self->getSysExMessage().length;
             chunked = true;
@@ -163,6 +242,8 @@ void MIDI_Interface::updateIncoming(MIDIInterface_t *self) {
             break;
         event = self->read();
     }
+    if (batch)
+        self->flushChannelMessages(*batch);
     if (chunked)
         self->stall(self);
 #endif
@@ -193,6 +274,21 @@ void MIDI_Interface::dispatchIncoming(MIDIInterface_t *self,
     }
 }
 
+template <class MIDIInterface_t>
+void MIDI_Interface::dispatchIncoming(MIDIInterface_t *self,
+                                      MIDIReadEvent event,
+                                      ChannelMessageBatch *batch) {
+    if (!batch) {
+        dispatchIncoming(self, event);
+    } else if (event == MIDIReadEvent::CHANNEL_MESSAGE) {
+        self->onChannelMessage(self->getChannelMessage(), *batch);
+    } else {
+        // Keep the callbacks in the order in which the messages arrived
+        self->flushChannelMessages(*batch);
+        dispatchIncoming(self, event);
+    }
+}
+
 #if !DISABLE_PIPES
 template <class MIDIInterface_t>
 void MIDI_Interface::handleStall(MIDIInterface_t *self) {
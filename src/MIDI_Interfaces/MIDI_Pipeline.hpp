@@ -0,0 +1,250 @@
+#pragma once
+
+#include <Settings/SettingsWrapper.hpp>
+#if !DISABLE_PIPES
+
+#include "MIDI_Pipes.hpp"
+#include <AH/STL/cstddef>
+#include <AH/STL/type_traits>
+
+BEGIN_CS_NAMESPACE
+
+/// Stages that can be combined into a @ref MIDI_Pipeline.
+///
+/// A stage is a class with a `map` member function for every message type
+/// (@ref ChannelMessage, @ref SysExMessage, @ref SysCommonMessage and
+/// @ref RealTimeMessage). It takes the message by reference, so it can modify
+/// it, and returns false to drop the message. Custom stages can inherit from
+/// @ref MIDI_Stages::PassThrough and only overload `map` for the message types
+/// they care about.
+///
+/// @ingroup MIDI_Routing
+namespace MIDI_Stages {
+
+/// Stage that passes on all messages unchanged. Use it as a base class for
+/// custom stages, and add `using PassThrough::map;` to keep the overloads for
+/// the message types you don't handle.
+struct PassThrough {
+    template <class Message>
+    bool map(Message &) {
+        return true;
+    }
+};
+
+/// Only pass on Channel messages on the given channel. All other messages are
+/// passed on unchanged.
+/// @tparam Ch  The MIDI channel [1, 16].
+template <uint8_t Ch>
+struct ChannelFilter : PassThrough {
+    static_assert(Ch >= 1 && Ch <= 16, "Channel should be in [1, 16]");
+    using PassThrough::map;
+    bool map(ChannelMessage &msg) {
+        return msg.getChannel() == Channel::createChannel(Ch);
+    }
+};
+
+/// Only pass on Channel messages of the given types (e.g.
+/// `MIDIMessageType::NoteOn`). All other messages are passed on unchanged.
+template <MIDIMessageType... Types>
+struct MessageTypeFilter : PassThrough {
+    static_assert(sizeof...(Types) > 0, "At least one type is required");
+    using PassThrough::map;
+    bool map(ChannelMessage &msg) {
+        const MIDIMessageType types[] {Types...};
+        for (MIDIMessageType type : types)
+            if (msg.getMessageType() == type)
+                return true;
+        return false;
+    }
+};
+
+/// Drop all messages of the given types (e.g. `SysExMessage`).
+template <class... Messages>
+struct Drop {
+    template <class Message>
+    bool map(Message &) {
+        return !isOneOf<Message, Messages...>();
+    }
+
+  private:
+    template <class Message>
+    static constexpr bool isOneOf() {
+        return false;
+    }
+    template <class Message, class First, class... Rest>
+    static constexpr bool isOneOf() {
+        return std::is_same<Message, First>::value ||
+               isOneOf<Message, Rest...>();
+    }
+};
+
+/// Set the channel of all Channel messages.
+/// @tparam Ch  The new MIDI channel [1, 16].
+template <uint8_t Ch>
+struct SetChannel : PassThrough {
+    static_assert(Ch >= 1 && Ch <= 16, "Channel should be in [1, 16]");
+    using PassThrough::map;
+    bool map(ChannelMessage &msg) {
+        msg.setChannel(Channel::createChannel(Ch));
+        return true;
+    }
+};
+
+/// Transpose the Note On, Note Off and Key Pressure messages by the given
+/// number of semitones. Notes that fall outside of the MIDI range [0, 127]
+/// after transposing are dropped.
+template <int8_t Semitones>
+struct Transpose : PassThrough {
+    using PassThrough::map;
+    bool map(ChannelMessage &msg) {
+        auto type = msg.getMessageType();
+        if (type != MIDIMessageType::NoteOff &&
+            type != MIDIMessageType::NoteOn &&
+            type != MIDIMessageType::KeyPressure)
+            return true;
+        int16_t note = int16_t(msg.data1) + Semitones;
+        if (note < 0 || note > 0x7F)
+            return false;
+        msg.data1 = uint8_t(note);
+        return true;
+    }
+};
+
+/// Move all messages (of any type) on cable @p From to cable @p To.
+/// Messages on other cables are passed on unchanged.
+/// @tparam From    The original USB MIDI cable number [1, 16].
+/// @tparam To      The new USB MIDI cable number [1, 16].
+template <uint8_t From, uint8_t To>
+struct CableRemap {
+    static_assert(From >= 1 && From <= 16 && To >= 1 && To <= 16,
+                  "Cable should be in [1, 16]");
+    template <class Message>
+    bool map(Message &msg) {
+        if (msg.cable == Cable::createCable(From))
+            msg.cable = Cable::createCable(To);
+        return true;
+    }
+};
+
+/// A sequence of stages, applied one after the other.
+template <class... Stages>
+struct Chain;
+
+template <>
+struct Chain<> {
+    template <class Message>
+    bool map(Message &) {
+        return true;
+    }
+};
+
+template <class First, class... Rest>
+struct Chain<First, Rest...> {
+    template <class Message>
+    bool map(Message &msg) {
+        return first.map(msg) && rest.map(msg);
+    }
+
+    First first;
+    Chain<Rest...> rest;
+};
+
+/// Get the type of and a reference to the stage with index @p I in a
+/// @ref Chain.
+template <size_t I, class C>
+struct ChainElement;
+
+template <class First, class... Rest>
+struct ChainElement<0, Chain<First, Rest...>> {
+    using type = First;
+    static type &get(Chain<First, Rest...> &chain) { return chain.first; }
+};
+
+template <size_t I, class First, class... Rest>
+struct ChainElement<I, Chain<First, Rest...>> {
+    using Next = ChainElement<I - 1, Chain<Rest...>>;
+    using type = typename Next::type;
+    static type &get(Chain<First, Rest...> &chain) {
+        return Next::get(chain.rest);
+    }
+};
+
+} // namespace MIDI_Stages
+
+/**
+ * @brief   A MIDI pipe that maps and filters messages using a sequence of
+ *          stages that is fixed at compile time.
+ *
+ * Unlike a custom @ref MIDI_Pipe with a hand-written @ref
+ * MIDI_Pipe::mapForwardMIDI "mapForwardMIDI()", the behavior of the pipeline
+ * is composed from small, reusable stages (see @ref MIDI_Stages). Since the
+ * stages are template arguments, the compiler can inline all of them into a
+ * single function per message type: a message only goes through one virtual
+ * call, no matter how many stages the pipeline has.
+ *
+ * A pipeline is a normal MIDI pipe, so it can be connected to MIDI sources
+ * and sinks using the `>>` and `<<` operators, it supports “through”
+ * connections, and it can be stalled like any other pipe.
+ *
+ * Usage:
+ *
+ * ~~~cpp
+ * USBMIDI_Interface usbmidi;
+ * HardwareSerialMIDI_Interface serialmidi {Serial1};
+ *
+ * using namespace MIDI_Stages;
+ * // Forward only channel 1, transposed up an octave, to cable 2
+ * MIDI_Pipeline<ChannelFilter<1>, Transpose<+12>, CableRemap<1, 2>> pipeline;
+ *
+ * void setup() {
+ *     serialmidi >> pipeline >> usbmidi;
+ *     MIDI_Interface::beginAll();
+ * }
+ * ~~~
+ *
+ * @tparam  Stages
+ *          The stages that are applied to each message, from left to right.
+ *          As soon as a stage drops a message, the next stages are skipped.
+ *
+ * @ingroup MIDI_Routing
+ */
+template <class... Stages>
+class MIDI_Pipeline : public MIDI_Pipe {
+  private:
+    using Chain = MIDI_Stages::Chain<Stages...>;
+    template <size_t I>
+    using Element = MIDI_Stages::ChainElement<I, Chain>;
+
+  public:
+    /// Get the stage with index @p I, e.g. to change its settings at run time.
+    template <size_t I>
+    typename Element<I>::type &getStage() {
+        return Element<I>::get(stages);
+    }
+
+    /// Apply all stages to the given message.
+    /// @return False if the message was dropped by one of the stages.
+    template <class Message>
+    bool map(Message &msg) {
+        return stages.map(msg);
+    }
+
+  private:
+    void mapForwardMIDI(ChannelMessage msg) final { forward(msg); }
+    void mapForwardMIDI(SysExMessage msg) final { forward(msg); }
+    void mapForwardMIDI(SysCommonMessage msg) final { forward(msg); }
+    void mapForwardMIDI(RealTimeMessage msg) final { forward(msg); }
+
+    template <class Message>
+    void forward(Message msg) {
+        if (stages.map(msg))
+            sourceMIDItoSink(msg);
+    }
+
+  private:
+    Chain stages;
+};
+
+END_CS_NAMESPACE
+
+#endif
@@ -190,15 +190,22 @@ void MIDI_Source::handleStallers() const {
 
 // :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::: //
 
+bool MIDI_Pipe::routingCacheEnabled = false;
+uint32_t MIDI_Pipe::routingGeneration = 0;
+
 void MIDI_Pipe::connectSink(MIDI_Sink *sink) {
     if (this->sink != nullptr) {
         FATAL_ERROR(F("This pipe is already connected to a sink"), 0x9145);
         return; // LCOV_EXCL_LINE
     }
     this->sink = sink;
+    invalidateRoutingCache();
 }
 
-void MIDI_Pipe::disconnectSink() { this->sink = nullptr; }
+void MIDI_Pipe::disconnectSink() {
+    this->sink = nullptr;
+    invalidateRoutingCache();
+}
 
 void MIDI_Pipe::connectSource(MIDI_Source *source) {
     if (this->source != nullptr) {
@@ -206,9 +213,13 @@ void MIDI_Pipe::connectSource(MIDI_Source *source) {
         return; // LCOV_EXCL_LINE
     }
     this->source = source;
+    invalidateRoutingCache();
 }
 
-void MIDI_Pipe::disconnectSource() { this->source = nullptr; }
+void MIDI_Pipe::disconnectSource() {
+    this->source = nullptr;
+    invalidateRoutingCache();
+}
 
 void MIDI_Pipe::disconnect() {
     if (hasSink() && hasThroughIn()) {
@@ -418,6 +418,28 @@ class MIDI_Pipe : private MIDI_Sink, private MIDI_Source {
 
     /// @}
 
+  public:
+    /// @name Routing cache
+    /// @{
+
+    /// Enable or disable the routing cache of all pipes. When enabled, each
+    /// pipe remembers the sink its messages eventually arrive at, so they
+    /// are delivered to it directly, instead of being forwarded through the
+    /// “through” inputs of all other pipes that sink to the same sink.
+    /// Disabled by default.
+    static void setRoutingCacheEnabled(bool enabled) {
+        routingCacheEnabled = enabled;
+        invalidateRoutingCache();
+    }
+    /// Check whether the routing cache is enabled.
+    static bool isRoutingCacheEnabled() { return routingCacheEnabled; }
+    /// Mark the cached routes of all pipes as outdated, they will be resolved
+    /// again before sending the next message. Called automatically when pipes
+    /// are connected or disconnected, and when sinks or sources are moved.
+    static void invalidateRoutingCache() { ++routingGeneration; }
+
+    /// @}
+
   public:
     /// @name Check connections
     /// @{
@@ -519,8 +541,20 @@ class MIDI_Pipe : private MIDI_Sink, private MIDI_Source {
     /// Useful when overriding @ref mapForwardMIDI.
     template <class Message>
     void sourceMIDItoSink(Message msg) {
-        if (hasSink())
-            sink->sinkMIDIfromPipe(msg);
+        MIDI_Sink *target = routingCacheEnabled ? getCachedFinalSink() : sink;
+        if (target != nullptr)
+            target->sinkMIDIfromPipe(msg);
+    }
+
+  private:
+    /// Get the final sink of this pipe from the routing cache, resolving it
+    /// first if the connections changed since it was cached.
+    MIDI_Sink *getCachedFinalSink() {
+        if (cachedGeneration != routingGeneration) {
+            cachedFinalSink = getFinalSink();
+            cachedGeneration = routingGeneration;
+        }
+        return cachedFinalSink;
     }
 
   protected:
@@ -582,6 +616,11 @@ class MIDI_Pipe : private MIDI_Sink, private MIDI_Source {
     MIDI_Source *source = nullptr;
     MIDIStaller *sink_staller = nullptr;
     MIDIStaller *through_staller = nullptr;
+    MIDI_Sink *cachedFinalSink = nullptr;
+    uint32_t cachedGeneration = 0;
+
+    static bool routingCacheEnabled;
+    static uint32_t routingGeneration;
 
     friend class MIDI_Sink;
     friend class MIDI_Source;
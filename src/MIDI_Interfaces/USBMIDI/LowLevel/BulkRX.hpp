@@ -16,6 +16,11 @@ struct BulkRX {
     /// Try reading a single message.
     /// @return Whether a message was available.
     bool read(MessageType &message);
+    /// Try reading multiple messages at once. Messages are copied from the
+    /// received packets in bulk, and there is only one synchronization with
+    /// the USB interrupt handler per packet (rather than per message).
+    /// @return The number of messages read, at most @p max_num.
+    uint32_t read(MessageType *messages, uint32_t max_num);
 
   protected:
     void reset(uint16_t packet_size = MaxPacketSize);
@@ -55,6 +60,11 @@ struct BulkRX {
     } reading;
     using rbuffer_t = std::remove_reference_t<decltype(reading.buffers[0])>;
 
+  private:
+    /// Release the current read buffer after all messages have been read from
+    /// it, and restart reading if the queue was full.
+    void pop_read_buffer();
+
   protected:
     void rx_callback(uint32_t num_bytes_read);
 };
@@ -43,22 +43,56 @@ bool BulkRX<Derived, MessageTypeT, MaxPacketSizeV>::read(MessageType &message) {
     CS_MIDI_USB_ASSERT(reading.packet_size % sizeof(MessageType) == 0);
     read_buffer.index += sizeof(MessageType);
     // If we've read all messages from this buffer
-    if (read_buffer.index == read_buffer.size) {
-        // Increment the read index (and wrap around)
-        r = (r + 1 == NumRxPackets) ? 0 : r + 1;
-        reading.read_idx = r;
-        reading.available.fetch_sub(1, mo_rel);
-        // There is now space in the queue
-        // Check if the next read is already in progress
-        if (reading.reading.exchange(true, mo_acq) == false) {
-            // If not, start the next read now
-            uint32_t w = reading.write_idx.load(mo_rlx);
-            CRTP(Derived).rx_start(reading.buffers[w].buffer,
-                                   reading.packet_size);
+    if (read_buffer.index == read_buffer.size)
+        pop_read_buffer();
+
+    return true;
+}
+
+template <class Derived, class MessageTypeT, uint16_t MaxPacketSizeV>
+uint32_t
+BulkRX<Derived, MessageTypeT, MaxPacketSizeV>::read(MessageType *messages,
+                                                    uint32_t max_num) {
+    // Check how many buffers are available for reading. Buffers that are
+    // received while we're reading will be read during the next call.
+    uint32_t available = reading.available.load(mo_acq);
+    uint32_t num_read = 0;
+    while (available > 0 && num_read < max_num) {
+        // Get the buffer with received data
+        rbuffer_t &read_buffer = reading.buffers[reading.read_idx];
+        // Copy as many messages as possible (data is at least as new as
+        // available)
+        uint32_t num_avail =
+            (read_buffer.size - read_buffer.index) / sizeof(MessageType);
+        uint32_t num_left = max_num - num_read;
+        uint32_t n = num_avail < num_left ? num_avail : num_left;
+        memcpy(messages + num_read, &read_buffer.buffer[read_buffer.index],
+               n * sizeof(MessageType));
+        read_buffer.index += n * sizeof(MessageType);
+        num_read += n;
+        // If we've read all messages from this buffer
+        if (read_buffer.index == read_buffer.size) {
+            pop_read_buffer();
+            --available;
         }
     }
+    return num_read;
+}
 
-    return true;
+template <class Derived, class MessageTypeT, uint16_t MaxPacketSizeV>
+void BulkRX<Derived, MessageTypeT, MaxPacketSizeV>::pop_read_buffer() {
+    // Increment the read index (and wrap around)
+    uint32_t r = reading.read_idx;
+    r = (r + 1 == NumRxPackets) ? 0 : r + 1;
+    reading.read_idx = r;
+    reading.available.fetch_sub(1, mo_rel);
+    // There is now space in the queue
+    // Check if the next read is already in progress
+    if (reading.reading.exchange(true, mo_acq) == false) {
+        // If not, start the next read now
+        uint32_t w = reading.write_idx.load(mo_rlx);
+        CRTP(Derived).rx_start(reading.buffers[w].buffer, reading.packet_size);
+    }
 }
 
 template <class Derived, class MessageTypeT, uint16_t MaxPacketSizeV>
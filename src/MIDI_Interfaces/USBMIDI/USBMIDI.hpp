@@ -36,6 +36,45 @@ inline uint32_t bytes_to_u32(AH::Array<uint8_t, 4> b) {
            (uint32_t(b.data[3]) << 24);  //
 }
 
+/// Write multiple 4-byte packets to a backend that accepts an array of 32-bit
+/// words (e.g. @ref BulkTX), converting them in small chunks on the stack.
+template <class Backend>
+void write_u32_packets(Backend &backend, const AH::Array<uint8_t, 4> *packets,
+                       uint32_t num_packets) {
+    constexpr uint32_t chunk_size = 16;
+    uint32_t words[chunk_size];
+    while (num_packets > 0) {
+        uint32_t n = num_packets < chunk_size ? num_packets : chunk_size;
+        for (uint32_t i = 0; i < n; ++i)
+            words[i] = bytes_to_u32(packets[i]);
+        backend.write(words, n);
+        packets += n;
+        num_packets -= n;
+    }
+}
+
+/// Read multiple 4-byte packets from a backend that reads an array of 32-bit
+/// words (e.g. @ref BulkRX), converting them in small chunks on the stack.
+/// @return The number of packets read, at most @p max_packets.
+template <class Backend>
+uint32_t read_u32_packets(Backend &backend, AH::Array<uint8_t, 4> *packets,
+                          uint32_t max_packets) {
+    constexpr uint32_t chunk_size = 16;
+    uint32_t words[chunk_size];
+    uint32_t num_read = 0;
+    while (num_read < max_packets) {
+        uint32_t num_left = max_packets - num_read;
+        uint32_t n = num_left < chunk_size ? num_left : chunk_size;
+        uint32_t r = backend.read(words, n);
+        for (uint32_t i = 0; i < r; ++i)
+            packets[num_read + i] = u32_to_bytes(words[i]);
+        num_read += r;
+        if (r < n)
+            break;
+    }
+    return num_read;
+}
+
 END_CS_NAMESPACE
 
 #ifdef ARDUINO
@@ -8,7 +8,13 @@ BEGIN_CS_NAMESPACE
 struct Arduino_mbed_USBDeviceMIDIBackend {
     using MIDIUSBPacket_t = AH::Array<uint8_t, 4>;
     MIDIUSBPacket_t read() { return u32_to_bytes(backend.read()); }
+    uint32_t read(MIDIUSBPacket_t *data, uint32_t num) {
+        return read_u32_packets(backend, data, num);
+    }
     void write(MIDIUSBPacket_t data) { backend.write(bytes_to_u32(data)); }
+    void write(const MIDIUSBPacket_t *data, uint32_t num) {
+        write_u32_packets(backend, data, num);
+    }
     void sendNow() { backend.send_now(); }
     bool preferImmediateSend() { return false; }
 
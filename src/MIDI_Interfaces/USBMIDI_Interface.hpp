@@ -5,10 +5,34 @@
 #include "USBMIDI_Sender.hpp"
 #include <AH/Error/Error.hpp>
 #include <AH/Teensy/TeensyUSBTypes.hpp>
+#include <Def/TypeTraits.hpp>
 #include <MIDI_Parsers/USBMIDI_Parser.hpp>
 
 BEGIN_CS_NAMESPACE
 
+/// Buffer for outgoing USB MIDI packets that are written to the backend using
+/// a single call. Empty if the backend can only write one packet at a time.
+template <class Packet, bool Enabled>
+struct USBMIDI_PacketBatch {
+    Packet packets[USB_MIDI_BATCH_SIZE];
+    uint8_t size = 0;
+};
+
+template <class Packet>
+struct USBMIDI_PacketBatch<Packet, false> {};
+
+/// Buffer for incoming USB MIDI packets that are read from the backend using
+/// a single call. Empty if the backend can only read one packet at a time.
+template <class Packet, bool Enabled>
+struct USBMIDI_ReceiveBatch {
+    Packet packets[USB_MIDI_BATCH_SIZE];
+    uint8_t index = 0;
+    uint8_t size = 0;
+};
+
+template <class Packet>
+struct USBMIDI_ReceiveBatch<Packet, false> {};
+
 /**
  * @brief   A class for MIDI interfaces sending MIDI messages over a USB MIDI
  *          connection.
@@ -36,7 +60,7 @@ class GenericUSBMIDI_Interface : public MIDI_Interface {
     void sendSysCommonImpl(SysCommonMessage) override;
     void sendSysExImpl(SysExMessage) override;
     void sendRealTimeImpl(RealTimeMessage) override;
-    void sendNowImpl() override { backend.sendNow(); }
+    void sendNowImpl() override;
 
   private:
 #if !DISABLE_PIPES
@@ -76,6 +100,15 @@ class GenericUSBMIDI_Interface : public MIDI_Interface {
     RealTimeMessage getRealTimeMessage() const;
     /// Return the received system exclusive message.
     SysExMessage getSysExMessage() const;
+#if !IGNORE_SYSEX
+    /// Pass on incoming SysEx data as chunks of one USB packet each, instead
+    /// of copying it to a buffer of @ref SYSEX_BUFFER_SIZE bytes. Allows
+    /// receiving messages of any length.
+    /// Use @ref SysExReassembler if you need complete messages.
+    void setSysExStreaming(bool streaming = true) {
+        parser.setSysExStreaming(streaming);
+    }
+#endif
 
     /// @}
 
@@ -87,15 +120,33 @@ class GenericUSBMIDI_Interface : public MIDI_Interface {
     Backend backend;
 
   private:
+    using Packet = typename Backend::MIDIUSBPacket_t;
+    using CanWriteMultiple = has_method_write_multiple<Backend>;
+    using CanReadMultiple = has_method_read_multiple<Backend>;
+
+    /// Read packets from the batch buffer, refilling it from the backend using
+    /// a single call when it's empty.
+    MIDIReadEvent read(std::true_type);
+    /// Read packets from the backend one by one.
+    MIDIReadEvent read(std::false_type);
+
     /// Functor to send USB MIDI packets.
     struct Sender {
         GenericUSBMIDI_Interface *iface;
         void operator()(Cable cn, MIDICodeIndexNumber cin, uint8_t d0,
                         uint8_t d1, uint8_t d2) {
             uint8_t cn_cin = (cn.getRaw() << 4) | uint8_t(cin);
-            iface->backend.write({cn_cin, d0, d1, d2});
+            iface->writePacket({cn_cin, d0, d1, d2}, CanWriteMultiple());
         }
     };
+    /// Write a packet to the batch buffer if sending once per loop, or
+    /// directly to the backend otherwise.
+    void writePacket(Packet packet, std::true_type);
+    /// Write a packet directly to the backend.
+    void writePacket(Packet packet, std::false_type);
+    /// Write all packets in the batch buffer to the backend.
+    void flushBatch(std::true_type);
+    void flushBatch(std::false_type) {}
     /// @}
 
   private:
@@ -105,6 +156,12 @@ class GenericUSBMIDI_Interface : public MIDI_Interface {
     USBMIDI_Sender sender;
     /// @see neverSendImmediately()
     bool alwaysSendImmediately_ = true;
+    /// @see sendOncePerLoop()
+    bool sendOncePerLoop_ = false;
+    /// Packets waiting to be written to the backend.
+    USBMIDI_PacketBatch<Packet, CanWriteMultiple::value> batch;
+    /// Packets that were received but not yet parsed.
+    USBMIDI_ReceiveBatch<Packet, CanReadMultiple::value> rxBatch;
 
   public:
     /// @name   Buffering USB packets
@@ -121,10 +178,38 @@ class GenericUSBMIDI_Interface : public MIDI_Interface {
     /// messages can be transmitted in a single USB packet. This is more
     /// efficient and results in a higher maximum bandwidth, but it could
     /// increase latency when used incorrectly.
-    void neverSendImmediately() { alwaysSendImmediately_ = false; }
+    /// Packets that were collected by @ref sendOncePerLoop() are handed to the
+    /// backend first.
+    void neverSendImmediately() {
+        flushBatch(CanWriteMultiple());
+        alwaysSendImmediately_ = false;
+        sendOncePerLoop_ = false;
+    }
     /// Send the USB packets immediately after sending a MIDI message.
+    /// Packets that were collected by @ref sendOncePerLoop() are sent first.
     /// @see @ref neverSendImmediately()
-    void alwaysSendImmediately() { alwaysSendImmediately_ = true; }
+    void alwaysSendImmediately() {
+        if (sendOncePerLoop_)
+            sendNowImpl();
+        alwaysSendImmediately_ = true;
+        sendOncePerLoop_ = false;
+    }
+    /// Collect all MIDI messages sent during one iteration of
+    /// @ref Control_Surface_::loop() and send them together at the end of the
+    /// loop. If the backend supports it, the USB packets are handed to it
+    /// using a single write of up to @ref USB_MIDI_BATCH_SIZE packets.
+    /// When not using Control Surface, call @ref sendNow() at the end of your
+    /// loop instead.
+    void sendOncePerLoop() {
+        alwaysSendImmediately_ = false;
+        sendOncePerLoop_ = true;
+    }
+    /// Check if this USB interface sends its USB packets once per loop.
+    /// @see @ref sendOncePerLoop()
+    bool sendsOncePerLoop() const { return sendOncePerLoop_; }
+    /// Send all packets if sending once per loop, called by
+    /// @ref Control_Surface_::loop().
+    void flushLoopBatch() override;
 
     /// @}
 };
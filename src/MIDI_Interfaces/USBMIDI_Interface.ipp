@@ -8,6 +8,11 @@ BEGIN_CS_NAMESPACE
 
 template <class Backend>
 MIDIReadEvent GenericUSBMIDI_Interface<Backend>::read() {
+    return read(CanReadMultiple());
+}
+
+template <class Backend>
+MIDIReadEvent GenericUSBMIDI_Interface<Backend>::read(std::false_type) {
     auto pullpacket = [this](typename Backend::MIDIUSBPacket_t &packet) {
         packet = backend.read();
         return packet[0] != 0x00;
@@ -15,6 +20,22 @@ MIDIReadEvent GenericUSBMIDI_Interface<Backend>::read() {
     return parser.pull(LambdaPuller(std::move(pullpacket)));
 }
 
+template <class Backend>
+MIDIReadEvent GenericUSBMIDI_Interface<Backend>::read(std::true_type) {
+    auto pullpacket = [this](typename Backend::MIDIUSBPacket_t &packet) {
+        // If all received packets have been parsed, get new ones
+        if (rxBatch.index == rxBatch.size) {
+            rxBatch.index = 0;
+            rxBatch.size = backend.read(rxBatch.packets, USB_MIDI_BATCH_SIZE);
+            if (rxBatch.size == 0)
+                return false;
+        }
+        packet = rxBatch.packets[rxBatch.index++];
+        return true;
+    };
+    return parser.pull(LambdaPuller(std::move(pullpacket)));
+}
+
 template <class Backend>
 void GenericUSBMIDI_Interface<Backend>::begin() {
 #ifndef __SAM3X8E__ // Due compiler too old, doesn't support begin_if_possible()
@@ -84,4 +105,43 @@ void GenericUSBMIDI_Interface<Backend>::sendRealTimeImpl(RealTimeMessage msg) {
         backend.sendNow();
 }
 
+template <class Backend>
+void GenericUSBMIDI_Interface<Backend>::sendNowImpl() {
+    flushBatch(CanWriteMultiple());
+    backend.sendNow();
+}
+
+template <class Backend>
+void GenericUSBMIDI_Interface<Backend>::flushLoopBatch() {
+    if (sendOncePerLoop_)
+        sendNowImpl();
+}
+
+// Batching USB packets
+// -----------------------------------------------------------------------------
+
+template <class Backend>
+void GenericUSBMIDI_Interface<Backend>::writePacket(Packet packet,
+                                                    std::true_type) {
+    if (!sendOncePerLoop_)
+        return backend.write(packet);
+    if (batch.size == USB_MIDI_BATCH_SIZE)
+        flushBatch(std::true_type());
+    batch.packets[batch.size++] = packet;
+}
+
+template <class Backend>
+void GenericUSBMIDI_Interface<Backend>::writePacket(Packet packet,
+                                                    std::false_type) {
+    backend.write(packet);
+}
+
+template <class Backend>
+void GenericUSBMIDI_Interface<Backend>::flushBatch(std::true_type) {
+    if (batch.size == 0)
+        return;
+    backend.write(batch.packets, batch.size);
+    batch.size = 0;
+}
+
 END_CS_NAMESPACE
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <AH/Hardware/Button.hpp>
+#include <AH/Hardware/ButtonBank.hpp>
 #include <Def/Def.hpp>
 #include <MIDI_Outputs/Abstract/MIDIOutputElement.hpp>
 
@@ -11,9 +12,16 @@ BEGIN_CS_NAMESPACE
  *
  * The buttons are debounced.
  *
+ * @tparam  Buttons
+ *          The type of the collection of buttons: either an array of
+ *          individual @ref AH::Button%s, or an @ref AH::ButtonBank that reads
+ *          and debounces all buttons at once.
+ *
  * @see     Button
+ * @see     ButtonBank
  */
-template <class Sender, uint8_t NumButtons>
+template <class Sender, uint8_t NumButtons,
+          class Buttons = Array<AH::Button, NumButtons>>
 class MIDIButtons : public MIDIOutputElement {
   protected:
     /**
@@ -21,32 +29,18 @@ class MIDIButtons : public MIDIOutputElement {
      *
      * @todo    Documentation
      */
-    MIDIButtons(const Array<AH::Button, NumButtons> &buttons,
+    MIDIButtons(const Buttons &buttons,
                 MIDIAddress baseAddress, RelativeMIDIAddress incrementAddress,
                 const Sender &sender)
         : buttons(buttons), baseAddress(baseAddress),
           incrementAddress(incrementAddress), sender(sender) {}
 
   public:
-    void begin() final override {
-        for (auto &button : buttons)
-            button.begin();
-    }
-    void update() final override {
-        MIDIAddress address = baseAddress;
-        for (auto &button : buttons) {
-            AH::Button::State state = button.update();
-            if (state == AH::Button::Falling) {
-                sender.sendOn(address);
-            } else if (state == AH::Button::Rising) {
-                sender.sendOff(address);
-            }
-            address += incrementAddress;
-        }
-    }
+    void begin() final override { beginButtons(buttons); }
+    void update() final override { updateButtons(buttons); }
 
     AH::Button::State getButtonState(size_t index) const {
-        return buttons[index].getState();
+        return getButtonState(buttons, index);
     }
 
     /// Get the MIDI base address.
@@ -69,13 +63,79 @@ class MIDIButtons : public MIDIOutputElement {
     }
 
     /// @see @ref AH::Button::invert()
-    void invert() {
+    void invert() { invertButtons(buttons); }
+
+  private:
+    /// @name   Individual buttons
+    /// @{
+
+    static void beginButtons(Array<AH::Button, NumButtons> &buttons) {
+        for (auto &button : buttons)
+            button.begin();
+    }
+    void updateButtons(Array<AH::Button, NumButtons> &buttons) {
+        MIDIAddress address = baseAddress;
+        for (auto &button : buttons) {
+            AH::Button::State state = button.update();
+            if (state == AH::Button::Falling) {
+                sender.sendOn(address);
+            } else if (state == AH::Button::Rising) {
+                sender.sendOff(address);
+            }
+            address += incrementAddress;
+        }
+    }
+    static AH::Button::State
+    getButtonState(const Array<AH::Button, NumButtons> &buttons,
+                   size_t index) {
+        return buttons[index].getState();
+    }
+    static void invertButtons(Array<AH::Button, NumButtons> &buttons) {
         for (auto &button : buttons)
             button.invert();
     }
 
+    /// @}
+
+    /// @name   Bank of buttons
+    /// @{
+
+    static void beginButtons(AH::ButtonBank<NumButtons> &bank) {
+        bank.begin();
+    }
+    void updateButtons(AH::ButtonBank<NumButtons> &bank) {
+        // Only walk over the buttons if any of them changed state
+        if (!bank.update())
+            return;
+        using word_t = typename AH::ButtonBank<NumButtons>::word_t;
+        constexpr uint8_t WordBits = AH::ButtonBank<NumButtons>::WordBits;
+        MIDIAddress address = baseAddress;
+        for (uint16_t w = 0; w < bank.NumWords; ++w) {
+            word_t pressed = bank.getPressedEdges(w);
+            word_t released = bank.getReleasedEdges(w);
+            for (uint8_t i = 0; i < WordBits && w * WordBits + i < NumButtons;
+                 ++i) {
+                word_t mask = word_t(1) << i;
+                if (pressed & mask)
+                    sender.sendOn(address);
+                else if (released & mask)
+                    sender.sendOff(address);
+                address += incrementAddress;
+            }
+        }
+    }
+    static AH::Button::State
+    getButtonState(const AH::ButtonBank<NumButtons> &bank, size_t index) {
+        return bank.getState(index);
+    }
+    static void invertButtons(AH::ButtonBank<NumButtons> &bank) {
+        bank.invert();
+    }
+
+    /// @}
+
   private:
-    Array<AH::Button, NumButtons> buttons;
+    Buttons buttons;
     MIDIAddress baseAddress;
     RelativeMIDIAddress incrementAddress;
 
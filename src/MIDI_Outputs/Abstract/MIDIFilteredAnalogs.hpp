@@ -0,0 +1,137 @@
+#pragma once
+
+#include <AH/Hardware/FilteredAnalogBank.hpp>
+#include <Def/Def.hpp>
+#include <MIDI_Outputs/Abstract/MIDIOutputElement.hpp>
+
+BEGIN_CS_NAMESPACE
+
+/**
+ * @brief   An abstract class for a collection of potentiometers and faders
+ *          that send MIDI events.
+ *
+ * The analog inputs are filtered and hysteresis is applied, using a single
+ * @ref AH::FilteredAnalogBank for all inputs, and only the inputs that
+ * changed are sent.
+ *
+ * @see     FilteredAnalogBank
+ */
+template <class Sender, uint16_t NumInputs>
+class MIDIFilteredAnalogs : public MIDIOutputElement {
+  protected:
+    /**
+     * @brief   Construct a new MIDIFilteredAnalogs.
+     *
+     * @param   analogPins
+     *          The analog input pins with the wipers of the potentiometers
+     *          connected.
+     * @param   baseAddress
+     *          The MIDI address of the first input.
+     * @param   incrementAddress
+     *          The number of addresses to increment for each next input.
+     * @param   sender
+     *          The MIDI sender to use.
+     */
+    MIDIFilteredAnalogs(const Array<pin_t, NumInputs> &analogPins,
+                        MIDIAddress baseAddress,
+                        RelativeMIDIAddress incrementAddress,
+                        const Sender &sender)
+        : filteredAnalogs(analogPins), baseAddress(baseAddress),
+          incrementAddress(incrementAddress), sender(sender) {}
+
+  public:
+    void begin() final override { filteredAnalogs.resetToCurrentValue(); }
+
+    void update() final override {
+        // Only walk over the inputs if any of them changed
+        if (!filteredAnalogs.update())
+            return;
+        using word_t = typename FilteredAnalogBank::word_t;
+        constexpr uint8_t WordBits = FilteredAnalogBank::WordBits;
+        MIDIAddress address = baseAddress;
+        for (uint16_t w = 0; w < FilteredAnalogBank::NumWords; ++w) {
+            word_t changed = filteredAnalogs.getChanged(w);
+            for (uint8_t i = 0; i < WordBits && w * WordBits + i < NumInputs;
+                 ++i) {
+                if (changed & (word_t(1) << i))
+                    sender.send(filteredAnalogs.getValue(w * WordBits + i),
+                                address);
+                address += incrementAddress;
+            }
+        }
+    }
+
+    /// Send the value of the given analog input over MIDI, even if the value
+    /// didn't change.
+    void forcedUpdate(uint16_t index) {
+        sender.send(filteredAnalogs.getValue(index), getAddress(index));
+    }
+
+    /**
+     * @brief   Specify a mapping function that is applied to the raw
+     *          analog values of all inputs before sending.
+     *
+     * @see     MIDIFilteredAnalog::map
+     */
+    void map(MappingFunction fn) { filteredAnalogs.map(fn); }
+
+    /// Invert the analog values of all inputs.
+    void invert() { filteredAnalogs.invert(); }
+
+    /**
+     * @brief   Get the raw value of the given analog input (this is the value
+     *          without applying the filter or the mapping function first).
+     */
+    analog_t getRawValue(uint16_t index) const {
+        return filteredAnalogs.getRawValue(index);
+    }
+
+    /**
+     * @brief   Get the maximum value that can be returned from
+     *          @ref getRawValue.
+     */
+    static constexpr analog_t getMaxRawValue() {
+        return FilteredAnalogBank::getMaxRawValue();
+    }
+
+    /**
+     * @brief   Get the value of the given analog input (this is the value
+     *          after first applying the mapping function).
+     */
+    analog_t getValue(uint16_t index) const {
+        return filteredAnalogs.getValue(index);
+    }
+
+    /// Get the MIDI address of the given input.
+    MIDIAddress getAddress(uint16_t index) const {
+        MIDIAddress address = baseAddress;
+        for (uint16_t i = 0; i < index; ++i)
+            address += incrementAddress;
+        return address;
+    }
+
+    /// Get the MIDI base address.
+    MIDIAddress getBaseAddress() const { return this->baseAddress; }
+    /// Set the MIDI base address.
+    void setBaseAddress(MIDIAddress address) { this->baseAddress = address; }
+    /// Get the MIDI increment address.
+    RelativeMIDIAddress getIncrementAddress() const {
+        return this->incrementAddress;
+    }
+    /// Set the MIDI increment address.
+    void setIncrementAddress(RelativeMIDIAddress address) {
+        this->incrementAddress = address;
+    }
+
+  private:
+    using FilteredAnalogBank =
+        AH::FilteredAnalogBank<NumInputs, Sender::precision()>;
+    FilteredAnalogBank filteredAnalogs;
+    MIDIAddress baseAddress;
+    RelativeMIDIAddress incrementAddress;
+
+  public:
+    Sender sender;
+};
+
+END_CS_NAMESPACE
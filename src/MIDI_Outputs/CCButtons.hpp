@@ -17,11 +17,17 @@ BEGIN_CS_NAMESPACE
  *
  * @tparam  NumButtons
  *          The number of buttons in the collection.
+ * @tparam  Buttons
+ *          The type of the collection of buttons. Use
+ *          @ref AH::ButtonBank "AH::ButtonBank<NumButtons>" to read and
+ *          debounce many buttons connected to an extended IO element at once,
+ *          e.g. `CCButtons<16, AH::ButtonBank<16>> buttons {{mcp, 0}, ...};`
  *
  * @ingroup MIDIOutputElements
  */
-template <uint8_t NumButtons>
-class CCButtons : public MIDIButtons<DigitalCCSender, NumButtons> {
+template <uint8_t NumButtons,
+          class Buttons = Array<AH::Button, NumButtons>>
+class CCButtons : public MIDIButtons<DigitalCCSender, NumButtons, Buttons> {
   public:
     /**
      * @brief   Create a new CCButtons object with the given pins,
@@ -42,11 +48,11 @@ class CCButtons : public MIDIButtons<DigitalCCSender, NumButtons> {
      * @param   sender
      *          The MIDI sender to use.
      */
-    CCButtons(const Array<AH::Button, NumButtons> &buttons,
+    CCButtons(const Buttons &buttons,
               MIDIAddress baseAddress, RelativeMIDIAddress incrementAddress,
               const DigitalCCSender &sender = {})
-        : MIDIButtons<DigitalCCSender, NumButtons>(buttons, baseAddress,
-                                                   incrementAddress, sender) {}
+        : MIDIButtons<DigitalCCSender, NumButtons, Buttons>(
+              buttons, baseAddress, incrementAddress, sender) {}
 };
 
 END_CS_NAMESPACE
\ No newline at end of file
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <MIDI_Outputs/Abstract/MIDIFilteredAnalogs.hpp>
+#include <MIDI_Senders/ContinuousCCSender.hpp>
+
+BEGIN_CS_NAMESPACE
+
+/**
+ * @brief   A class of MIDIOutputElement%s that read the analog inputs from a
+ *          **collection of potentiometers or faders**, and send out 7-bit
+ *          MIDI **Control Change** events.
+ *
+ * The result is the same as using a @ref CCPotentiometer for each input, but
+ * all inputs are filtered at once using an @ref AH::FilteredAnalogBank, which
+ * is much faster when using many potentiometers.  
+ * This version cannot be banked.
+ *
+ * @tparam  NumInputs
+ *          The number of potentiometers in the collection.
+ *
+ * @ingroup MIDIOutputElements
+ */
+template <uint16_t NumInputs>
+class CCPotentiometers
+    : public MIDIFilteredAnalogs<ContinuousCCSender, NumInputs> {
+  public:
+    /**
+     * @brief   Create a new CCPotentiometers object with the given analog
+     *          pins, the given controller number and channel.
+     *
+     * @param   analogPins
+     *          A list of analog input pins to read from.
+     * @param   baseAddress
+     *          The MIDI address of the first potentiometer, containing the
+     *          controller number [0, 119], channel [Channel_1, Channel_16],
+     *          and optional cable number [Cable_1, Cable_16].
+     * @param   incrementAddress
+     *          The number of addresses to increment for each next
+     *          potentiometer.  
+     *          E.g. if `baseAddress` is 8, and `incrementAddress` is 2,
+     *          then the first potentiometer will send on address 8, the
+     *          second potentiometer will send on address 10, etc.
+     * @param   sender
+     *          The MIDI sender to use.
+     */
+    CCPotentiometers(const Array<pin_t, NumInputs> &analogPins,
+                     MIDIAddress baseAddress,
+                     RelativeMIDIAddress incrementAddress,
+                     const ContinuousCCSender &sender = {})
+        : MIDIFilteredAnalogs<ContinuousCCSender, NumInputs>(
+              analogPins, baseAddress, incrementAddress, sender) {}
+};
+
+END_CS_NAMESPACE
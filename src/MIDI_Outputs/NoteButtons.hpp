@@ -17,11 +17,17 @@ BEGIN_CS_NAMESPACE
  * 
  * @tparam  NumButtons
  *          The number of buttons in the collection.
+ * @tparam  Buttons
+ *          The type of the collection of buttons. Use
+ *          @ref AH::ButtonBank "AH::ButtonBank<NumButtons>" to read and
+ *          debounce many buttons connected to an extended IO element at once,
+ *          e.g. `NoteButtons<16, AH::ButtonBank<16>> buttons {{mcp, 0}, ...};`
  * 
  * @ingroup MIDIOutputElements
  */
-template <uint8_t NumButtons>
-class NoteButtons : public MIDIButtons<DigitalNoteSender, NumButtons> {
+template <uint8_t NumButtons,
+          class Buttons = Array<AH::Button, NumButtons>>
+class NoteButtons : public MIDIButtons<DigitalNoteSender, NumButtons, Buttons> {
   public:
     /**
      * @brief   Create a new NoteButtons object with the given pins,
@@ -42,10 +48,10 @@ class NoteButtons : public MIDIButtons<DigitalNoteSender, NumButtons> {
      * @param   velocity
      *          The velocity of the MIDI Note events.
      */
-    NoteButtons(const Array<AH::Button, NumButtons> &buttons,
+    NoteButtons(const Buttons &buttons,
                 MIDIAddress baseAddress, RelativeMIDIAddress incrementAddress,
                 uint8_t velocity = 0x7F)
-        : MIDIButtons<DigitalNoteSender, NumButtons> {
+        : MIDIButtons<DigitalNoteSender, NumButtons, Buttons> {
               buttons,
               baseAddress,
               incrementAddress,
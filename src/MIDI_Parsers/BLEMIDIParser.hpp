@@ -96,6 +96,23 @@ class BLEMIDIParser {
         return false;
     }
 
+    /// Get a view of the run of data bytes at the current position in the
+    /// BLE packet (if any), without copying them. Used to pass on SysEx data
+    /// directly. Timestamps and status bytes are not consumed, use @ref pull
+    /// for those.
+    /// @return True if at least one data byte was available, false otherwise.
+    bool pullData(const uint8_t *&output, size_t &length) {
+        const uint8_t *first = data;
+        while (data != end && isData(*data))
+            ++data;
+        if (data == first)
+            return false;
+        output = first;
+        length = data - first;
+        prevWasTimestamp = false;
+        return true;
+    }
+
     uint16_t getTimestamp() const { return timestamp; }
 
   private:
@@ -1,6 +1,8 @@
 #pragma once
 
-#include <AH/STL/vector> // std::vector
+#include <AH/STL/cstddef> // size_t
+#include <AH/STL/cstdint> // uint8_t
+#include <AH/STL/vector>  // std::vector
 #include <Settings/NamespaceSettings.hpp>
 
 BEGIN_CS_NAMESPACE
@@ -27,6 +29,13 @@ class BufferPuller_ {
         return false;
     }
 
+    /// Get a pointer to the next value in the buffer.
+    const T *data() const { return buffer; }
+    /// Get the number of values left in the buffer.
+    size_t available() const { return end - buffer; }
+    /// Skip the given number of values (at most @ref available()).
+    void skip(size_t count) { buffer += count; }
+
   private:
     const T *buffer;
     const T *const end;
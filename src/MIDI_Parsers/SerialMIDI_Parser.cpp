@@ -1,7 +1,16 @@
 #include "SerialMIDI_Parser.hpp"
 
+#include <AH/STL/algorithm> // std::min
+#include <string.h>         // memcpy
+
 BEGIN_CS_NAMESPACE
 
+#if !IGNORE_SYSEX
+/// SysEx chunks with just the start or end byte, for streaming mode.
+static const uint8_t sysExStartByte = uint8_t(MIDIMessageType::SysExStart);
+static const uint8_t sysExEndByte = uint8_t(MIDIMessageType::SysExEnd);
+#endif
+
 MIDIReadEvent SerialMIDI_Parser::handleRealTime(uint8_t midiByte) {
     rtmsg.message = midiByte;
     return MIDIReadEvent::REALTIME_MESSAGE;
@@ -18,6 +27,13 @@ MIDIReadEvent SerialMIDI_Parser::handleNonRealTimeStatus(uint8_t midiByte) {
         // byte, in which case we can just terminate it now).
         if (midiByte != uint8_t(MIDIMessageType::SysExEnd))
             storeByte(midiByte);
+        // In streaming mode, the end byte is a chunk of its own.
+        if (isSysExStreaming()) {
+            endSysEx();
+            currentHeader = 0;
+            runningHeader = 0;
+            return streamSysEx(&sysExEndByte, MIDIReadEvent::SYSEX_MESSAGE);
+        }
         // Terminate the SysEx message.
         // Check if the SysEx buffer has enough space to store the end byte.
         if (!hasSysExSpace()) {
@@ -51,9 +67,13 @@ MIDIReadEvent SerialMIDI_Parser::handleNonRealTimeStatus(uint8_t midiByte) {
         // and store the start byte.
         else if (midiByte == uint8_t(MIDIMessageType::SysExStart)) {
             startSysEx();
-            addSysExByte(uint8_t(MIDIMessageType::SysExStart));
             runningHeader = 0;
             currentHeader = midiByte;
+            // In streaming mode, the start byte is a chunk of its own.
+            if (isSysExStreaming())
+                return streamSysEx(&sysExStartByte,
+                                   MIDIReadEvent::SYSEX_CHUNK);
+            addSysExByte(uint8_t(MIDIMessageType::SysExStart));
             return MIDIReadEvent::NO_MESSAGE;
         }
         // This should already have been handled by the if (untermSysEx) above.
@@ -179,6 +199,11 @@ MIDIReadEvent SerialMIDI_Parser::handleData(uint8_t midiByte) {
 #if !IGNORE_SYSEX
     // If we're receiving a SysEx message, it's a SysEx data byte
     else if (currentHeader == uint8_t(MIDIMessageType::SysExStart)) {
+        // In streaming mode, pass on the data byte as a chunk of its own.
+        if (isSysExStreaming()) {
+            streamedByte = midiByte;
+            return streamSysEx(&streamedByte, MIDIReadEvent::SYSEX_CHUNK);
+        }
         // Check if the SysEx buffer has enough space to store the data
         if (!hasSysExSpace()) {
             storeByte(midiByte); // Remember to add it next time
@@ -226,4 +251,99 @@ MIDIReadEvent SerialMIDI_Parser::resume() {
     return feed(midiByte);
 }
 
-END_CS_NAMESPACE
\ No newline at end of file
+/// Count the number of data bytes at the start of the buffer, i.e. the number
+/// of bytes before the first status byte. Checks a whole word at a time.
+static size_t countDataBytes(const uint8_t *data, size_t length) {
+    using word_t = uintptr_t;
+    // 0x80 in every byte of the word
+    constexpr word_t highBits = word_t(~word_t(0)) / 0xFF * 0x80;
+    size_t i = 0;
+    for (; i + sizeof(word_t) <= length; i += sizeof(word_t)) {
+        word_t word;
+        memcpy(&word, data + i, sizeof(word));
+        if (word & highBits)
+            break;
+    }
+    // Find the status byte within the last word (or the remaining bytes)
+    while (i < length && MIDI_Parser::isData(data[i]))
+        ++i;
+    return i;
+}
+
+size_t SerialMIDI_Parser::pullChannelMessages(BufferPuller_<uint8_t> &puller,
+                                              ChannelMessage *messages,
+                                              size_t maxMessages) {
+    // Stored bytes, System Common and SysEx messages are handled by pull()
+    if (hasStoredByte() || currentHeader >= 0xF0)
+        return 0;
+
+    const uint8_t *data = puller.data();
+    const uint8_t *const end = data + puller.available();
+    // Local copies of the parser state, see handleData()
+    uint8_t current = currentHeader, running = runningHeader;
+    bool third = thirdByte;
+    uint8_t data1 = midimsg.data1;
+
+    size_t count = 0;
+    while (count < maxMessages && data != end) {
+        if (isStatus(*data)) {
+            // Real-Time and System messages are handled by pull()
+            if (*data >= 0xF0)
+                break;
+            // Start of a new Channel message
+            current = *data++;
+            third = false;
+            continue;
+        }
+        if (current == 0) {
+            // Data bytes without a header are ignored by pull()
+            if (running == 0)
+                break;
+            current = running;
+        }
+        bool twoBytes = ChannelMessage(current, 0, 0).hasTwoDataBytes();
+        // Complete the message that was started earlier
+        if (third) {
+            messages[count++] = {current, data1, *data++};
+            third = false;
+            running = current;
+            current = 0;
+            continue;
+        }
+        // Decode all complete messages before the next status byte
+        uint8_t header = current;
+        size_t size = twoBytes ? 2 : 1;
+        size_t run = countDataBytes(data, end - data);
+        size_t n = std::min(run / size, maxMessages - count);
+        if (twoBytes)
+            for (size_t i = 0; i < n; ++i, data += 2)
+                messages[count++] = {header, data[0], data[1]};
+        else
+            for (size_t i = 0; i < n; ++i, ++data)
+                messages[count++] = {header, data[0], 0};
+        if (n > 0) {
+            running = header;
+            current = 0;
+        }
+        // The first byte of an incomplete message
+        if (twoBytes && n == run / 2 && run % 2 == 1) {
+            current = header;
+            third = true;
+            data1 = *data++;
+        }
+    }
+
+    puller.skip(data - puller.data());
+    currentHeader = current;
+    runningHeader = running;
+    thirdByte = third;
+    if (third) {
+        midimsg.header = current;
+        midimsg.data1 = data1;
+    } else if (count > 0) {
+        midimsg = messages[count - 1];
+    }
+    return count;
+}
+
+END_CS_NAMESPACE
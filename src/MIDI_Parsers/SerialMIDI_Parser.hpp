@@ -1,5 +1,6 @@
 #pragma once
 
+#include "BufferPuller.hpp"
 #include "MIDI_Parser.hpp"
 #include "SysExBuffer.hpp"
 
@@ -26,6 +27,48 @@ class SerialMIDI_Parser : public MIDI_Parser {
     template <class BytePuller>
     MIDIReadEvent pull(BytePuller &&puller);
 
+    /**
+     * @brief   Parse a run of MIDI Channel messages from a buffer in bulk.
+     *
+     * This is a fast path for dense streams of Channel messages (with or
+     * without running status). The buffer is scanned a word at a time for
+     * status bytes, and the data bytes in between are decoded into complete
+     * messages directly, without going through the byte-by-byte state
+     * machine of @ref pull.
+     *
+     * Parsing stops at the first byte that is not part of a Channel message
+     * (System Common, System Exclusive or Real-Time), when @p messages is
+     * full, or at the end of the buffer. The parser state is the same as if
+     * all consumed bytes were parsed by @ref pull, so you can then call
+     * @ref pull with the same puller to handle the next event, and continue
+     * with the fast path afterwards:
+     *
+     * ~~~cpp
+     * auto puller = BufferPuller(buffer, length);
+     * ChannelMessage msgs[16];
+     * while (true) {
+     *     size_t n = parser.pullChannelMessages(puller, msgs, 16);
+     *     handle(msgs, n);
+     *     if (n == 16)
+     *         continue;
+     *     MIDIReadEvent event = parser.pull(puller);
+     *     if (event == MIDIReadEvent::NO_MESSAGE)
+     *         break;
+     *     handle(event);
+     * }
+     * ~~~
+     *
+     * @param   puller
+     *          The buffer with MIDI bytes. Consumed bytes are removed from it.
+     * @param   messages
+     *          Array to write the complete Channel messages to.
+     * @param   maxMessages
+     *          The size of the @p messages array.
+     * @return  The number of messages written to @p messages.
+     */
+    size_t pullChannelMessages(BufferPuller_<uint8_t> &puller,
+                               ChannelMessage *messages, size_t maxMessages);
+
   protected:
     /// Feed a new byte to the parser.
     MIDIReadEvent feed(uint8_t midibyte);
@@ -36,16 +79,54 @@ class SerialMIDI_Parser : public MIDI_Parser {
   public:
     /// Get the latest SysEx message.
     SysExMessage getSysExMessage() const {
+        if (sysexStreaming)
+            return {streamedData, streamedLength};
         return {sysexbuffer.getBuffer(), sysexbuffer.getLength()};
     }
 
+    /**
+     * @brief   Enable or disable streaming SysEx mode.
+     *
+     * In streaming mode, SysEx data is not copied into the SysEx buffer.
+     * Instead, the start byte, every data byte and the end byte are returned
+     * as separate chunks. This is mainly useful for pullers that can provide
+     * contiguous runs of SysEx data bytes without copying them (see
+     * @ref BufferedBLEMIDIParser): while @ref isReceivingSysEx returns true,
+     * such runs can be passed on as chunks directly, and only the status
+     * bytes have to go through the parser.
+     */
+    void setSysExStreaming(bool streaming) { sysexStreaming = streaming; }
+    /// Check whether streaming SysEx mode is enabled.
+    /// @see    @ref setSysExStreaming
+    bool isSysExStreaming() const { return sysexStreaming; }
+    /// Check whether the parser is in the middle of a SysEx message, i.e. if
+    /// the next data bytes are SysEx data.
+    bool isReceivingSysEx() const {
+        return currentHeader == uint8_t(MIDIMessageType::SysExStart);
+    }
+
   protected:
+    /// Return the given data as the SysEx chunk, in streaming mode.
+    MIDIReadEvent streamSysEx(const uint8_t *data, MIDIReadEvent event) {
+        streamedData = data;
+        streamedLength = 1;
+        return event;
+    }
+
     void addSysExByte(uint8_t data) { sysexbuffer.add(data); }
     bool hasSysExSpace() const { return sysexbuffer.hasSpaceLeft(); }
     void startSysEx() { sysexbuffer.start(); }
     void endSysEx() { sysexbuffer.end(); }
 
     SysExBuffer sysexbuffer;
+    /// The current SysEx chunk, in streaming mode.
+    const uint8_t *streamedData = nullptr;
+    /// The length of @ref streamedData.
+    uint16_t streamedLength = 0;
+    /// The last SysEx data byte, in streaming mode.
+    uint8_t streamedByte = 0;
+    /// @see    @ref setSysExStreaming
+    bool sysexStreaming = false;
 #endif
 
   protected:
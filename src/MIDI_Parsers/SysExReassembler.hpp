@@ -0,0 +1,85 @@
+#pragma once
+
+#include "MIDI_MessageTypes.hpp"
+#include <string.h> // memcpy
+
+BEGIN_CS_NAMESPACE
+
+/**
+ * @brief   Helper for combining SysEx chunks into complete messages.
+ *
+ * When SysEx streaming is enabled (e.g.
+ * @ref USBMIDI_Interface::setSysExStreaming), large messages arrive as many
+ * small chunks. Consumers that need the whole message can feed all chunks
+ * to a reassembler, and use the result once @ref add returns true. Only the
+ * consumers that need complete messages pay for the buffer, and its size can
+ * be chosen to match the largest message they expect.
+ *
+ * Chunks of other cables are ignored while a message is being received, so
+ * use one reassembler per cable if messages on different cables can be
+ * interleaved.
+ *
+ * @tparam  Capacity
+ *          The maximum length of a message, including the start and end
+ *          bytes. Longer messages are dropped.
+ *
+ * @ingroup MIDIParsers
+ */
+template <uint16_t Capacity>
+class SysExReassembler {
+  public:
+    /// Add the given chunk to the current message.
+    /// @return True if the chunk completed a message, which can then be
+    ///         retrieved using @ref getMessage. False otherwise.
+    bool add(SysExMessage chunk) {
+        if (chunk.length == 0)
+            return false;
+        // A new message starts, discard any unfinished message
+        if (chunk.isFirstChunk()) {
+            length = 0;
+            cable = chunk.getCable();
+            receiving = true;
+            overflow = false;
+        } else if (!receiving || chunk.getCable() != cable) {
+            return false;
+        }
+        if (chunk.length > Capacity - length) {
+            DEBUGREF(F("SysEx: message too long for reassembly"));
+            receiving = false;
+            overflow = true;
+            return false;
+        }
+        memcpy(buffer + length, chunk.data, chunk.length);
+        length += chunk.length;
+        if (chunk.isLastChunk()) {
+            receiving = false;
+            return true;
+        }
+        return false;
+    }
+
+    /// Discard the current message.
+    void reset() {
+        length = 0;
+        receiving = false;
+        overflow = false;
+    }
+
+    /// Get the current message. Only complete if the last call to @ref add
+    /// returned true.
+    SysExMessage getMessage() const { return {buffer, length, cable}; }
+    /// Check whether a message is being received.
+    bool isReceiving() const { return receiving; }
+    /// Check whether the last message was dropped because it didn't fit in the
+    /// buffer.
+    bool hasOverflowed() const { return overflow; }
+
+  private:
+    uint8_t buffer[Capacity];
+    uint16_t length = 0;
+    Cable cable = Cable_1;
+    bool receiving = false;
+    bool overflow = false;
+};
+
+END_CS_NAMESPACE
@@ -26,6 +26,10 @@ MIDIReadEvent USBMIDI_Parser::handleSysExStartCont(MIDIUSBPacket_t packet,
         return MIDIReadEvent::NO_MESSAGE; // ignore the data
     }
 
+    // In streaming mode, pass on the data in the packet directly
+    if (isSysExStreaming())
+        return streamSysEx(packet, cable, 3, MIDIReadEvent::SYSEX_CHUNK);
+
     // Check if the SysEx buffer has enough space to store the data
     if (!hasSysExSpace(cable, 3)) {
         storePacket(packet);
@@ -61,6 +65,13 @@ MIDIReadEvent USBMIDI_Parser::handleSysExEnd(MIDIUSBPacket_t packet,
         return MIDIReadEvent::NO_MESSAGE; // ignore the data
     }
 
+    // In streaming mode, pass on the data in the packet directly
+    if (isSysExStreaming()) {
+        endSysEx(cable);
+        return streamSysEx(packet, cable, NumBytes,
+                           MIDIReadEvent::SYSEX_MESSAGE);
+    }
+
     // Check if the SysEx buffer has enough space to store the end byte
     if (!hasSysExSpace(cable, NumBytes)) {
         storePacket(packet);
@@ -99,6 +110,12 @@ MIDIReadEvent USBMIDI_Parser::handleSysExEnd<1>(MIDIUSBPacket_t packet,
             return MIDIReadEvent::NO_MESSAGE; // ignore the data
         }
 
+        // In streaming mode, pass on the data in the packet directly
+        if (isSysExStreaming()) {
+            endSysEx(cable);
+            return streamSysEx(packet, cable, 1, MIDIReadEvent::SYSEX_MESSAGE);
+        }
+
         // Check if the SysEx buffer has enough space to store the end byte
         if (!hasSysExSpace(cable, 1)) {
             storePacket(packet);
@@ -50,12 +50,31 @@ class USBMIDI_Parser : public MIDI_Parser {
 #if !IGNORE_SYSEX
     /// Get the latest SysEx message.
     SysExMessage getSysExMessage() const {
+        if (sysexStreaming)
+            return {&streamedPacket[1], streamedLength, activeCable};
         return {
             sysexbuffers[activeCable.getRaw()].getBuffer(),
             sysexbuffers[activeCable.getRaw()].getLength(),
             activeCable,
         };
     }
+
+    /**
+     * @brief   Enable or disable streaming SysEx mode.
+     *
+     * By default, SysEx data is copied into a buffer of @ref SYSEX_BUFFER_SIZE
+     * bytes per cable, and larger messages are returned in chunks of that
+     * size. In streaming mode, nothing is buffered: every SysEx packet is
+     * returned as a separate chunk of one to three bytes that points into the
+     * packet that was just parsed. The chunk is only valid until the next call
+     * to @ref pull. This allows receiving SysEx messages of any length
+     * without the copying overhead. Use @ref SysExReassembler if you need
+     * complete messages.
+     */
+    void setSysExStreaming(bool streaming) { sysexStreaming = streaming; }
+    /// Check whether streaming SysEx mode is enabled.
+    /// @see    @ref setSysExStreaming
+    bool isSysExStreaming() const { return sysexStreaming; }
 #endif
 
   protected:
@@ -65,6 +84,17 @@ class USBMIDI_Parser : public MIDI_Parser {
     template <uint8_t NumBytes>
     MIDIReadEvent handleSysExEnd(MIDIUSBPacket_t packet, Cable cable);
     MIDIReadEvent handleSysCommon(MIDIUSBPacket_t packet, Cable cable);
+#if !IGNORE_SYSEX
+    /// Return the SysEx data in the given packet as a chunk, without copying
+    /// it to the SysEx buffer.
+    MIDIReadEvent streamSysEx(MIDIUSBPacket_t packet, Cable cable,
+                              uint8_t numBytes, MIDIReadEvent event) {
+        streamedPacket = packet;
+        streamedLength = numBytes;
+        activeCable = cable;
+        return event;
+    }
+#endif
 
   protected:
 #if !IGNORE_SYSEX
@@ -100,6 +130,12 @@ class USBMIDI_Parser : public MIDI_Parser {
   private:
     SysExBuffer sysexbuffers[USB_MIDI_NUMBER_OF_CABLES] = {};
     MIDIUSBPacket_t storedPacket = {{ 0x00 }};
+    /// The last SysEx packet, in streaming mode.
+    MIDIUSBPacket_t streamedPacket = {{ 0x00 }};
+    /// The number of SysEx data bytes in @ref streamedPacket.
+    uint8_t streamedLength = 0;
+    /// @see    @ref setSysExStreaming
+    bool sysexStreaming = false;
 #endif
 };
 
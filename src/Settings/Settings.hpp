@@ -35,6 +35,10 @@ constexpr unsigned long VU_PEAK_HOLD_TIME = 400; // milliseconds
 /// pixel at a time), if set to false, they will decay one unit at a time. */
 constexpr bool VU_PEAK_SMOOTH_DECAY = true;
 
+/// The maximum number of different decay times of MCU VU meters. All meters
+/// with the same decay time share a single @ref MCU::VUDecayClock.
+constexpr uint8_t MAX_VU_DECAY_TIMES = 2;
+
 /// Determines when a note input should be interpreted as 'on'.
 constexpr uint8_t NOTE_VELOCITY_THRESHOLD = 1;
 
@@ -50,6 +54,20 @@ constexpr uint16_t SYSEX_BUFFER_SIZE = 128;
 /// Timeout in milliseconds to wait for a SysEx chunk to complete.
 constexpr unsigned long SYSEX_CHUNK_TIMEOUT = 500;
 
+/// The maximum number of USB MIDI packets that are batched before they are
+/// written to the USB backend when using
+/// @ref GenericUSBMIDI_Interface::sendOncePerLoop(), and the maximum number of
+/// packets read from the USB backend at once. Only used by backends that
+/// support writing or reading multiple packets at once.
+constexpr uint8_t USB_MIDI_BATCH_SIZE = 16;
+
+/// The maximum number of consecutive incoming MIDI Channel messages that are
+/// passed to @ref MIDI_Callbacks::onChannelMessages() at once. The callbacks
+/// for a batch are called after all of its messages have been sent to the
+/// pipes. The batch is stored on the stack (four bytes per message), but only
+/// if the MIDI interface has callbacks.
+constexpr uint8_t MIDI_CALLBACK_BATCH_SIZE = 16;
+
 /// The baud rate to use for Hairless MIDI.
 constexpr unsigned long HAIRLESS_BAUD = 115200;
 
@@ -1,3 +1,4 @@
+#include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 #include <AH/Containers/Updatable.hpp>
@@ -56,4 +57,125 @@ TEST(Updatable, alreadyDisabled) {
     } catch (ErrorException &e) {
         EXPECT_EQ(e.getErrorCode(), 0x1213);
     }
-}
\ No newline at end of file
+}
+
+struct S {};
+struct ScheduledUpdatable : Updatable<S> {
+    ScheduledUpdatable(unsigned long cost = 0) : cost(cost) {}
+    void begin() override {}
+    void update() override {
+        ++updates;
+        now += cost;
+    }
+    unsigned updates = 0;
+    unsigned long cost;
+    static unsigned long now;
+};
+unsigned long ScheduledUpdatable::now = 0;
+
+TEST(Updatable, rateClasses) {
+    using ::testing::Invoke;
+    EXPECT_CALL(ArduinoMock::getInstance(), micros())
+        .WillRepeatedly(Invoke([] { return ScheduledUpdatable::now; }));
+    ScheduledUpdatable::now = 0;
+    ScheduledUpdatable everyLoop, fast, slow;
+    fast.setUpdateRate(UpdateRate::Fast);
+    slow.setUpdateRate(UpdateRate::Slow);
+    EXPECT_EQ(ScheduledUpdatable::getUpdateInterval(UpdateRate::Fast), 1000u);
+    ScheduledUpdatable::setUpdateInterval(UpdateRate::Slow, 10000);
+
+    // Call updateAll every 100 µs for 100 ms
+    for (int i = 0; i < 1000; ++i) {
+        ScheduledUpdatable::updateAll();
+        ScheduledUpdatable::now += 100;
+    }
+    EXPECT_EQ(everyLoop.updates, 1000u);
+    EXPECT_EQ(fast.updates, 99u);
+    EXPECT_EQ(slow.updates, 9u);
+
+    ScheduledUpdatable::setUpdateInterval(UpdateRate::Slow,
+                                          UPDATE_INTERVAL_SLOW);
+    ::testing::Mock::VerifyAndClear(&ArduinoMock::getInstance());
+}
+
+TEST(Updatable, budget) {
+    using ::testing::Invoke;
+    EXPECT_CALL(ArduinoMock::getInstance(), micros())
+        .WillRepeatedly(Invoke([] { return ScheduledUpdatable::now; }));
+    ScheduledUpdatable::now = 1000000;
+    // 1 fast element, and 20 slow elements that take 100 µs each
+    ScheduledUpdatable fast {10};
+    fast.setUpdateRate(UpdateRate::Fast);
+    vector<ScheduledUpdatable> slow(20, ScheduledUpdatable {100});
+    for (auto &s : slow)
+        s.setUpdateRate(UpdateRate::Slow);
+    ScheduledUpdatable::setUpdateBudget(250);
+
+    // The slow elements are spread out over multiple loops
+    unsigned long longestLoop = 0;
+    for (int i = 0; i < 30; ++i) {
+        unsigned long start = ScheduledUpdatable::now;
+        ScheduledUpdatable::updateAll();
+        longestLoop = std::max(longestLoop, ScheduledUpdatable::now - start);
+        ScheduledUpdatable::now += 100;
+    }
+    EXPECT_LE(longestLoop, 350u);
+    for (auto &s : slow)
+        EXPECT_EQ(s.updates, 1u);
+
+    // The fast element is serviced again once the slow round is finished
+    EXPECT_GE(fast.updates, 2u);
+
+    ScheduledUpdatable::setUpdateBudget(0);
+    ::testing::Mock::VerifyAndClear(&ArduinoMock::getInstance());
+}
+
+TEST(Updatable, budgetNoStarvation) {
+    using ::testing::Invoke;
+    EXPECT_CALL(ArduinoMock::getInstance(), micros())
+        .WillRepeatedly(Invoke([] { return ScheduledUpdatable::now; }));
+    ScheduledUpdatable::now = 2000000;
+    // The elements that are updated every loop use up the entire budget
+    ScheduledUpdatable everyLoop1 {200}, everyLoop2 {200};
+    ScheduledUpdatable fast {10}, medium {10}, slow {10};
+    fast.setUpdateRate(UpdateRate::Fast);
+    medium.setUpdateRate(UpdateRate::Medium);
+    slow.setUpdateRate(UpdateRate::Slow);
+    ScheduledUpdatable::setUpdateBudget(250);
+
+    for (int i = 0; i < 100; ++i) {
+        ScheduledUpdatable::updateAll();
+        ScheduledUpdatable::now += 100;
+    }
+    // The slower classes still get their turn
+    EXPECT_GE(fast.updates, 1u);
+    EXPECT_GE(medium.updates, 1u);
+    EXPECT_GE(slow.updates, 1u);
+    // While the faster ones continue to be updated as well
+    EXPECT_GE(everyLoop1.updates, 40u);
+    EXPECT_GE(everyLoop2.updates, 40u);
+
+    ScheduledUpdatable::setUpdateBudget(0);
+    ::testing::Mock::VerifyAndClear(&ArduinoMock::getInstance());
+}
+
+TEST(Updatable, defaultsDontUseScheduler) {
+    // micros() is not expected: the strict mock fails if the scheduler runs
+    ScheduledUpdatable a, b;
+    {
+        ScheduledUpdatable c = a;
+        c.setUpdateRate(UpdateRate::Slow);
+        ScheduledUpdatable d = c;
+        EXPECT_EQ(d.getUpdateRate(), UpdateRate::Slow);
+    }
+    a.setUpdateRate(UpdateRate::Fast);
+    b.setUpdateRate(UpdateRate::Medium);
+    ScheduledUpdatable::setUpdateBudget(250);
+    a.setUpdateRate(UpdateRate::EveryLoop);
+    b.setUpdateRate(UpdateRate::EveryLoop);
+    ScheduledUpdatable::setUpdateBudget(0);
+
+    ScheduledUpdatable::updateAll();
+    EXPECT_EQ(a.updates, 1u);
+    EXPECT_EQ(b.updates, 1u);
+}
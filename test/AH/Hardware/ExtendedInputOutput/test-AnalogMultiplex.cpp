@@ -302,4 +302,95 @@ TEST(AnalogMultiplex, pinModeBuffered) {
     ExtIO::pinModeBuffered(mux.pin(0b1111), INPUT_PULLUP);
 
     ::testing::Mock::VerifyAndClear(&ArduinoMock::getInstance());
-}
\ No newline at end of file
+}
+TEST(AnalogMultiplex, bufferedScanGrayCode) {
+    using ::testing::Return;
+    AnalogMultiplex<2> mux = {A0, {2, 3}, 6};
+    mux.discardFirstReading(false);
+    mux.bufferInputs();
+
+    EXPECT_CALL(ArduinoMock::getInstance(), pinMode(2, OUTPUT));
+    EXPECT_CALL(ArduinoMock::getInstance(), pinMode(3, OUTPUT));
+    EXPECT_CALL(ArduinoMock::getInstance(), pinMode(6, OUTPUT));
+    EXPECT_CALL(ArduinoMock::getInstance(), digitalWrite(6, HIGH));
+    {
+        // The first scan happens in begin, and sets all address lines
+        ::testing::InSequence seq;
+        EXPECT_CALL(ArduinoMock::getInstance(), digitalWrite(6, LOW));
+        EXPECT_CALL(ArduinoMock::getInstance(), digitalWrite(2, LOW));
+        EXPECT_CALL(ArduinoMock::getInstance(), digitalWrite(3, LOW));
+        EXPECT_CALL(ArduinoMock::getInstance(), analogRead(A0))
+            .WillOnce(Return(100));
+        EXPECT_CALL(ArduinoMock::getInstance(), digitalWrite(2, HIGH));
+        EXPECT_CALL(ArduinoMock::getInstance(), analogRead(A0))
+            .WillOnce(Return(101));
+        EXPECT_CALL(ArduinoMock::getInstance(), digitalWrite(3, HIGH));
+        EXPECT_CALL(ArduinoMock::getInstance(), analogRead(A0))
+            .WillOnce(Return(103));
+        EXPECT_CALL(ArduinoMock::getInstance(), digitalWrite(2, LOW));
+        EXPECT_CALL(ArduinoMock::getInstance(), analogRead(A0))
+            .WillOnce(Return(102));
+        EXPECT_CALL(ArduinoMock::getInstance(), digitalWrite(6, HIGH));
+    }
+    ExtendedIOElement::beginAll();
+    ::testing::Mock::VerifyAndClear(&ArduinoMock::getInstance());
+
+    // Reading doesn't access the hardware
+    EXPECT_EQ(ExtIO::analogRead(mux.pin(0)), 100);
+    EXPECT_EQ(ExtIO::analogRead(mux.pin(1)), 101);
+    EXPECT_EQ(ExtIO::analogReadBuffered(mux.pin(2)), 102);
+    EXPECT_EQ(ExtIO::analogReadBuffered(mux.pin(3)), 103);
+
+    {
+        // All address lines are written at the start of the scan, afterwards
+        // only a single address line changes for every reading
+        ::testing::InSequence seq;
+        EXPECT_CALL(ArduinoMock::getInstance(), digitalWrite(6, LOW));
+        EXPECT_CALL(ArduinoMock::getInstance(), digitalWrite(2, LOW));
+        EXPECT_CALL(ArduinoMock::getInstance(), digitalWrite(3, LOW));
+        EXPECT_CALL(ArduinoMock::getInstance(), analogRead(A0))
+            .WillOnce(Return(200));
+        EXPECT_CALL(ArduinoMock::getInstance(), digitalWrite(2, HIGH));
+        EXPECT_CALL(ArduinoMock::getInstance(), analogRead(A0))
+            .WillOnce(Return(201));
+        EXPECT_CALL(ArduinoMock::getInstance(), digitalWrite(3, HIGH));
+        EXPECT_CALL(ArduinoMock::getInstance(), analogRead(A0))
+            .WillOnce(Return(203));
+        EXPECT_CALL(ArduinoMock::getInstance(), digitalWrite(2, LOW));
+        EXPECT_CALL(ArduinoMock::getInstance(), analogRead(A0))
+            .WillOnce(Return(202));
+        EXPECT_CALL(ArduinoMock::getInstance(), digitalWrite(6, HIGH));
+    }
+    ExtendedIOElement::updateAllBufferedInputs();
+    ::testing::Mock::VerifyAndClear(&ArduinoMock::getInstance());
+
+    for (pin_int_t i = 0; i < 4; ++i)
+        EXPECT_EQ(ExtIO::analogRead(mux.pin(i)), 200 + i);
+}
+
+TEST(AnalogMultiplex, bufferedScanDiscardFirstReading) {
+    using ::testing::Return;
+    AnalogMultiplex<1> mux = {A0, {2}};
+
+    EXPECT_CALL(ArduinoMock::getInstance(), pinMode(2, OUTPUT));
+    ExtendedIOElement::beginAll();
+    ::testing::Mock::VerifyAndClear(&ArduinoMock::getInstance());
+
+    {
+        // Enabling buffered mode after begin scans the inputs immediately
+        ::testing::InSequence seq;
+        EXPECT_CALL(ArduinoMock::getInstance(), digitalWrite(2, LOW));
+        EXPECT_CALL(ArduinoMock::getInstance(), analogRead(A0))
+            .WillOnce(Return(1))
+            .WillOnce(Return(10));
+        EXPECT_CALL(ArduinoMock::getInstance(), digitalWrite(2, HIGH));
+        EXPECT_CALL(ArduinoMock::getInstance(), analogRead(A0))
+            .WillOnce(Return(2))
+            .WillOnce(Return(20));
+    }
+    mux.bufferInputs();
+    ::testing::Mock::VerifyAndClear(&ArduinoMock::getInstance());
+
+    EXPECT_EQ(ExtIO::analogRead(mux.pin(0)), 10);
+    EXPECT_EQ(ExtIO::analogRead(mux.pin(1)), 20);
+}
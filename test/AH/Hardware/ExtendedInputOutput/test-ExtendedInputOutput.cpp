@@ -784,4 +784,65 @@ TEST(ExtendedIOElement, updateAllBufferedOutputs) {
     EXPECT_CALL(el1, updateBufferedOutputs());
     EXPECT_CALL(el2, updateBufferedOutputs());
     ExtendedIOElement::updateAllBufferedOutputs();
-}
\ No newline at end of file
+}
+TEST(ExtendedIOElement, pinIndex) {
+    MockExtIOElement el1(10);
+    MockExtIOElement el2(0);
+    MockExtIOElement el3(5);
+    MockExtIOElement el4(10);
+    EXPECT_CALL(el1, begin());
+    EXPECT_CALL(el3, begin());
+    EXPECT_CALL(el4, begin());
+    // Re-enabling an element moves it to the end of the list
+    el1.disable();
+    el1.enable();
+    ExtendedIOElement::beginAll();
+
+    EXPECT_EQ(getIOElementOfPinOrNull(el1.pin(0)), &el1);
+    EXPECT_EQ(getIOElementOfPinOrNull(el1.pin(9)), &el1);
+    EXPECT_EQ(getIOElementOfPinOrNull(el3.pin(0)), &el3);
+    EXPECT_EQ(getIOElementOfPinOrNull(el3.pin(4)), &el3);
+    EXPECT_EQ(getIOElementOfPinOrNull(el4.pin(0)), &el4);
+    EXPECT_EQ(getIOElementOfPinOrNull(el4.pin(9)), &el4);
+    EXPECT_EQ(getIOElementOfPinOrNull(el4.pin(9) + 1), nullptr);
+    EXPECT_EQ(getIOElementOfPinOrNull(el1.pin(0) - 1), nullptr);
+
+    // Disabled elements are no longer found
+    el3.disable();
+    EXPECT_EQ(getIOElementOfPinOrNull(el3.pin(0)), nullptr);
+    EXPECT_EQ(getIOElementOfPinOrNull(el4.pin(0)), &el4);
+    el3.enable();
+    EXPECT_EQ(getIOElementOfPinOrNull(el3.pin(0)), &el3);
+
+    // New elements are found as well
+    MockExtIOElement el5(3);
+    EXPECT_EQ(getIOElementOfPinOrNull(el5.pin(2)), &el5);
+}
+
+TEST(ExtendedInputOutput, digitalReadWriteMany) {
+    MockExtIOElement el1(10);
+    MockExtIOElement el2(10);
+    pin_t pins[] {el1.pin(1), el1.pin(2), 3, el2.pin(0), NO_PIN, el1.pin(0)};
+    PinStatus_t values[6] {};
+
+    InSequence seq;
+    EXPECT_CALL(el1, digitalRead(1)).WillOnce(Return(HIGH));
+    EXPECT_CALL(el1, digitalRead(2)).WillOnce(Return(LOW));
+    EXPECT_CALL(ArduinoMock::getInstance(), digitalRead(3))
+        .WillOnce(Return(HIGH));
+    EXPECT_CALL(el2, digitalRead(0)).WillOnce(Return(HIGH));
+    EXPECT_CALL(el1, digitalRead(0)).WillOnce(Return(HIGH));
+    digitalReadMany(pins, values, 6);
+    PinStatus_t expected[6] {HIGH, LOW, HIGH, HIGH, LOW, HIGH};
+    EXPECT_THAT(values, ElementsAreArray(expected));
+
+    PinStatus_t out[6] {LOW, HIGH, LOW, HIGH, HIGH, LOW};
+    EXPECT_CALL(el1, digitalWrite(1, LOW));
+    EXPECT_CALL(el1, digitalWrite(2, HIGH));
+    EXPECT_CALL(ArduinoMock::getInstance(), digitalWrite(3, LOW));
+    EXPECT_CALL(el2, digitalWrite(0, HIGH));
+    EXPECT_CALL(el1, digitalWrite(0, LOW));
+    digitalWriteMany(pins, out, 6);
+
+    Mock::VerifyAndClear(&ArduinoMock::getInstance());
+}
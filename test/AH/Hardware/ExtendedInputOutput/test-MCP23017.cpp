@@ -0,0 +1,247 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <AH/Hardware/ButtonBank.hpp>
+#include <AH/Hardware/ExtendedInputOutput/MCP23017.hpp>
+
+#include <map>
+#include <memory>
+#include <vector>
+
+using namespace ::testing;
+USING_AH_NAMESPACE;
+
+/// Simulates the registers of the MCP23017s on an I²C bus.
+class FakeBus {
+  public:
+    struct Chip {
+        uint8_t regs[0x16] = {};
+        uint8_t pointer = 0;
+
+        uint16_t reg16(uint8_t addr) const {
+            return regs[addr] | uint16_t(regs[addr + 1]) << 8;
+        }
+        void setReg16(uint8_t addr, uint16_t value) {
+            regs[addr] = value & 0xFF;
+            regs[addr + 1] = value >> 8;
+        }
+        /// Change the state of an input pin, and flag an interrupt if enabled.
+        void setPin(uint8_t pin, bool state) {
+            uint16_t gpio = reg16(0x12), mask = 1u << pin;
+            if (bool(gpio & mask) == state)
+                return;
+            gpio ^= mask;
+            if ((reg16(0x04) & mask) && reg16(0x0E) == 0) {
+                setReg16(0x0E, mask);
+                setReg16(0x10, gpio);
+            }
+            setReg16(0x12, gpio);
+        }
+        bool interrupt() const { return reg16(0x0E) != 0; }
+    };
+
+    void beginTransmission(uint8_t address) {
+        current = &chips[address];
+        selectRegister = true;
+    }
+    size_t write(uint8_t value) {
+        if (selectRegister)
+            current->pointer = value;
+        else if (current->pointer == 0x12 || current->pointer == 0x13)
+            // Writing to GPIO writes to the output latches
+            current->regs[2 + current->pointer++] = value;
+        else
+            current->regs[current->pointer++] = value;
+        selectRegister = false;
+        return 1;
+    }
+    size_t write(const uint8_t *data, size_t len) {
+        for (size_t i = 0; i < len; ++i)
+            write(data[i]);
+        return len;
+    }
+    uint8_t endTransmission(bool = true) { return 0; }
+    uint8_t requestFrom(uint8_t address, size_t len) {
+        current = &chips[address];
+        ++transactions;
+        bytesRead += len;
+        return len;
+    }
+    int read() {
+        uint8_t p = current->pointer++;
+        // Reading INTCAP or GPIO clears the interrupt
+        if (p >= 0x10 && p <= 0x13)
+            current->setReg16(0x0E, 0);
+        return current->regs[p];
+    }
+
+    /// The state of the shared (active-low) interrupt line.
+    PinStatus_t interruptLine() const {
+        for (auto &chip : chips)
+            if (chip.second.interrupt())
+                return LOW;
+        return HIGH;
+    }
+
+    std::map<uint8_t, Chip> chips;
+    Chip *current = nullptr;
+    bool selectRegister = false;
+    unsigned transactions = 0;
+    size_t bytesRead = 0;
+};
+
+class MCP23017Test : public Test {
+  protected:
+    void SetUp() override {
+        EXPECT_CALL(ArduinoMock::getInstance(), pinMode(2, INPUT_PULLUP))
+            .Times(AnyNumber());
+        EXPECT_CALL(ArduinoMock::getInstance(), digitalRead(2))
+            .WillRepeatedly(Invoke([this](pin_t) {
+                ++interruptLineReads;
+                return bus.interruptLine();
+            }));
+        EXPECT_CALL(ArduinoMock::getInstance(), millis())
+            .WillRepeatedly(Invoke([this] { return now; }));
+    }
+    void TearDown() override {
+        Mock::VerifyAndClear(&ArduinoMock::getInstance());
+    }
+    FakeBus::Chip &chip(uint8_t offset) { return bus.chips[0x20 | offset]; }
+
+    FakeBus bus;
+    unsigned interruptLineReads = 0;
+    unsigned long now = 1000;
+};
+
+TEST_F(MCP23017Test, polling) {
+    MCP23017<FakeBus> mcp {bus};
+    mcp.begin();
+    mcp.updateBufferedOutputs();
+    chip(0).setReg16(0x12, 0xFFFF);
+    mcp.updateBufferedInputs();
+    EXPECT_EQ(mcp.getChangedPins(), 0xFFFF);
+    EXPECT_EQ(mcp.digitalReadBufferedBits(0, 16), 0xFFFFu);
+    auto revision = mcp.getInputRevision();
+
+    // Without interrupt pin, the GPIO registers are read on every update
+    bus.transactions = 0;
+    mcp.updateBufferedInputs();
+    EXPECT_EQ(bus.transactions, 1u);
+    EXPECT_FALSE(mcp.hasChangedPins());
+    EXPECT_EQ(mcp.getInputRevision(), revision);
+
+    chip(0).setPin(9, LOW);
+    mcp.updateBufferedInputs();
+    EXPECT_EQ(mcp.getChangedPins(), 1u << 9);
+    EXPECT_EQ(mcp.digitalReadBuffered(9), LOW);
+    EXPECT_NE(mcp.getInputRevision(), revision);
+    EXPECT_EQ(interruptLineReads, 0u);
+}
+
+TEST_F(MCP23017Test, interrupt) {
+    MCP23017<FakeBus> mcp {bus, 0, 2};
+    mcp.begin();
+    mcp.updateBufferedOutputs();
+    EXPECT_EQ(chip(0).reg16(0x04), 0xFFFF); // GPINTEN
+    chip(0).setReg16(0x12, 0xFFFF);
+    // The inputs are always read after changing the pin modes
+    mcp.updateBufferedInputs();
+    EXPECT_EQ(bus.transactions, 1u);
+    EXPECT_EQ(mcp.digitalReadBuffered(3), HIGH);
+
+    // No I²C traffic without interrupt
+    for (int i = 0; i < 10; ++i)
+        mcp.updateBufferedInputs();
+    EXPECT_EQ(bus.transactions, 1u);
+    EXPECT_FALSE(mcp.hasChangedPins());
+
+    // A single transaction reads the flags, the captured values and the
+    // current state, and clears the interrupt
+    chip(0).setPin(3, LOW);
+    EXPECT_EQ(bus.interruptLine(), LOW);
+    bus.bytesRead = 0;
+    mcp.updateBufferedInputs();
+    EXPECT_EQ(bus.transactions, 2u);
+    EXPECT_EQ(bus.bytesRead, 6u);
+    EXPECT_EQ(bus.interruptLine(), HIGH);
+    EXPECT_EQ(mcp.getChangedPins(), 1u << 3);
+    EXPECT_EQ(mcp.digitalReadBuffered(3), LOW);
+    mcp.updateBufferedInputs();
+    EXPECT_EQ(bus.transactions, 2u);
+    EXPECT_FALSE(mcp.hasChangedPins());
+}
+
+TEST_F(MCP23017Test, shortPulseIsFlagged) {
+    MCP23017<FakeBus> mcp {bus, 0, 2};
+    mcp.begin();
+    mcp.updateBufferedOutputs();
+    chip(0).setReg16(0x12, 0xFFFF);
+    mcp.updateBufferedInputs();
+
+    // The pin returns to its original state before it is read
+    chip(0).setPin(12, LOW);
+    chip(0).setPin(12, HIGH);
+    mcp.updateBufferedInputs();
+    EXPECT_EQ(mcp.getChangedPins(), 1u << 12);
+    EXPECT_EQ(mcp.digitalReadBuffered(12), HIGH);
+}
+
+TEST_F(MCP23017Test, sharedInterruptLine) {
+    std::vector<std::unique_ptr<MCP23017<FakeBus>>> mcps;
+    for (uint8_t i = 0; i < 8; ++i) {
+        mcps.emplace_back(new MCP23017<FakeBus>(bus, i, 2));
+        chip(i).setReg16(0x12, 0xFFFF);
+    }
+    auto updateAll = [&] {
+        for (auto &mcp : mcps)
+            mcp->updateBufferedInputs();
+    };
+    for (auto &mcp : mcps) {
+        mcp->begin();
+        mcp->updateBufferedOutputs();
+    }
+    updateAll();
+    EXPECT_EQ(bus.transactions, 8u);
+
+    // Only the expanders up to the one that flagged the change are read,
+    // the others see that the interrupt line has been released
+    chip(2).setPin(0, LOW);
+    bus.transactions = 0;
+    updateAll();
+    EXPECT_EQ(bus.transactions, 3u);
+    EXPECT_EQ(mcps[2]->getChangedPins(), 1u);
+    for (uint8_t i : {0, 1, 3, 4, 5, 6, 7})
+        EXPECT_FALSE(mcps[i]->hasChangedPins()) << +i;
+
+    bus.transactions = 0;
+    updateAll();
+    EXPECT_EQ(bus.transactions, 0u);
+}
+
+/// ButtonBank skips samples if the inputs of the MCP23017 didn't change.
+TEST_F(MCP23017Test, buttonBank) {
+    MCP23017<FakeBus> mcp {bus, 0, 2};
+    ButtonBank<16> bank {mcp};
+    bank.setDebounceTime(4);
+    mcp.begin();
+    bank.begin();
+    chip(0).setReg16(0x12, 0xFFFF);
+    auto updateFor = [&](unsigned long duration) {
+        unsigned changes = 0;
+        for (unsigned long i = 0; i < duration; ++i) {
+            ++now;
+            changes += bank.update();
+        }
+        return changes;
+    };
+    EXPECT_EQ(updateFor(10), 0u);
+    EXPECT_EQ(bus.transactions, 1u);
+
+    chip(0).setPin(5, LOW);
+    EXPECT_EQ(updateFor(4), 1u);
+    EXPECT_EQ(bank.getPressed(0), 1u << 5);
+    EXPECT_EQ(bus.transactions, 2u);
+    EXPECT_EQ(updateFor(10), 0u);
+    EXPECT_EQ(bank.getState(5), Button::Pressed);
+    EXPECT_EQ(bus.transactions, 2u);
+}
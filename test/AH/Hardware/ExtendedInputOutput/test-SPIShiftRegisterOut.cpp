@@ -0,0 +1,152 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <AH/Hardware/ExtendedInputOutput/SPIShiftRegisterOut.hpp>
+
+#include <vector>
+
+using namespace ::testing;
+USING_AH_NAMESPACE;
+
+struct MockSPI {
+    MOCK_METHOD(void, begin, ());
+    MOCK_METHOD(void, beginTransaction, (SPISettings));
+    MOCK_METHOD(void, endTransaction, ());
+    MOCK_METHOD(void, transferBytes, (std::vector<uint8_t>));
+    void transfer(void *buf, size_t count) {
+        auto *data = static_cast<uint8_t *>(buf);
+        transferBytes({data, data + count});
+        // The buffer is overwritten by the received data
+        std::fill(data, data + count, 0xEE);
+    }
+};
+
+TEST(SPIShiftRegisterOut, bulkTransferMSBFirst) {
+    StrictMock<MockSPI> spi;
+    SPIShiftRegisterOut<24, MockSPI &> sr {spi, 10, MSBFIRST};
+
+    InSequence seq;
+    EXPECT_CALL(ArduinoMock::getInstance(), pinMode(10, OUTPUT));
+    EXPECT_CALL(spi, begin());
+    EXPECT_CALL(spi, beginTransaction(_));
+    EXPECT_CALL(ArduinoMock::getInstance(), digitalWrite(10, LOW));
+    EXPECT_CALL(spi, transferBytes(ElementsAre(0x00, 0x00, 0x00)));
+    EXPECT_CALL(ArduinoMock::getInstance(), digitalWrite(10, HIGH));
+    EXPECT_CALL(spi, endTransaction());
+    sr.begin();
+    Mock::VerifyAndClear(&spi);
+    Mock::VerifyAndClear(&ArduinoMock::getInstance());
+
+    sr.digitalWriteBuffered(0, HIGH);
+    sr.digitalWriteBuffered(9, HIGH);
+    sr.digitalWriteBuffered(23, HIGH);
+    EXPECT_CALL(spi, beginTransaction(_));
+    EXPECT_CALL(ArduinoMock::getInstance(), digitalWrite(10, LOW));
+    EXPECT_CALL(spi, transferBytes(ElementsAre(0x80, 0x02, 0x01)));
+    EXPECT_CALL(ArduinoMock::getInstance(), digitalWrite(10, HIGH));
+    EXPECT_CALL(spi, endTransaction());
+    sr.updateBufferedOutputs();
+    Mock::VerifyAndClear(&spi);
+    Mock::VerifyAndClear(&ArduinoMock::getInstance());
+
+    // Nothing changed
+    sr.updateBufferedOutputs();
+    // The received data doesn't affect the outputs
+    EXPECT_EQ(sr.digitalRead(1), LOW);
+    EXPECT_EQ(sr.digitalRead(9), HIGH);
+}
+
+TEST(SPIShiftRegisterOut, bulkTransferLSBFirst) {
+    StrictMock<MockSPI> spi;
+    SPIShiftRegisterOut<16, MockSPI &> sr {spi, 10, LSBFIRST};
+    EXPECT_CALL(ArduinoMock::getInstance(), pinMode(10, OUTPUT));
+    EXPECT_CALL(ArduinoMock::getInstance(), digitalWrite(10, _)).Times(4);
+    EXPECT_CALL(spi, begin());
+    EXPECT_CALL(spi, beginTransaction(_)).Times(2);
+    EXPECT_CALL(spi, endTransaction()).Times(2);
+    EXPECT_CALL(spi, transferBytes(ElementsAre(0x00, 0x00)));
+    sr.begin();
+    sr.digitalWriteBuffered(1, HIGH);
+    sr.digitalWriteBuffered(15, HIGH);
+    EXPECT_CALL(spi, transferBytes(ElementsAre(0x02, 0x80)));
+    sr.updateBufferedOutputs();
+    Mock::VerifyAndClear(&ArduinoMock::getInstance());
+}
+
+TEST(SPIShiftRegisterOut, chain) {
+    StrictMock<MockSPI> spi;
+    SPIShiftRegisterOut<8, MockSPI &> a {spi, 10};
+    SPIShiftRegisterOut<16, MockSPI &> b {spi, 11};
+    SPIShiftRegisterOut<8, MockSPI &> c {spi, 12};
+    a.chain(b);
+    b.chain(c);
+    c.chain(a); // already chained, no effect
+
+    // Registers are only written after they have been initialized
+    EXPECT_CALL(ArduinoMock::getInstance(), pinMode(_, OUTPUT)).Times(3);
+    EXPECT_CALL(ArduinoMock::getInstance(), digitalWrite(_, _)).Times(6);
+    EXPECT_CALL(spi, begin()).Times(3);
+    EXPECT_CALL(spi, beginTransaction(_)).Times(3);
+    EXPECT_CALL(spi, transferBytes(_)).Times(3);
+    EXPECT_CALL(spi, endTransaction()).Times(3);
+    a.begin();
+    b.begin();
+    c.begin();
+    Mock::VerifyAndClear(&spi);
+    Mock::VerifyAndClear(&ArduinoMock::getInstance());
+
+    // All registers are written in a single transaction
+    a.digitalWriteBuffered(0, HIGH);
+    b.digitalWriteBuffered(0, HIGH);
+    c.digitalWriteBuffered(0, HIGH);
+    {
+        InSequence seq;
+        EXPECT_CALL(spi, beginTransaction(_));
+        for (int latch : {11, 12, 10}) {
+            EXPECT_CALL(ArduinoMock::getInstance(), digitalWrite(latch, LOW));
+            EXPECT_CALL(spi, transferBytes(_));
+            EXPECT_CALL(ArduinoMock::getInstance(), digitalWrite(latch, HIGH));
+        }
+        EXPECT_CALL(spi, endTransaction());
+    }
+    b.updateBufferedOutputs();
+    a.updateBufferedOutputs();
+    c.updateBufferedOutputs();
+    Mock::VerifyAndClear(&spi);
+    Mock::VerifyAndClear(&ArduinoMock::getInstance());
+
+    // Only the registers with new data are written
+    b.digitalWriteBuffered(8, HIGH);
+    {
+        InSequence seq;
+        EXPECT_CALL(spi, beginTransaction(_));
+        EXPECT_CALL(ArduinoMock::getInstance(), digitalWrite(11, LOW));
+        EXPECT_CALL(spi, transferBytes(ElementsAre(0x01, 0x01)));
+        EXPECT_CALL(ArduinoMock::getInstance(), digitalWrite(11, HIGH));
+        EXPECT_CALL(spi, endTransaction());
+    }
+    c.updateBufferedOutputs();
+    a.updateBufferedOutputs();
+    b.updateBufferedOutputs();
+    Mock::VerifyAndClear(&spi);
+    Mock::VerifyAndClear(&ArduinoMock::getInstance());
+}
+
+TEST(SPIShiftRegisterOut, unchainOnDestruction) {
+    StrictMock<MockSPI> spi;
+    SPIShiftRegisterOut<8, MockSPI &> a {spi, 10};
+    {
+        SPIShiftRegisterOut<8, MockSPI &> b {spi, 11};
+        a.chain(b);
+    }
+    InSequence seq;
+    EXPECT_CALL(ArduinoMock::getInstance(), pinMode(10, OUTPUT));
+    EXPECT_CALL(spi, begin());
+    EXPECT_CALL(spi, beginTransaction(_));
+    EXPECT_CALL(ArduinoMock::getInstance(), digitalWrite(10, LOW));
+    EXPECT_CALL(spi, transferBytes(_));
+    EXPECT_CALL(ArduinoMock::getInstance(), digitalWrite(10, HIGH));
+    EXPECT_CALL(spi, endTransaction());
+    a.begin();
+    Mock::VerifyAndClear(&ArduinoMock::getInstance());
+}
@@ -0,0 +1,149 @@
+#include <AH/Hardware/ButtonBank.hpp>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <bitset>
+
+using namespace ::testing;
+USING_AH_NAMESPACE;
+
+/// Extended IO element with 128 inputs that are set by the test.
+class FakeInputs : public ExtendedIOElement {
+  public:
+    FakeInputs() : ExtendedIOElement(128) { inputs.set(); }
+
+    void pinModeBuffered(pin_int_t p, PinMode_t m) override {
+        EXPECT_EQ(m, INPUT_PULLUP) << p;
+        ++pinModes;
+    }
+    void digitalWriteBuffered(pin_int_t, PinStatus_t) override {}
+    PinStatus_t digitalReadBuffered(pin_int_t p) override {
+        ++singleReads;
+        return buffer[p] ? HIGH : LOW;
+    }
+    analog_t analogReadBuffered(pin_int_t) override { return 0; }
+    void analogWriteBuffered(pin_int_t, analog_t) override {}
+    void begin() override {}
+    void updateBufferedOutputs() override {}
+    void updateBufferedInputs() override {
+        buffer = inputs;
+        ++inputUpdates;
+    }
+
+    std::bitset<128> inputs, buffer;
+    unsigned pinModes = 0, singleReads = 0, inputUpdates = 0;
+};
+
+class ButtonBankTest : public Test {
+  protected:
+    void SetUp() override {
+        EXPECT_CALL(ArduinoMock::getInstance(), millis())
+            .WillRepeatedly(Invoke([this] { return now; }));
+    }
+    void TearDown() override {
+        Mock::VerifyAndClear(&ArduinoMock::getInstance());
+    }
+    /// Update the bank once every millisecond for the given duration.
+    template <class Bank>
+    unsigned updateFor(Bank &bank, unsigned long duration) {
+        unsigned changes = 0;
+        for (unsigned long i = 0; i < duration; ++i) {
+            ++now;
+            changes += bank.update();
+        }
+        return changes;
+    }
+
+    unsigned long now = 1000;
+};
+
+TEST_F(ButtonBankTest, begin) {
+    FakeInputs io;
+    ButtonBank<100> bank {io, 10};
+    bank.begin();
+    EXPECT_EQ(io.pinModes, 100u);
+}
+
+TEST_F(ButtonBankTest, released) {
+    FakeInputs io;
+    ButtonBank<100> bank {io, 10};
+    EXPECT_EQ(updateFor(bank, 200), 0u);
+    for (uint16_t i = 0; i < 100; ++i)
+        EXPECT_EQ(bank.getState(i), Button::Released) << i;
+    for (uint16_t w = 0; w < bank.NumWords; ++w)
+        EXPECT_EQ(bank.getPressed(w), 0u) << w;
+}
+
+TEST_F(ButtonBankTest, pressAndRelease) {
+    FakeInputs io;
+    ButtonBank<100> bank {io, 10};
+    bank.setDebounceTime(20); // sample every 5 ms
+    const uint16_t btn = 70; // second word on 64-bit platforms
+    const auto W = btn / bank.WordBits;
+    const auto mask = decltype(bank)::word_t(1) << (btn % bank.WordBits);
+
+    // Press: the change is reported on the fourth sample (after 16 ms)
+    io.inputs.reset(10 + btn);
+    EXPECT_EQ(updateFor(bank, 15), 0u);
+    EXPECT_EQ(bank.getState(btn), Button::Released);
+    EXPECT_EQ(updateFor(bank, 1), 1u);
+    EXPECT_EQ(bank.getState(btn), Button::Falling);
+    EXPECT_EQ(bank.getPressedEdges(W), mask);
+    EXPECT_EQ(bank.getReleasedEdges(W), 0u);
+    EXPECT_EQ(bank.getPressed(W), mask);
+    ++now;
+    bank.update();
+    EXPECT_EQ(bank.getState(btn), Button::Pressed);
+    EXPECT_EQ(bank.getPressedEdges(W), 0u);
+    EXPECT_EQ(updateFor(bank, 100), 0u);
+    EXPECT_EQ(bank.getState(btn), Button::Pressed);
+
+    // Release
+    io.inputs.set(10 + btn);
+    EXPECT_EQ(updateFor(bank, 20), 1u);
+    EXPECT_EQ(bank.getReleasedEdges(W), 0u); // cleared by the next update
+    EXPECT_EQ(bank.getState(btn), Button::Released);
+    EXPECT_EQ(bank.getPressed(W), 0u);
+}
+
+TEST_F(ButtonBankTest, bouncing) {
+    FakeInputs io;
+    ButtonBank<8> bank {io};
+    bank.setDebounceTime(20);
+    // Glitches shorter than four samples are ignored
+    for (int i = 0; i < 10; ++i) {
+        io.inputs.flip(3);
+        EXPECT_EQ(updateFor(bank, 10), 0u);
+    }
+    EXPECT_EQ(bank.getState(3), Button::Released);
+    // Bouncing delays the press until the input is stable
+    io.inputs.reset(3);
+    EXPECT_EQ(updateFor(bank, 15), 0u);
+    io.inputs.set(3);
+    EXPECT_EQ(updateFor(bank, 5), 0u);
+    io.inputs.reset(3);
+    EXPECT_EQ(updateFor(bank, 15), 0u);
+    EXPECT_EQ(updateFor(bank, 5), 1u);
+    EXPECT_EQ(bank.getPressed(0), 1u << 3);
+}
+
+TEST_F(ButtonBankTest, invert) {
+    FakeInputs io;
+    ButtonBank<8> bank {io};
+    bank.invert();
+    bank.setDebounceTime(4);
+    io.inputs.reset();
+    io.inputs.set(5);
+    EXPECT_EQ(updateFor(bank, 4), 1u);
+    EXPECT_EQ(bank.getPressed(0), 1u << 5);
+}
+
+TEST_F(ButtonBankTest, readsOncePerSample) {
+    FakeInputs io;
+    ButtonBank<100> bank {io};
+    bank.setDebounceTime(20);
+    updateFor(bank, 100);
+    EXPECT_EQ(io.inputUpdates, 20u);
+    // The default digitalReadBufferedBits reads all pins individually
+    EXPECT_EQ(io.singleReads, 20u * 100);
+}
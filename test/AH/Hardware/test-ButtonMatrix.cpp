@@ -0,0 +1,247 @@
+#include <AH/Hardware/ButtonMatrix.hpp>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace ::testing;
+USING_AH_NAMESPACE;
+
+/// Simulates a button matrix without diodes: pins [0, 16) are connected to the
+/// rows, pins [16, 32) to the columns.
+class FakeMatrix : public ExtendedIOElement {
+  public:
+    FakeMatrix() : ExtendedIOElement(32) {}
+
+    void pinModeBuffered(pin_int_t p, PinMode_t m) override {
+        if (p < 16 && m == OUTPUT)
+            activeRow = p;
+        else if (p < 16 && int(p) == activeRow)
+            activeRow = -1;
+    }
+    void digitalWriteBuffered(pin_int_t, PinStatus_t) override {}
+    PinStatus_t digitalReadBuffered(pin_int_t p) override {
+        if (p < 16 || activeRow < 0)
+            return HIGH;
+        return keys[activeRow][p - 16] ? LOW : HIGH;
+    }
+    analog_t analogReadBuffered(pin_int_t) override { return 0; }
+    void analogWriteBuffered(pin_int_t, analog_t) override {}
+    void begin() override {}
+    void updateBufferedOutputs() override {}
+    void updateBufferedInputs() override { ++inputUpdates; }
+
+    bool keys[16][16] = {};
+    int activeRow = -1;
+    unsigned inputUpdates = 0;
+};
+
+struct Event {
+    uint8_t row, col;
+    bool state;
+    bool operator==(const Event &o) const {
+        return row == o.row && col == o.col && state == o.state;
+    }
+};
+std::ostream &operator<<(std::ostream &os, const Event &e) {
+    return os << '(' << +e.row << ", " << +e.col << ", " << e.state << ')';
+}
+
+template <uint8_t NumRows, uint8_t NumCols>
+class TestMatrix
+    : public ButtonMatrix<TestMatrix<NumRows, NumCols>, NumRows, NumCols> {
+    using Base = ButtonMatrix<TestMatrix, NumRows, NumCols>;
+    friend Base;
+
+  public:
+    using Base::Base;
+
+    std::vector<Event> events;
+    std::vector<std::array<uint64_t, 3>> ghosts;
+
+  private:
+    void onButtonChanged(uint8_t row, uint8_t col, bool state) {
+        events.push_back({row, col, state});
+    }
+    void onGhostedChord(uint8_t row1, uint8_t row2,
+                        typename Base::ColMask cols) {
+        ghosts.push_back({row1, row2, cols});
+    }
+};
+
+class ButtonMatrixTest : public Test {
+  protected:
+    void SetUp() override {
+        EXPECT_CALL(ArduinoMock::getInstance(), millis())
+            .WillRepeatedly(Invoke([this] { return now; }));
+    }
+    void TearDown() override {
+        Mock::VerifyAndClear(&ArduinoMock::getInstance());
+    }
+
+    template <uint8_t NumRows, uint8_t NumCols>
+    static PinList<NumRows> rows(const FakeMatrix &io) {
+        PinList<NumRows> pins;
+        for (uint8_t i = 0; i < NumRows; ++i)
+            pins[i] = io.pin(i);
+        return pins;
+    }
+    template <uint8_t NumCols>
+    static PinList<NumCols> cols(const FakeMatrix &io) {
+        PinList<NumCols> pins;
+        for (uint8_t i = 0; i < NumCols; ++i)
+            pins[i] = io.pin(16 + i);
+        return pins;
+    }
+
+    unsigned long now = 1000;
+};
+
+TEST_F(ButtonMatrixTest, perKeyDebounce) {
+    FakeMatrix io;
+    TestMatrix<4, 4> matrix {rows<4, 4>(io), cols<4>(io)};
+    matrix.begin();
+    matrix.setDebounceTime(20);
+
+    // Press is reported immediately
+    io.keys[0][0] = true;
+    matrix.update();
+    EXPECT_THAT(matrix.events, ElementsAre(Event {0, 0, LOW}));
+    EXPECT_FALSE(matrix.getPrevState(0, 0));
+    matrix.events.clear();
+
+    // Bouncing is ignored during the debounce time
+    now += 5;
+    io.keys[0][0] = false;
+    matrix.update();
+    now += 5;
+    io.keys[0][0] = true;
+    matrix.update();
+    now += 5;
+    io.keys[0][0] = false;
+    // The bouncing key doesn't prevent other keys from changing
+    io.keys[2][3] = true;
+    matrix.update();
+    EXPECT_THAT(matrix.events, ElementsAre(Event {2, 3, LOW}));
+    matrix.events.clear();
+
+    // The final state is reported after the debounce time
+    now += 4;
+    matrix.update();
+    EXPECT_THAT(matrix.events, IsEmpty());
+    now += 1;
+    matrix.update();
+    EXPECT_THAT(matrix.events, ElementsAre(Event {0, 0, HIGH}));
+    EXPECT_TRUE(matrix.getPrevState(0, 0));
+    EXPECT_EQ(matrix.getPressed(2), 0b1000);
+}
+
+TEST_F(ButtonMatrixTest, debounceTimeWrapAround) {
+    FakeMatrix io;
+    TestMatrix<4, 4> matrix {rows<4, 4>(io), cols<4>(io)};
+    matrix.begin();
+    matrix.setDebounceTime(1000);
+    EXPECT_EQ(matrix.getDebounceTime(), 255u);
+    matrix.setDebounceTime(200);
+
+    io.keys[1][2] = true;
+    matrix.update();
+    EXPECT_THAT(matrix.events, ElementsAre(Event {1, 2, LOW}));
+    matrix.events.clear();
+
+    // Still bouncing during this scan
+    now += 199;
+    matrix.update();
+    // The least significant byte of the time since the change wrapped around,
+    // but the key is no longer bouncing
+    now += 199;
+    io.keys[1][2] = false;
+    matrix.update();
+    EXPECT_THAT(matrix.events, ElementsAre(Event {1, 2, HIGH}));
+    matrix.events.clear();
+
+    // Not scanned for a long time after a change
+    now += 300;
+    io.keys[1][2] = true;
+    matrix.update();
+    EXPECT_THAT(matrix.events, ElementsAre(Event {1, 2, LOW}));
+}
+
+TEST_F(ButtonMatrixTest, rowsPerUpdate) {
+    FakeMatrix io;
+    TestMatrix<4, 4> matrix {rows<4, 4>(io), cols<4>(io)};
+    matrix.begin();
+    matrix.setRowsPerUpdate(1);
+    EXPECT_EQ(matrix.getRowsPerUpdate(), 1);
+
+    io.keys[2][1] = true;
+    matrix.update(); // row 0
+    matrix.update(); // row 1
+    EXPECT_THAT(matrix.events, IsEmpty());
+    EXPECT_EQ(io.inputUpdates, 2u);
+    matrix.update(); // row 2
+    EXPECT_THAT(matrix.events, ElementsAre(Event {2, 1, LOW}));
+    matrix.events.clear();
+
+    // Wraps around to the first row
+    io.keys[0][3] = true;
+    matrix.update(); // row 3
+    EXPECT_THAT(matrix.events, IsEmpty());
+    matrix.update(); // row 0
+    EXPECT_THAT(matrix.events, ElementsAre(Event {0, 3, LOW}));
+
+    matrix.setRowsPerUpdate(0);
+    EXPECT_EQ(matrix.getRowsPerUpdate(), 4);
+}
+
+TEST_F(ButtonMatrixTest, readsColumnWords) {
+    FakeMatrix io;
+    TestMatrix<3, 16> matrix {rows<3, 16>(io), cols<16>(io)};
+    matrix.begin();
+    io.keys[1][15] = true;
+    matrix.update();
+    EXPECT_THAT(matrix.events, ElementsAre(Event {1, 15, LOW}));
+    // One read of the IO element per row
+    EXPECT_EQ(io.inputUpdates, 3u);
+}
+
+TEST_F(ButtonMatrixTest, readsNonConsecutiveColumns) {
+    FakeMatrix io;
+    TestMatrix<2, 2> matrix {rows<2, 2>(io), {io.pin(17), io.pin(16)}};
+    matrix.begin();
+    io.keys[1][0] = true;
+    matrix.update();
+    EXPECT_THAT(matrix.events, ElementsAre(Event {1, 1, LOW}));
+    // One read of the IO element per row and column
+    EXPECT_EQ(io.inputUpdates, 4u);
+}
+
+TEST_F(ButtonMatrixTest, ghosting) {
+    FakeMatrix io;
+    TestMatrix<16, 16> matrix {rows<16, 16>(io), cols<16>(io)};
+    matrix.begin();
+
+    io.keys[3][2] = true;
+    io.keys[3][9] = true;
+    io.keys[12][2] = true;
+    matrix.update();
+    EXPECT_EQ(matrix.events.size(), 3u);
+    EXPECT_THAT(matrix.ghosts, IsEmpty());
+    EXPECT_FALSE(matrix.isGhosting());
+
+    // The fourth corner of the rectangle (or its ghost)
+    now += 100;
+    io.keys[12][9] = true;
+    matrix.update();
+    EXPECT_EQ(matrix.events.size(), 4u);
+    using Ghost = std::array<uint64_t, 3>;
+    EXPECT_THAT(matrix.ghosts, ElementsAre(Ghost {12, 3, 1u << 2 | 1u << 9}));
+    EXPECT_TRUE(matrix.isGhosting());
+
+    // Releasing one of the keys resolves the ambiguity
+    now += 100;
+    io.keys[3][9] = false;
+    matrix.update();
+    EXPECT_FALSE(matrix.isGhosting());
+    EXPECT_EQ(matrix.ghosts.size(), 1u);
+}
@@ -0,0 +1,123 @@
+#include <gmock/gmock.h>
+
+#include <AH/Hardware/FilteredAnalogBank.hpp>
+
+#include <random>
+
+USING_AH_NAMESPACE;
+
+using ::testing::_;
+using ::testing::Invoke;
+
+// 13 inputs: one full group of eight for the SIMD implementation, and a
+// scalar tail of five
+constexpr uint16_t N = 13;
+
+static Array<pin_t, N> getPins() {
+    Array<pin_t, N> pins;
+    for (uint16_t i = 0; i < N; ++i)
+        pins[i] = i;
+    return pins;
+}
+
+// Compare the bank to individual FilteredAnalog objects, using random inputs
+template <uint8_t Precision>
+static void testSameAsFilteredAnalog(bool invert) {
+    std::mt19937 rng(Precision);
+    std::uniform_int_distribution<int> step(-48, 48);
+    std::uniform_int_distribution<int> jump(0, 63);
+
+    int raw[N];
+    for (int &r : raw)
+        r = 512;
+    EXPECT_CALL(ArduinoMock::getInstance(), analogRead(_))
+        .WillRepeatedly(Invoke([&](uint8_t pin) { return raw[pin]; }));
+
+    auto pins = getPins();
+    FilteredAnalogBank<N, Precision> bank = pins;
+    std::vector<FilteredAnalog<Precision>> analogs;
+    for (pin_t pin : pins)
+        analogs.emplace_back(pin);
+    if (invert) {
+        bank.invert();
+        for (auto &analog : analogs)
+            analog.invert();
+    }
+    bank.resetToCurrentValue();
+    for (auto &analog : analogs)
+        analog.resetToCurrentValue();
+
+    for (unsigned t = 0; t < 2000; ++t) {
+        for (int &r : raw) {
+            r = jump(rng) == 0 ? (jump(rng) & 1) * 1023 : r + step(rng);
+            r = std::min(std::max(r, 0), 1023);
+        }
+        uint32_t changed = 0;
+        for (uint16_t i = 0; i < N; ++i)
+            changed |= uint32_t(analogs[i].update()) << i;
+        ASSERT_EQ(bank.update(), changed != 0) << "t = " << t;
+        ASSERT_EQ(bank.getChanged(0), changed) << "t = " << t;
+        for (uint16_t i = 0; i < N; ++i) {
+            ASSERT_EQ(bank.getValue(i), analogs[i].getValue())
+                << "t = " << t << ", i = " << i;
+            ASSERT_EQ(bank.hasChanged(i), bool(bank.getChanged(0) & (1u << i)));
+        }
+    }
+
+    ::testing::Mock::VerifyAndClear(&ArduinoMock::getInstance());
+}
+
+TEST(FilteredAnalogBank, sameAsFilteredAnalog7) {
+    testSameAsFilteredAnalog<7>(false);
+}
+
+TEST(FilteredAnalogBank, sameAsFilteredAnalog10) {
+    testSameAsFilteredAnalog<10>(false);
+}
+
+TEST(FilteredAnalogBank, sameAsFilteredAnalogInverted) {
+    testSameAsFilteredAnalog<7>(true);
+}
+
+TEST(FilteredAnalogBank, changedMask) {
+    using Bank = FilteredAnalogBank<N, 7, 0>;
+    Bank bank = getPins();
+    const auto max = Bank::getMaxRawValue();
+    analog_t raw[N] = {};
+    EXPECT_FALSE(bank.update(raw));
+    EXPECT_EQ(bank.getChanged(0), 0u);
+
+    // Without filtering, the hysteresis is applied to the input directly
+    raw[2] = max;
+    raw[9] = max;
+    EXPECT_TRUE(bank.update(raw));
+    EXPECT_EQ(bank.getChanged(0), (1u << 2) | (1u << 9));
+    EXPECT_TRUE(bank.hasChanged(2));
+    EXPECT_TRUE(bank.hasChanged(9));
+    EXPECT_FALSE(bank.hasChanged(3));
+    EXPECT_EQ(bank.getValue(2), 127);
+    EXPECT_EQ(bank.getValue(9), 127);
+    EXPECT_EQ(bank.getValue(3), 0);
+
+    // Same values, no changes
+    EXPECT_FALSE(bank.update(raw));
+    EXPECT_EQ(bank.getChanged(0), 0u);
+
+    // A small change is rejected by the hysteresis
+    raw[12] = 1;
+    EXPECT_FALSE(bank.update(raw));
+    EXPECT_EQ(bank.getValue(12), 0);
+}
+
+TEST(FilteredAnalogBank, map) {
+    using Bank = FilteredAnalogBank<N, 7, 0>;
+    Bank bank = getPins();
+    bank.map([](analog_t x) -> analog_t { return x / 2; });
+    analog_t raw[N] = {};
+    for (uint16_t i = 0; i < N; ++i)
+        raw[i] = Bank::getMaxRawValue();
+    EXPECT_TRUE(bank.update(raw));
+    for (uint16_t i = 0; i < N; ++i)
+        EXPECT_EQ(bank.getValue(i), 63) << i;
+    EXPECT_EQ(bank.getChanged(0), (1u << N) - 1);
+}
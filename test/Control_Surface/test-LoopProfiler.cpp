@@ -0,0 +1,133 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <Control_Surface/Control_Surface_Class.hpp>
+#include <Control_Surface/LoopProfiler.hpp>
+#include <TestStream.hpp>
+
+USING_CS_NAMESPACE;
+using namespace ::testing;
+
+TEST(LoopProfiler, phases) {
+    LoopProfiler profiler;
+    auto &ArduinoMock = ::ArduinoMock::getInstance();
+    InSequence seq;
+    EXPECT_CALL(ArduinoMock, micros()).WillOnce(Return(1000));
+    profiler.beginLoop();
+    EXPECT_CALL(ArduinoMock, micros()).WillOnce(Return(1000));
+    profiler.beginPhase(LoopPhase::BufferedInputs);
+    EXPECT_CALL(ArduinoMock, micros()).WillOnce(Return(1003));
+    profiler.beginPhase(LoopPhase::Updatables);
+    profiler.countMessage();
+    profiler.countMessage();
+    EXPECT_CALL(ArduinoMock, micros()).WillOnce(Return(1103));
+    profiler.beginPhase(LoopPhase::MIDIInput);
+    profiler.countMessage();
+    EXPECT_CALL(ArduinoMock, micros()).WillOnce(Return(1110));
+    profiler.endLoop();
+    // Messages outside of the loop are not counted
+    profiler.countMessage();
+    Mock::VerifyAndClear(&ArduinoMock);
+
+    auto &bi = profiler.getStats(LoopPhase::BufferedInputs);
+    EXPECT_EQ(bi.count, 1u);
+    EXPECT_EQ(bi.min, 3u);
+    EXPECT_EQ(bi.max, 3u);
+    EXPECT_EQ(bi.messages, 0u);
+    EXPECT_EQ(bi.histogram[2], 1u);
+    auto &up = profiler.getStats(LoopPhase::Updatables);
+    EXPECT_EQ(up.count, 1u);
+    EXPECT_EQ(up.getMean(), 100u);
+    EXPECT_EQ(up.messages, 2u);
+    EXPECT_EQ(up.histogram[7], 1u);
+    auto &mi = profiler.getStats(LoopPhase::MIDIInput);
+    EXPECT_EQ(mi.count, 1u);
+    EXPECT_EQ(mi.max, 7u);
+    EXPECT_EQ(mi.messages, 1u);
+    EXPECT_EQ(profiler.getStats(LoopPhase::Displays).count, 0u);
+    auto &total = profiler.getStats(LoopPhase::Total);
+    EXPECT_EQ(total.count, 1u);
+    EXPECT_EQ(total.max, 110u);
+    EXPECT_EQ(total.messages, 3u);
+}
+
+TEST(LoopProfiler, minMaxMean) {
+    LoopProfiler::PhaseStats stats {};
+    stats.add(10);
+    stats.add(2);
+    stats.add(30);
+    EXPECT_EQ(stats.count, 3u);
+    EXPECT_EQ(stats.min, 2u);
+    EXPECT_EQ(stats.max, 30u);
+    EXPECT_EQ(stats.getMean(), 14u);
+    EXPECT_EQ(stats.histogram[2], 1u);
+    EXPECT_EQ(stats.histogram[4], 1u);
+    EXPECT_EQ(stats.histogram[5], 1u);
+}
+
+TEST(LoopProfiler, histogramBuckets) {
+    using Stats = LoopProfiler::PhaseStats;
+    EXPECT_EQ(Stats::getBucket(0), 0);
+    EXPECT_EQ(Stats::getBucket(1), 1);
+    EXPECT_EQ(Stats::getBucket(2), 2);
+    EXPECT_EQ(Stats::getBucket(3), 2);
+    EXPECT_EQ(Stats::getBucket(4), 3);
+    EXPECT_EQ(Stats::getBucket(1023), 10);
+    EXPECT_EQ(Stats::getBucket(1024), 11);
+    EXPECT_EQ(Stats::getBucket(0xFFFFFFFF), LoopProfiler::NumBuckets - 1);
+}
+
+struct MessageSendingUpdatable : AH::Updatable<> {
+    void begin() override {}
+    void update() override { Control_Surface.sendControlChange({7}, 0x40); }
+};
+
+TEST(LoopProfiler, ControlSurfaceLoop) {
+    LoopProfiler profiler;
+    MessageSendingUpdatable updatable;
+    Control_Surface.setLoopProfiler(&profiler);
+    unsigned long time = 0;
+    EXPECT_CALL(::ArduinoMock::getInstance(), micros())
+        .WillRepeatedly(Invoke([&] { return time += 10; }));
+    Control_Surface.loop();
+    Control_Surface.setLoopProfiler(nullptr);
+    Control_Surface.loop();
+    Mock::VerifyAndClear(&::ArduinoMock::getInstance());
+
+    for (auto phase : {LoopPhase::BufferedInputs, LoopPhase::Updatables,
+                       LoopPhase::MIDIInput, LoopPhase::Inputs,
+                       LoopPhase::BufferedOutputs, LoopPhase::MIDIOutput,
+                       LoopPhase::Total})
+        EXPECT_EQ(profiler.getStats(phase).count, 1u)
+            << static_cast<int>(phase);
+    // The display timer didn't fire yet
+    EXPECT_EQ(profiler.getStats(LoopPhase::Displays).count, 0u);
+    EXPECT_EQ(profiler.getStats(LoopPhase::Updatables).min, 10u);
+    EXPECT_EQ(profiler.getStats(LoopPhase::Updatables).messages, 1u);
+    EXPECT_EQ(profiler.getStats(LoopPhase::Inputs).messages, 0u);
+    EXPECT_EQ(profiler.getStats(LoopPhase::Total).messages, 1u);
+    EXPECT_EQ(profiler.getStats(LoopPhase::Total).max, 80u);
+}
+
+TEST(LoopProfiler, print) {
+    LoopProfiler profiler;
+    auto &ArduinoMock = ::ArduinoMock::getInstance();
+    EXPECT_CALL(ArduinoMock, micros())
+        .WillOnce(Return(0))
+        .WillOnce(Return(0))
+        .WillOnce(Return(5));
+    profiler.beginLoop();
+    profiler.beginPhase(LoopPhase::Inputs);
+    profiler.endLoop();
+    Mock::VerifyAndClear(&ArduinoMock);
+
+    TestStream s;
+    profiler.print(s);
+    std::string str {s.sent.begin(), s.sent.end()};
+    EXPECT_THAT(str, HasSubstr("Inputs\t1\t5\t5\t5\t0\t0 0 0 1"));
+    EXPECT_THAT(str, HasSubstr("Total\t1\t5\t5\t5\t0\t0 0 0 1"));
+    EXPECT_THAT(str, Not(HasSubstr("Displays")));
+
+    profiler.reset();
+    EXPECT_EQ(profiler.getStats(LoopPhase::Inputs).count, 0u);
+}
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+
+#include <Display/AsyncDisplayTransfer.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+USING_CS_NAMESPACE;
+
+/// Stand-in for a DMA transfer: a thread that writes the data to the "display"
+/// once it is released.
+class ThreadDisplayTransfer : public AsyncDisplayTransfer {
+  public:
+    ~ThreadDisplayTransfer() override {
+        release();
+        if (thread.joinable())
+            thread.join();
+    }
+
+    void start(const uint8_t *data, uint16_t length) override {
+        if (thread.joinable())
+            thread.join();
+        busy = true;
+        thread = std::thread([this, data, length] {
+            while (hold)
+                std::this_thread::yield();
+            written.assign(data, data + length);
+            ++transfers;
+            busy = false;
+        });
+    }
+    bool isBusy() override { return busy; }
+
+    void release() { hold = false; }
+
+    std::atomic<bool> hold {true};
+    std::atomic<bool> busy {false};
+    std::vector<uint8_t> written;
+    unsigned transfers = 0;
+
+  private:
+    std::thread thread;
+};
+
+TEST(DoubleBufferedDisplayTransfer, noTransfer) {
+    DoubleBufferedDisplayTransfer db;
+    EXPECT_FALSE(db.hasTransfer());
+    EXPECT_FALSE(db.isBusy());
+}
+
+TEST(DoubleBufferedDisplayTransfer, background) {
+    ThreadDisplayTransfer transfer;
+    DoubleBufferedDisplayTransfer db = transfer;
+    EXPECT_TRUE(db.hasTransfer());
+    EXPECT_FALSE(db.isBusy());
+
+    uint8_t *front = db.getFrontBuffer(4);
+    for (uint8_t i = 0; i < 4; ++i)
+        front[i] = i + 1;
+    db.start(4);
+    // The main loop can continue while the transfer is busy
+    EXPECT_TRUE(db.isBusy());
+    EXPECT_EQ(transfer.transfers, 0u);
+
+    transfer.release();
+    db.wait();
+    EXPECT_FALSE(db.isBusy());
+    EXPECT_EQ(transfer.transfers, 1u);
+    EXPECT_EQ(transfer.written, (std::vector<uint8_t> {1, 2, 3, 4}));
+}
+
+TEST(DoubleBufferedDisplayTransfer, getFrontBufferWaits) {
+    ThreadDisplayTransfer transfer;
+    DoubleBufferedDisplayTransfer db = transfer;
+    uint8_t *front = db.getFrontBuffer(2);
+    front[0] = 0x12;
+    front[1] = 0x34;
+    db.start(2);
+    EXPECT_TRUE(db.isBusy());
+
+    std::thread releaser([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        transfer.release();
+    });
+    // The front buffer can only be reused once the transfer has finished
+    front = db.getFrontBuffer(3);
+    EXPECT_FALSE(db.isBusy());
+    EXPECT_EQ(transfer.written, (std::vector<uint8_t> {0x12, 0x34}));
+    releaser.join();
+
+    front[0] = 0x56;
+    front[1] = 0x78;
+    front[2] = 0x9A;
+    db.start(3);
+    db.wait();
+    EXPECT_EQ(transfer.transfers, 2u);
+    EXPECT_EQ(transfer.written, (std::vector<uint8_t> {0x56, 0x78, 0x9A}));
+}
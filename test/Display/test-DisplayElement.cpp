@@ -0,0 +1,181 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <Control_Surface/Control_Surface_Class.hpp>
+#include <Display/DisplayElement.hpp>
+#include <Display/DisplayInterface.hpp>
+
+USING_CS_NAMESPACE;
+using ::testing::InSequence;
+using ::testing::StrictMock;
+
+struct PartialTestDisplay : DisplayInterface {
+    MOCK_METHOD(void, clear, (), (override));
+    MOCK_METHOD(void, clear, (int16_t, int16_t, int16_t, int16_t), (override));
+    MOCK_METHOD(void, drawBackground, (), (override));
+    MOCK_METHOD(void, display, (), (override));
+    MOCK_METHOD(void, display, (int16_t, int16_t, int16_t, int16_t),
+                (override));
+    MOCK_METHOD(void, drawPixel, (int16_t, int16_t, uint16_t), (override));
+    MOCK_METHOD(void, setTextColor, (uint16_t), (override));
+    MOCK_METHOD(void, setTextSize, (uint8_t), (override));
+    MOCK_METHOD(void, setCursor, (int16_t, int16_t), (override));
+    MOCK_METHOD(size_t, write, (uint8_t), (override));
+    MOCK_METHOD(void, drawLine, (int16_t, int16_t, int16_t, int16_t, uint16_t),
+                (override));
+    MOCK_METHOD(void, drawFastVLine, (int16_t, int16_t, int16_t, uint16_t),
+                (override));
+    MOCK_METHOD(void, drawFastHLine, (int16_t, int16_t, int16_t, uint16_t),
+                (override));
+    MOCK_METHOD(void, drawXBitmap,
+                (int16_t, int16_t, const uint8_t[], int16_t, int16_t, uint16_t),
+                (override));
+    bool isBusy() override { return busy; }
+    bool busy = false;
+};
+
+struct TestDisplayElement : DisplayElement {
+    TestDisplayElement(DisplayInterface &display, bool hasBounds,
+                       PixelArea bounds = {0, 0, 0, 0})
+        : DisplayElement(display), hasBounds(hasBounds), bounds(bounds) {}
+
+    MOCK_METHOD(void, draw, (), (override));
+    bool getDirty() const override { return dirty; }
+    bool getBounds(PixelArea &bounds) const override {
+        bounds = this->bounds;
+        return hasBounds;
+    }
+
+    bool dirty = false;
+    bool hasBounds;
+    PixelArea bounds;
+};
+
+using Element = StrictMock<TestDisplayElement>;
+
+TEST(PixelArea, intersects) {
+    PixelArea a = {0, 0, 10, 10};
+    EXPECT_TRUE(a.intersects({9, 9, 5, 5}));
+    EXPECT_FALSE(a.intersects({10, 0, 5, 5}));
+    EXPECT_FALSE(a.intersects({0, 10, 5, 5}));
+    EXPECT_TRUE(a.intersects({-5, -5, 6, 6}));
+    EXPECT_FALSE(a.intersects({2, 2, 0, 5}));
+}
+
+TEST(PixelArea, merge) {
+    PixelArea a = {0, 8, 10, 4};
+    PixelArea m = a.merge({20, 2, 5, 5});
+    EXPECT_EQ(m.x, 0);
+    EXPECT_EQ(m.y, 2);
+    EXPECT_EQ(m.w, 25);
+    EXPECT_EQ(m.h, 10);
+    m = PixelArea {0, 0, 0, 0}.merge(a);
+    EXPECT_EQ(m.x, 0);
+    EXPECT_EQ(m.y, 8);
+    EXPECT_EQ(m.w, 10);
+    EXPECT_EQ(m.h, 4);
+}
+
+TEST(updateDisplays, partial) {
+    StrictMock<PartialTestDisplay> display;
+    Element left {display, true, PixelArea {0, 0, 16, 64}};
+    Element right {display, true, PixelArea {16, 0, 16, 64}};
+    Element overlap {display, true, PixelArea {8, 56, 16, 8}};
+    Element unknown {display, false};
+
+    // Nothing dirty
+    Control_Surface.updateDisplays();
+    ::testing::Mock::VerifyAndClear(&display);
+
+    // Only the dirty element's area and the overlapping elements are redrawn
+    left.dirty = true;
+    {
+        InSequence seq;
+        EXPECT_CALL(display, clear(0, 0, 16, 64));
+        EXPECT_CALL(display, drawBackground());
+        EXPECT_CALL(left, draw());
+        EXPECT_CALL(overlap, draw());
+        EXPECT_CALL(unknown, draw());
+        EXPECT_CALL(display, display(0, 0, 16, 64));
+    }
+    Control_Surface.updateDisplays();
+    ::testing::Mock::VerifyAndClear(&display);
+    ::testing::Mock::VerifyAndClear(&left);
+    ::testing::Mock::VerifyAndClear(&overlap);
+    ::testing::Mock::VerifyAndClear(&unknown);
+    left.dirty = false;
+
+    // The union of the dirty areas is redrawn
+    right.dirty = true;
+    overlap.dirty = true;
+    {
+        InSequence seq;
+        EXPECT_CALL(display, clear(8, 0, 24, 64));
+        EXPECT_CALL(display, drawBackground());
+        EXPECT_CALL(left, draw());
+        EXPECT_CALL(right, draw());
+        EXPECT_CALL(overlap, draw());
+        EXPECT_CALL(unknown, draw());
+        EXPECT_CALL(display, display(8, 0, 24, 64));
+    }
+    Control_Surface.updateDisplays();
+}
+
+TEST(updateDisplays, fullIfBoundsUnknown) {
+    StrictMock<PartialTestDisplay> display;
+    Element known {display, true, PixelArea {0, 0, 16, 64}};
+    Element unknown {display, false};
+    known.dirty = true;
+    unknown.dirty = true;
+    {
+        InSequence seq;
+        EXPECT_CALL(display, clear());
+        EXPECT_CALL(display, drawBackground());
+        EXPECT_CALL(known, draw());
+        EXPECT_CALL(unknown, draw());
+        EXPECT_CALL(display, display());
+    }
+    Control_Surface.updateDisplays();
+}
+
+TEST(updateDisplays, multipleDisplays) {
+    StrictMock<PartialTestDisplay> displays[2];
+    Element a {displays[0], true, PixelArea {0, 0, 8, 8}};
+    Element b {displays[1], false};
+    Element c {displays[0], true, PixelArea {32, 32, 8, 8}};
+    a.dirty = true;
+    b.dirty = true;
+    EXPECT_CALL(displays[0], clear(0, 0, 8, 8));
+    EXPECT_CALL(displays[0], drawBackground());
+    EXPECT_CALL(a, draw());
+    EXPECT_CALL(displays[0], display(0, 0, 8, 8));
+    EXPECT_CALL(displays[1], clear());
+    EXPECT_CALL(displays[1], drawBackground());
+    EXPECT_CALL(b, draw());
+    EXPECT_CALL(displays[1], display());
+    Control_Surface.updateDisplays();
+}
+
+TEST(updateDisplays, skipBusy) {
+    StrictMock<PartialTestDisplay> displays[2];
+    Element a {displays[0], true, PixelArea {0, 0, 8, 8}};
+    Element b {displays[1], true, PixelArea {0, 0, 8, 8}};
+    a.dirty = true;
+    b.dirty = true;
+    // The first display is still writing the previous frame, it's skipped
+    displays[0].busy = true;
+    EXPECT_CALL(displays[1], clear(0, 0, 8, 8));
+    EXPECT_CALL(displays[1], drawBackground());
+    EXPECT_CALL(b, draw()).WillOnce([&] { b.dirty = false; });
+    EXPECT_CALL(displays[1], display(0, 0, 8, 8));
+    Control_Surface.updateDisplays();
+    ::testing::Mock::VerifyAndClear(&displays[1]);
+    ::testing::Mock::VerifyAndClear(&b);
+    // It's drawn in the next frame once the transfer finished
+    displays[0].busy = false;
+    EXPECT_CALL(displays[0], clear(0, 0, 8, 8));
+    EXPECT_CALL(displays[0], drawBackground());
+    EXPECT_CALL(a, draw());
+    EXPECT_CALL(displays[0], display(0, 0, 8, 8));
+    Control_Surface.updateDisplays();
+}
@@ -116,6 +116,27 @@ TEST(LCD, FillManyBuffersWithOneMIDIMessage) {
     for (auto &lcd : lcds) EXPECT_TRUE(lcd.getDirty());
 }
 
+TEST(LCD, Chunks) {
+    MCU::LCD<8> lcd(2);
+    lcd.clearDirty();
+    uint8_t chunk1[] = {0xF0, 0x00, 0x00, 0x66, 0x10};
+    uint8_t chunk2[] = {0x12, 0x00, 'a', 'b', 'c'};
+    uint8_t chunk3[] = {'d', 'e', 0xF7};
+    MIDIInputElementSysEx::updateAllWith(SysExMessage(chunk1));
+    EXPECT_FALSE(lcd.getDirty());
+    MIDIInputElementSysEx::updateAllWith(SysExMessage(chunk2));
+    EXPECT_STREQ(lcd.getText(), "c       ");
+    EXPECT_TRUE(lcd.getDirty());
+    lcd.clearDirty();
+    MIDIInputElementSysEx::updateAllWith(SysExMessage(chunk3));
+    EXPECT_STREQ(lcd.getText(), "cde     ");
+    EXPECT_TRUE(lcd.getDirty());
+    lcd.clearDirty();
+    // Continuation after the end of the message is ignored
+    MIDIInputElementSysEx::updateAllWith(SysExMessage(chunk3));
+    EXPECT_FALSE(lcd.getDirty());
+}
+
 TEST(LCDlength, len) {
     auto range = {0, 1, 2, 3, 4, 5, 6, 7};
     for (int a : range) {
@@ -202,3 +223,74 @@ TEST(LCDDisplay, multiple) {
     lcd_displays[1].draw();
     for (auto &lcd_display : lcd_displays) EXPECT_FALSE(lcd_display.getDirty());
 }
+
+TEST(LCD, DirtyRanges) {
+    MCU::LCD<> lcd(0);
+    struct Subscriber : MCU::LCDSubscriber {
+    } subscriber;
+    lcd.addSubscriber(subscriber);
+    subscriber.clearDirtyRanges();
+    using M = MCU::LCDSubscriber;
+
+    // Text of track 1, separator of track 1, text of track 2
+    std::vector<uint8_t> sysex = {
+        0xF0, 0x00, 0x00, 0x66, 0x10, 0x12, 0x0B, 'a', 'b', '|', 'c', 0xF7,
+    };
+    MIDIInputElementSysEx::updateAllWith(sysex);
+    EXPECT_EQ(subscriber.getDirtyRanges(),
+              M::getTextMask(1) | M::getSeparatorMask(1) | M::getTextMask(2));
+    subscriber.clearDirtyRanges();
+
+    // Same text again: nothing changed
+    MIDIInputElementSysEx::updateAllWith(sysex);
+    EXPECT_EQ(subscriber.getDirtyRanges(), 0u);
+
+    // Second line
+    sysex = {0xF0, 0x00, 0x00, 0x66, 0x10, 0x12, 0x38, 'x', 0xF7};
+    MIDIInputElementSysEx::updateAllWith(sysex);
+    EXPECT_EQ(subscriber.getDirtyRanges(), M::getTextMask(8));
+    EXPECT_EQ(std::string(lcd.getText()).substr(0, 16), "           ab|c ");
+    EXPECT_EQ(lcd.getText()[56], 'x');
+
+    lcd.removeSubscriber(subscriber);
+}
+
+TEST(LCDDisplay, perTrackDirty) {
+    using namespace std::string_view_literals;
+    MCU::LCD<> lcd(0);
+    OutputBank bank(4);
+    testing::NiceMock<TestDisplay> display;
+    MCU::LCDDisplay lcd_displays[] {
+        {display, lcd, bank, 1, 1, {0, 0}, 1, 0xFFFF},
+        {display, lcd, bank, 2, 1, {0, 0}, 1, 0xFFFF},
+    };
+    for (auto &lcd_display : lcd_displays) {
+        EXPECT_TRUE(lcd_display.getDirty());
+        lcd_display.draw();
+        EXPECT_FALSE(lcd_display.getDirty());
+    }
+
+    // Only the display of the second track changes
+    std::vector<uint8_t> sysex = {
+        0xF0, 0x00, 0x00, 0x66, 0x10, 0x12, 0x07, 'a', 'b', 'c', 0xF7,
+    };
+    MIDIInputElementSysEx::updateAllWith(sysex);
+    EXPECT_FALSE(lcd_displays[0].getDirty());
+    EXPECT_TRUE(lcd_displays[1].getDirty());
+    EXPECT_CALL(display, print("abc   "sv));
+    lcd_displays[1].draw();
+    EXPECT_FALSE(lcd_displays[1].getDirty());
+
+    // A separator changes: all tracks on that line might be affected
+    sysex = {0xF0, 0x00, 0x00, 0x66, 0x10, 0x12, 0x1B, '-', 0xF7};
+    MIDIInputElementSysEx::updateAllWith(sysex);
+    for (auto &lcd_display : lcd_displays)
+        EXPECT_TRUE(lcd_display.getDirty());
+    for (auto &lcd_display : lcd_displays)
+        lcd_display.draw();
+
+    // Changing the bank changes the tracks that are displayed
+    bank.select(1);
+    for (auto &lcd_display : lcd_displays)
+        EXPECT_TRUE(lcd_display.getDirty());
+}
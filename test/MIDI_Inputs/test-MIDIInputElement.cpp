@@ -4,6 +4,7 @@
 #include <MIDI_Inputs/MIDIInputElementMatchers.hpp>
 #include <MIDI_Inputs/NoteCCKPRange.hpp>
 #include <MIDI_Inputs/NoteCCKPValue.hpp>
+#include <MIDI_Inputs/PBValue.hpp>
 
 using namespace cs;
 
@@ -117,3 +118,171 @@ TEST(TwoByteRangeMIDIMatcher, ControlChange) {
         {MIDIMessageType::ControlChange, Channel_10, 0x18, 0x43});
     testing::Mock::VerifyAndClear(&mn);
 }
+
+// -------------------------------------------------------------------------- //
+
+struct MIDIInputDispatchIndexTest : ::testing::Test {
+    void SetUp() override { MIDIInputDispatchIndexBase::setEnabled(true); }
+    void TearDown() override {
+        MIDIInputDispatchIndexBase::setEnabled(false);
+        MIDIInputElementNote::rebuildDispatchIndex();
+        MIDIInputElementCC::rebuildDispatchIndex();
+        MIDIInputElementPB::rebuildDispatchIndex();
+    }
+};
+
+TEST_F(MIDIInputDispatchIndexTest, SingleAddresses) {
+    NoteValue a {{0x3C, Channel_5}};
+    NoteValue b {{0x3C, Channel_6}};
+    NoteValue c {{0x3C, Channel_5, Cable_2}};
+    NoteValue d {{0x3D, Channel_5}};
+    MIDIInputElementNote::rebuildDispatchIndex();
+
+    MIDIInputElementNote::updateAllWith(
+        {MIDIMessageType::NoteOn, Channel_5, 0x3C, 0x11});
+    MIDIInputElementNote::updateAllWith(
+        {MIDIMessageType::NoteOn, Channel_6, 0x3C, 0x22});
+    MIDIInputElementNote::updateAllWith(
+        {MIDIMessageType::NoteOn, Channel_5, 0x3C, 0x33, Cable_2});
+    MIDIInputElementNote::updateAllWith(
+        {MIDIMessageType::NoteOn, Channel_5, 0x3D, 0x44});
+    EXPECT_EQ(a.getValue(), 0x11);
+    EXPECT_EQ(b.getValue(), 0x22);
+    EXPECT_EQ(c.getValue(), 0x33);
+    EXPECT_EQ(d.getValue(), 0x44);
+
+    // No match
+    EXPECT_FALSE(MIDIInputElementNote::updateAllWith(
+        {MIDIMessageType::NoteOn, Channel_7, 0x3C, 0x55}));
+}
+
+TEST_F(MIDIInputDispatchIndexTest, Range) {
+    struct M : MatchingMIDIInputElement<MIDIMessageType::ControlChange,
+                                        TwoByteRangeMIDIMatcher> {
+        M(MIDIAddress a) : MatchingMIDIInputElement({a, 8}) {}
+        MOCK_METHOD(void, handleUpdateHelper, (uint8_t, uint8_t));
+        void handleUpdate(TwoByteRangeMIDIMatcher::Result m) override {
+            handleUpdateHelper(m.value, m.index);
+        }
+    } mn {{0x10, Channel_10}};
+
+    EXPECT_FALSE(MIDIInputElementCC::updateAllWith(
+        {MIDIMessageType::ControlChange, Channel_10, 0x0F, 0x40}));
+    EXPECT_CALL(mn, handleUpdateHelper(0x41, 1));
+    EXPECT_TRUE(MIDIInputElementCC::updateAllWith(
+        {MIDIMessageType::ControlChange, Channel_10, 0x11, 0x41}));
+    EXPECT_CALL(mn, handleUpdateHelper(0x42, 7));
+    EXPECT_TRUE(MIDIInputElementCC::updateAllWith(
+        {MIDIMessageType::ControlChange, Channel_10, 0x17, 0x42}));
+    EXPECT_FALSE(MIDIInputElementCC::updateAllWith(
+        {MIDIMessageType::ControlChange, Channel_10, 0x18, 0x43}));
+}
+
+TEST_F(MIDIInputDispatchIndexTest, Bankable) {
+    Bank<4> bank(4);
+    Bankable::NoteValue<4> addr {{bank, BankType::ChangeAddress},
+                                 {0x10, Channel_1}};
+    Bankable::NoteValue<4> chan {{bank, BankType::ChangeChannel},
+                                 {0x20, Channel_1}};
+    bank.select(2);
+
+    MIDIInputElementNote::updateAllWith(
+        {MIDIMessageType::NoteOn, Channel_1, 0x18, 0x11});
+    MIDIInputElementNote::updateAllWith(
+        {MIDIMessageType::NoteOn, Channel_9, 0x20, 0x22});
+    EXPECT_EQ(addr.getValue(), 0x11);
+    EXPECT_EQ(chan.getValue(), 0x22);
+    EXPECT_EQ(addr.getValue(0), 0x00);
+    EXPECT_EQ(chan.getValue(0), 0x00);
+}
+
+TEST_F(MIDIInputDispatchIndexTest, UnindexedElementAndDisable) {
+    struct Unindexed : MIDIInputElementPB {
+        MOCK_METHOD(bool, updateWith, (ChannelMessage), (override));
+    } unindexed;
+    PBValue pb {Channel_3};
+
+    EXPECT_CALL(unindexed, updateWith(testing::_)).Times(0);
+    MIDIInputElementPB::updateAllWith(
+        {MIDIMessageType::PitchBend, Channel_3, 0x01, 0x02});
+    EXPECT_EQ(pb.getValue(), 0x0101);
+    testing::Mock::VerifyAndClear(&unindexed);
+
+    EXPECT_CALL(unindexed, updateWith(testing::_))
+        .WillOnce(testing::Return(true));
+    MIDIInputElementPB::updateAllWith(
+        {MIDIMessageType::PitchBend, Channel_4, 0x01, 0x02});
+    testing::Mock::VerifyAndClear(&unindexed);
+
+    pb.disable();
+    EXPECT_CALL(unindexed, updateWith(testing::_))
+        .WillOnce(testing::Return(false));
+    MIDIInputElementPB::updateAllWith(
+        {MIDIMessageType::PitchBend, Channel_3, 0x03, 0x04});
+    EXPECT_EQ(pb.getValue(), 0x0101);
+    testing::Mock::VerifyAndClear(&unindexed);
+
+    MIDIInputElementPB::enable(pb);
+    MIDIInputElementPB::updateAllWith(
+        {MIDIMessageType::PitchBend, Channel_3, 0x03, 0x04});
+    EXPECT_EQ(pb.getValue(), 0x0203);
+}
+
+TEST_F(MIDIInputDispatchIndexTest, BankSelectKeepsIndex) {
+    struct Counting : NoteValue {
+        using NoteValue::NoteValue;
+        bool getDispatchKeys(MIDIInputDispatchKeys &keys) const override {
+            ++calls;
+            return NoteValue::getDispatchKeys(keys);
+        }
+        mutable unsigned calls = 0;
+    } counting {{0x01, Channel_1}};
+    Bank<4> bank(4);
+    Bankable::NoteValue<4> addr {{bank, BankType::ChangeAddress},
+                                 {0x10, Channel_1}};
+    MIDIInputElementNote::rebuildDispatchIndex();
+    unsigned calls = counting.calls;
+
+    // Selecting a bank doesn't change the keys, no need to rebuild the index
+    for (setting_t b = 0; b < 4; ++b) {
+        bank.select(b);
+        MIDIInputElementNote::updateAllWith(
+            {MIDIMessageType::NoteOn, Channel_1, uint8_t(0x10 + 4 * b), b});
+        EXPECT_EQ(addr.getValue(), b);
+    }
+    EXPECT_EQ(counting.calls, calls);
+}
+
+struct KeysNote : MIDIInputElementNote {
+    KeysNote(std::vector<uint8_t> addresses, unsigned repeat = 1)
+        : addresses(std::move(addresses)), repeat(repeat) {}
+    MOCK_METHOD(bool, updateWith, (ChannelMessage), (override));
+    bool getDispatchKeys(MIDIInputDispatchKeys &keys) const override {
+        for (unsigned r = 0; r < repeat; ++r)
+            for (uint8_t a : addresses)
+                keys.add(a, 0, 0);
+        return true;
+    }
+    std::vector<uint8_t> addresses;
+    unsigned repeat;
+};
+
+TEST_F(MIDIInputDispatchIndexTest, DuplicateKeys) {
+    // Overlapping banks may report the same key more than once
+    KeysNote el {{0x10, 0x11, 0x10}};
+    ChannelMessage msg {MIDIMessageType::NoteOn, Channel_1, 0x10, 0x7F};
+    EXPECT_CALL(el, updateWith(msg)).WillOnce(testing::Return(false));
+    EXPECT_FALSE(MIDIInputElementNote::updateAllWith(msg));
+}
+
+TEST_F(MIDIInputDispatchIndexTest, TooManyKeys) {
+    // More keys than fit in the index, falls back to linear dispatch
+    std::vector<uint8_t> all(128);
+    for (uint8_t i = 0; i < 128; ++i)
+        all[i] = i;
+    KeysNote el {all, MIDIInputDispatchIndex<MIDIInputElementNote,
+                                             true>::MaxKeys / 128 + 1};
+    ChannelMessage msg {MIDIMessageType::NoteOn, Channel_2, 0x10, 0x7F};
+    EXPECT_CALL(el, updateWith(msg)).WillOnce(testing::Return(true));
+    EXPECT_TRUE(MIDIInputElementNote::updateAllWith(msg));
+}
@@ -17,7 +17,6 @@ TEST(MCUVU, setValue) {
         (track - 1) << 4 | 0xA,
         0,
     };
-    EXPECT_CALL(ArduinoMock::getInstance(), millis()).WillOnce(Return(0));
     MIDIInputElementCP::updateAllWith(midimsg);
     EXPECT_EQ(vu.getValue(), 0xA);
 
@@ -75,7 +74,6 @@ TEST(MCUVU, retainValueAfterOverload) {
         (track - 1) << 4 | 0x6,
         0,
     };
-    EXPECT_CALL(ArduinoMock::getInstance(), millis()).WillOnce(Return(0));
     MIDIInputElementCP::updateAllWith(midimsg);
     EXPECT_EQ(vu.getValue(), 0x6);
     ChannelMessage midimsgSet = {
@@ -110,12 +108,128 @@ TEST(MCUVU, decay) {
         (track - 1) << 4 | 0xA,
         0,
     };
-    EXPECT_CALL(ArduinoMock::getInstance(), millis()).WillOnce(Return(0));
     MIDIInputElementCP::updateAllWith(midimsg);
     EXPECT_EQ(vu.getValue(), 0xA);
+    auto &clock = MCU::VUDecayClock::get(decayTime);
+    EXPECT_EQ(clock.getDecayTime(), decayTime);
+    EXPECT_CALL(ArduinoMock::getInstance(), millis()).WillOnce(Return(0));
+    clock.begin();
+    // The meters don't decay by themselves
+    MIDIInputElementCP::updateAll();
+    EXPECT_EQ(vu.getValue(), 0xA);
+    // A new value is held for one tick
     EXPECT_CALL(ArduinoMock::getInstance(), millis())
         .WillOnce(Return(decayTime));
-    MIDIInputElementCP::updateAll();
+    clock.update();
+    EXPECT_EQ(vu.getValue(), 0xA);
+    EXPECT_CALL(ArduinoMock::getInstance(), millis())
+        .WillOnce(Return(2 * decayTime - 1));
+    clock.update();
+    EXPECT_EQ(vu.getValue(), 0xA);
+    EXPECT_CALL(ArduinoMock::getInstance(), millis())
+        .WillOnce(Return(2 * decayTime));
+    clock.update();
+    EXPECT_EQ(vu.getValue(), 0x9);
+
+    Mock::VerifyAndClear(&ArduinoMock::getInstance());
+}
+
+TEST(MCUVU, sharedDecayClock) {
+    constexpr Channel channel = Channel_3;
+    constexpr unsigned int decayTime = 300;
+    MCU::VU vu1 = {1, channel, decayTime};
+    MCU::VU vu2 = {2, channel, decayTime};
+    MCU::VU vu3 = {3, channel, MCU::VUDecay::Hold};
+    auto &clock = MCU::VUDecayClock::get(decayTime);
+    EXPECT_CALL(ArduinoMock::getInstance(), millis()).WillOnce(Return(0));
+    clock.begin();
+
+    MIDIInputElementCP::updateAllWith({0xD2, 0x0A, 0x00});
+    MIDIInputElementCP::updateAllWith({0xD2, 0x12, 0x00});
+    MIDIInputElementCP::updateAllWith({0xD2, 0x25, 0x00});
+    vu1.clearDirty();
+    vu2.clearDirty();
+    // Hold the new values for one tick
+    EXPECT_CALL(ArduinoMock::getInstance(), millis())
+        .WillOnce(Return(decayTime));
+    clock.update();
+    EXPECT_EQ(vu1.getValue(), 0xA);
+    EXPECT_EQ(vu2.getValue(), 0x2);
+    // Both meters decay at the same time, only when the clock ticks
+    for (unsigned i = 2; i < 12; ++i) {
+        EXPECT_CALL(ArduinoMock::getInstance(), millis())
+            .WillOnce(Return(i * decayTime));
+        clock.update();
+        EXPECT_EQ(vu1.getValue(), std::max(0xA + 1 - int(i), 0)) << i;
+        EXPECT_EQ(vu2.getValue(), std::max(0x2 + 1 - int(i), 0)) << i;
+        EXPECT_EQ(vu1.getDirty(), i <= 0xA + 1) << i;
+        EXPECT_EQ(vu2.getDirty(), i <= 0x2 + 1) << i;
+        vu1.clearDirty();
+        vu2.clearDirty();
+    }
+    // Hold doesn't decay
+    EXPECT_EQ(vu3.getValue(), 0x5);
+
+    Mock::VerifyAndClear(&ArduinoMock::getInstance());
+}
+
+TEST(MCUVU, releaseDecayClock) {
+    {
+        MCU::VU vu1 = {1, Channel_3, 100};
+        MCU::VU vu2 = {2, Channel_3, 200};
+        EXPECT_EQ(MCU::VUDecayClock::get(100).getDecayTime(), 100u);
+        EXPECT_EQ(MCU::VUDecayClock::get(200).getDecayTime(), 200u);
+        // All clocks are in use
+        try {
+            MCU::VU vu3 = {3, Channel_3, 400};
+            FAIL();
+        } catch (AH::ErrorException &e) {
+            EXPECT_EQ(e.getErrorCode(), 0x7512);
+        }
+    }
+    // The clocks can be reused once their meters are destroyed
+    MCU::VU vu3 = {3, Channel_3, 300};
+    MCU::VU vu4 = {4, Channel_3, 400};
+    auto &clock3 = MCU::VUDecayClock::get(300);
+    auto &clock4 = MCU::VUDecayClock::get(400);
+    EXPECT_EQ(clock3.getDecayTime(), 300u);
+    EXPECT_EQ(clock4.getDecayTime(), 400u);
+    EXPECT_NE(&clock3, &clock4);
+}
+
+TEST(MCUVU, disabledMetersDontDecay) {
+    constexpr unsigned int decayTime = 300;
+    MCU::VU vu = {1, Channel_3, decayTime};
+    auto &clock = MCU::VUDecayClock::get(decayTime);
+    EXPECT_CALL(ArduinoMock::getInstance(), millis()).WillOnce(Return(0));
+    clock.begin();
+    MIDIInputElementCP::updateAllWith({0xD2, 0x0A, 0x00});
+
+    // The clock doesn't even check the time without meters
+    vu.disable();
+    for (unsigned i = 1; i < 5; ++i)
+        clock.update();
+    EXPECT_EQ(vu.getValue(), 0xA);
+    Mock::VerifyAndClear(&ArduinoMock::getInstance());
+
+    // After enabling the meter again, the clock doesn't catch up on the
+    // missed ticks
+    vu.enable();
+    EXPECT_CALL(ArduinoMock::getInstance(), millis())
+        .WillOnce(Return(10 * decayTime));
+    clock.update();
+    EXPECT_CALL(ArduinoMock::getInstance(), millis())
+        .WillOnce(Return(11 * decayTime - 1));
+    clock.update();
+    EXPECT_EQ(vu.getValue(), 0xA);
+    // A new value is held for one tick
+    EXPECT_CALL(ArduinoMock::getInstance(), millis())
+        .WillOnce(Return(11 * decayTime));
+    clock.update();
+    EXPECT_EQ(vu.getValue(), 0xA);
+    EXPECT_CALL(ArduinoMock::getInstance(), millis())
+        .WillOnce(Return(12 * decayTime));
+    clock.update();
     EXPECT_EQ(vu.getValue(), 0x9);
 
     Mock::VerifyAndClear(&ArduinoMock::getInstance());
@@ -132,7 +246,6 @@ TEST(MCUVU, getFloatValue) {
         (track - 1) << 4 | 0xA,
         0,
     };
-    EXPECT_CALL(ArduinoMock::getInstance(), millis()).WillOnce(Return(0));
     MIDIInputElementCP::updateAllWith(midimsg);
     EXPECT_FLOAT_EQ(vu.getFloatValue(), 10.0f / 12);
 
@@ -150,7 +263,6 @@ TEST(MCUVU, reset) {
         (track - 1) << 4 | 0xA,
         0,
     };
-    EXPECT_CALL(ArduinoMock::getInstance(), millis()).WillOnce(Return(0));
     MIDIInputElementCP::updateAllWith(midimsg);
     EXPECT_EQ(vu.getValue(), 0xA);
     MIDIInputElementCP::resetAll();
@@ -172,8 +284,6 @@ TEST(MCUVUBankable, setValueBankChangeAddress) {
         (track + 4 - 1) << 4 | 0xA,
         0,
     };
-    // Active bank is never updated, so decay timer is never reset, and millis
-    // shouldn't be called.
     MIDIInputElementCP::updateAllWith(midimsg);
     EXPECT_EQ(vu.getValue(), 0x0);
     bank.select(1);
@@ -199,8 +309,6 @@ TEST(MCUVUBankable, setValueBankChangeChannel) {
         (track - 1) << 4 | 0xB,
         0,
     };
-    // Active bank is never updated, so decay timer is never reset, and millis
-    // shouldn't be called.
     MIDIInputElementCP::updateAllWith(midimsg1);
     MIDIInputElementCP::updateAllWith(midimsg2);
     EXPECT_EQ(vu.getValue(), 0x0);
@@ -231,8 +339,6 @@ TEST(MCUVUBankable, setValueBankChangeCN) {
         0,
         Cable_9,
     };
-    // Active bank is never updated, so decay timer is never reset, and millis
-    // shouldn't be called.
     MIDIInputElementCP::updateAllWith(midimsg1);
     MIDIInputElementCP::updateAllWith(midimsg2);
     EXPECT_EQ(vu.getValue(), 0x0);
@@ -244,6 +350,35 @@ TEST(MCUVUBankable, setValueBankChangeCN) {
     Mock::VerifyAndClear(&ArduinoMock::getInstance());
 }
 
+TEST(MCUVUBankable, decay) {
+    Bank<2> bank(4);
+    constexpr Channel channel = Channel_3;
+    constexpr uint8_t track = 5;
+    constexpr unsigned int decayTime = 300;
+    MCU::Bankable::VU<2> vu = {bank, track, channel, decayTime};
+    auto &clock = MCU::VUDecayClock::get(decayTime);
+    EXPECT_CALL(ArduinoMock::getInstance(), millis()).WillOnce(Return(0));
+    clock.begin();
+
+    MIDIInputElementCP::updateAllWith({0xD2, (track - 1) << 4 | 0x4, 0x00});
+    MIDIInputElementCP::updateAllWith(
+        {0xD2, (track + 4 - 1) << 4 | 0x7, 0x00});
+    vu.clearDirty();
+    EXPECT_CALL(ArduinoMock::getInstance(), millis())
+        .WillOnce(Return(decayTime));
+    clock.update();
+    EXPECT_FALSE(vu.getDirty());
+    // All banks decay, but only the active bank marks the meter dirty
+    EXPECT_CALL(ArduinoMock::getInstance(), millis())
+        .WillOnce(Return(2 * decayTime));
+    clock.update();
+    EXPECT_TRUE(vu.getDirty());
+    EXPECT_EQ(vu.getValue(0), 0x3);
+    EXPECT_EQ(vu.getValue(1), 0x6);
+
+    Mock::VerifyAndClear(&ArduinoMock::getInstance());
+}
+
 TEST(MCUVUBankable, overloadBankChangeAddress) {
     Bank<2> bank(4);
     constexpr Channel channel = Channel_3;
@@ -309,7 +444,6 @@ TEST(MCUVULEDsBankable, displayOnBankChange) {
         (track + 4 - 1) << 4 | 0x6,
         0,
     };
-    EXPECT_CALL(ArduinoMock::getInstance(), millis()).WillOnce(Return(0));
     EXPECT_CALL(ArduinoMock::getInstance(), digitalWrite(0, HIGH));
     EXPECT_CALL(ArduinoMock::getInstance(), digitalWrite(1, HIGH));
     MIDIInputElementCP::updateAllWith(midimsg1);
@@ -319,15 +453,13 @@ TEST(MCUVULEDsBankable, displayOnBankChange) {
     EXPECT_EQ(vu.getValue(), 0xC);
     Mock::VerifyAndClear(&ArduinoMock::getInstance());
 
-    EXPECT_CALL(ArduinoMock::getInstance(), millis()).WillOnce(Return(0));
     EXPECT_CALL(ArduinoMock::getInstance(), digitalWrite(0, HIGH));
     EXPECT_CALL(ArduinoMock::getInstance(), digitalWrite(1, LOW));
-    bank.select(1); // marks dirty
-    vu.update();    // notices dirty flag and updates the LEDs
+    bank.select(1); // marks dirty and updates the LEDs
+    vu.update();    // nothing to decay, that's done by the VUDecayClock
     EXPECT_EQ(vu.getValue(), 0x6);
     Mock::VerifyAndClear(&ArduinoMock::getInstance());
 
-    EXPECT_CALL(ArduinoMock::getInstance(), millis()).WillOnce(Return(0));
     EXPECT_CALL(ArduinoMock::getInstance(), digitalWrite(0, HIGH));
     EXPECT_CALL(ArduinoMock::getInstance(), digitalWrite(1, HIGH));
     bank.select(0);
@@ -0,0 +1,80 @@
+#include <MIDI_Interfaces/BLEMIDI/BLEMIDIMessageQueue.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+USING_CS_NAMESPACE;
+
+using bvec = std::vector<uint8_t>;
+
+TEST(MPSCQueue, pushPop) {
+    MPSCQueue<int, 4> q;
+    EXPECT_TRUE(q.empty());
+    EXPECT_EQ(q.front(), nullptr);
+    for (int i = 0; i < 4; ++i)
+        EXPECT_TRUE(q.push(i));
+    EXPECT_FALSE(q.push(4));
+    int value;
+    EXPECT_TRUE(q.pop(value));
+    EXPECT_EQ(value, 0);
+    EXPECT_TRUE(q.push(4));
+    for (int i = 1; i < 5; ++i) {
+        ASSERT_NE(q.front(), nullptr);
+        EXPECT_EQ(*q.front(), i);
+        q.pop();
+    }
+    EXPECT_TRUE(q.empty());
+    EXPECT_FALSE(q.pop(value));
+}
+
+TEST(MPSCQueue, multipleProducers) {
+    constexpr unsigned NumThreads = 4;
+    constexpr unsigned NumMessages = 20000;
+    MPSCQueue<unsigned, 64> q;
+    std::vector<std::thread> producers;
+    for (unsigned t = 0; t < NumThreads; ++t)
+        producers.emplace_back([&q, t] {
+            for (unsigned i = 0; i < NumMessages; ++i)
+                while (!q.push(t * NumMessages + i))
+                    std::this_thread::yield();
+        });
+
+    // The messages of every producer should arrive in order, exactly once
+    std::vector<unsigned> next(NumThreads);
+    for (unsigned received = 0; received < NumThreads * NumMessages;) {
+        unsigned value;
+        if (!q.pop(value)) {
+            std::this_thread::yield();
+            continue;
+        }
+        unsigned t = value / NumMessages;
+        ASSERT_LT(t, NumThreads);
+        ASSERT_EQ(value % NumMessages, next[t]);
+        ++next[t];
+        ++received;
+    }
+    for (auto &producer : producers)
+        producer.join();
+    EXPECT_TRUE(q.empty());
+}
+
+TEST(BLEMIDIQueuedMessage, addTo) {
+    BLEMIDIPacketBuilder b;
+    uint16_t ts = (0x01 << 7) | 0x02;
+    EXPECT_TRUE((BLEMIDIQueuedMessage {0x92, 0x12, 0x34, 2, ts}.addTo(b)));
+    EXPECT_TRUE((BLEMIDIQueuedMessage {0xC3, 0x05, 0x00, 1, ts}.addTo(b)));
+    EXPECT_TRUE((BLEMIDIQueuedMessage {0xF8, 0x00, 0x00, 0, ts}.addTo(b)));
+    EXPECT_TRUE((BLEMIDIQueuedMessage {0xF3, 0x07, 0x00, 1, ts}.addTo(b)));
+    bvec expected = {
+        0x81,             // header + timestamp msb
+        0x82, 0x92, 0x12, // timestamp lsb + note on
+        0x34,             //
+        0x82, 0xC3, 0x05, // timestamp lsb + program change
+        0x82, 0xF8,       // timestamp lsb + real-time
+        0x82, 0xF3, 0x07, // timestamp lsb + song select
+    };
+    EXPECT_EQ(b.getPacket(), expected);
+}
@@ -0,0 +1,216 @@
+#include <MIDI_Interfaces/BLEMIDI/BLEMIDIPacketScheduler.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+USING_CS_NAMESPACE;
+
+using bvec = std::vector<uint8_t>;
+
+static BLEMIDIQueuedMessage noteOn(uint8_t note, uint16_t timestamp) {
+    return {0x90, note, 0x7F, 2, timestamp};
+}
+static BLEMIDIQueuedMessage controlChange(uint8_t value, uint16_t timestamp) {
+    return {0xB0, 0x07, value, 2, timestamp};
+}
+
+TEST(BLEMIDIPacketScheduler, priority) {
+    BLEMIDIPacketScheduler s;
+    BLEMIDIPacketBuilder b;
+    b.setCapacity(8);
+    EXPECT_TRUE(s.push(controlChange(0x01, 0x10)));
+    EXPECT_TRUE(s.push(controlChange(0x02, 0x10)));
+    EXPECT_TRUE(s.push(noteOn(0x3C, 0x10)));
+    EXPECT_TRUE(s.push({0xF8, 0, 0, 0, 0x10}));
+
+    EXPECT_EQ(s.fillPacket(b), 2);
+    bvec expected1 = {
+        0x80,             // header + timestamp msb
+        0x90, 0x90, 0x3C, // timestamp lsb + note on
+        0x7F,             //
+        0x90, 0xF8,       // timestamp lsb + clock
+    };
+    EXPECT_EQ(b.getPacket(), expected1);
+
+    b.reset();
+    EXPECT_EQ(s.fillPacket(b), 2);
+    bvec expected2 = {
+        0x80,             // header + timestamp msb
+        0x90, 0xB0, 0x07, // timestamp lsb + control change
+        0x01,             //
+        0x07, 0x02,       // running status
+    };
+    EXPECT_EQ(b.getPacket(), expected2);
+    EXPECT_TRUE(s.empty());
+    b.reset();
+    EXPECT_EQ(s.fillPacket(b), 0);
+}
+
+TEST(BLEMIDIPacketScheduler, isHighPriority) {
+    EXPECT_TRUE(BLEMIDIPacketScheduler::isHighPriority(noteOn(1, 0)));
+    EXPECT_TRUE(
+        BLEMIDIPacketScheduler::isHighPriority({0x85, 0x10, 0x00, 2, 0}));
+    EXPECT_TRUE(
+        BLEMIDIPacketScheduler::isHighPriority({0xC5, 0x10, 0x00, 1, 0}));
+    EXPECT_TRUE(
+        BLEMIDIPacketScheduler::isHighPriority({0xF3, 0x10, 0x00, 1, 0}));
+    EXPECT_TRUE(BLEMIDIPacketScheduler::isHighPriority({0xFA, 0, 0, 0, 0}));
+    EXPECT_FALSE(BLEMIDIPacketScheduler::isHighPriority(controlChange(1, 0)));
+    EXPECT_FALSE(
+        BLEMIDIPacketScheduler::isHighPriority({0xE1, 0x00, 0x40, 2, 0}));
+    EXPECT_FALSE(
+        BLEMIDIPacketScheduler::isHighPriority({0xA2, 0x10, 0x40, 2, 0}));
+    EXPECT_FALSE(
+        BLEMIDIPacketScheduler::isHighPriority({0xD3, 0x40, 0x00, 1, 0}));
+}
+
+// Timestamps within a packet should never decrease, even if a newer note was
+// sent before an older control change
+TEST(BLEMIDIPacketScheduler, monotonicTimestamps) {
+    BLEMIDIPacketScheduler s;
+    BLEMIDIPacketBuilder b;
+    s.push(controlChange(0x01, 0x0105));
+    s.push(noteOn(0x3C, 0x0107));
+    EXPECT_EQ(s.fillPacket(b), 2);
+    bvec expected = {
+        0x82,             // header + timestamp msb
+        0x87, 0x90, 0x3C, // timestamp lsb + note on
+        0x7F,             //
+        0x87, 0xB0, 0x07, // timestamp lsb (of the note) + control change
+        0x01,             //
+    };
+    EXPECT_EQ(b.getPacket(), expected);
+}
+
+// Messages that don't fit in an empty packet are dropped, otherwise the
+// senders would keep on trying to send them forever
+TEST(BLEMIDIPacketScheduler, dropTooLarge) {
+    BLEMIDIPacketScheduler s;
+    // A small MTU: a three-byte message needs five bytes with the header and
+    // the timestamp
+    BLEMIDIPacketBuilder b {4};
+    BLEMIDIQueuedMessage tooLarge = noteOn(0x3C, 0x10);
+    s.push(tooLarge);
+    EXPECT_EQ(s.fillPacket(b), 0);
+    EXPECT_TRUE(b.empty());
+    EXPECT_TRUE(s.empty());
+
+    // If the packet isn't empty, the message could fit in the next one
+    s.push({0xF8, 0, 0, 0, 0x10});
+    s.push(tooLarge);
+    s.push({0xFA, 0, 0, 0, 0x10});
+    EXPECT_EQ(s.fillPacket(b), 1);
+    EXPECT_FALSE(s.empty());
+    b.reset();
+    EXPECT_EQ(s.fillPacket(b), 1);
+    EXPECT_TRUE(s.empty());
+    bvec expected = {0x80, 0x90, 0xFA};
+    EXPECT_EQ(b.getPacket(), expected);
+}
+
+TEST(BLEMIDIPacketScheduler, queueFull) {
+    BLEMIDIPacketScheduler s;
+    for (uint8_t i = 0; i < BLEMIDIPacketScheduler::QueueSize; ++i)
+        EXPECT_TRUE(s.push(controlChange(i, 0)));
+    EXPECT_FALSE(s.push(controlChange(0x7F, 0)));
+    // The high priority queue is separate
+    EXPECT_TRUE(s.push(noteOn(0x3C, 0)));
+}
+
+TEST(BLEMIDIPacketScheduler, slots) {
+    BLEMIDIPacketScheduler s;
+    s.setConnectionInterval(7500);
+    s.setMaxPacketsPerInterval(2);
+    EXPECT_TRUE(s.isEnabled());
+
+    // The first slot starts right away
+    EXPECT_EQ(s.getTimeUntilSlot(1000), 0ul);
+    s.startSlot(1000);
+    EXPECT_EQ(s.getTimeUntilSlot(1000), 7500ul);
+    EXPECT_TRUE(s.canSendPacket());
+    s.packetSent(3);
+    s.packetSent(5);
+    EXPECT_FALSE(s.canSendPacket());
+
+    // Flushing early doesn't reset the budget
+    s.startSlot(3000);
+    EXPECT_FALSE(s.canSendPacket());
+    EXPECT_EQ(s.getTimeUntilSlot(3000), 5500ul);
+
+    // The next slots are aligned to the first one, even if we're a bit late
+    s.startSlot(9000);
+    EXPECT_TRUE(s.canSendPacket());
+    EXPECT_EQ(s.getTimeUntilSlot(9000), 7000ul);
+
+    // After an idle period, the timing is synchronized again
+    s.startSlot(100000);
+    EXPECT_EQ(s.getTimeUntilSlot(100000), 7500ul);
+
+    EXPECT_EQ(s.getStatistics().packets, 2u);
+    EXPECT_EQ(s.getStatistics().messages, 8u);
+    EXPECT_FLOAT_EQ(s.getStatistics().getMessagesPerPacket(), 4);
+    s.resetStatistics();
+    EXPECT_EQ(s.getStatistics().packets, 0u);
+}
+
+// Simulates a BLE link with a 7.5 ms connection interval, with a flood of
+// control changes and a note every 10 ms, for one second.
+TEST(BLEMIDIPacketScheduler, simulatedLink) {
+    constexpr unsigned long interval = 7500;
+    constexpr uint8_t maxPackets = 2;
+    BLEMIDIPacketScheduler s;
+    s.setConnectionInterval(interval);
+    s.setMaxPacketsPerInterval(maxPackets);
+    BLEMIDIPacketBuilder b;
+    b.setCapacity(23 - 3);
+
+    std::vector<unsigned long> noteTimes;
+    unsigned long maxNoteLatency = 0;
+    unsigned packetsInEvent = 0, maxPacketsInEvent = 0;
+    unsigned rejectedCCs = 0;
+    for (unsigned long now = 0; now < 1000000; now += 250) {
+        uint16_t timestamp = (now / 1000) % 8192;
+        // Flood of control changes: one every 250 µs
+        if (!s.push(controlChange(now / 250 % 128, timestamp)))
+            ++rejectedCCs;
+        // One note every 10 ms
+        if (now % 10000 == 0) {
+            s.push(noteOn(now / 10000 % 128, timestamp));
+            noteTimes.push_back(now);
+        }
+        // Connection event
+        if (now % interval == 0) {
+            maxPacketsInEvent = std::max(maxPacketsInEvent, packetsInEvent);
+            packetsInEvent = 0;
+        }
+        if (s.getTimeUntilSlot(now) > 0)
+            continue;
+        s.startSlot(now);
+        do {
+            b.reset();
+            uint16_t count = s.fillPacket(b);
+            if (b.empty())
+                break;
+            ++packetsInEvent;
+            s.packetSent(count);
+            // Check the latency of the notes in this packet
+            auto &pkt = b.getPacket();
+            for (size_t i = 2; i + 1 < pkt.size(); ++i) {
+                // Status byte of a note on, preceded by a timestamp
+                if (pkt[i] != 0x90 || (pkt[i - 1] & 0x80) == 0)
+                    continue;
+                unsigned long sent = noteTimes.at(pkt[i + 1]);
+                maxNoteLatency = std::max(maxNoteLatency, now - sent);
+            }
+        } while (s.canSendPacket());
+    }
+
+    // No more packets than the BLE stack can handle per connection event
+    EXPECT_LE(maxPacketsInEvent, maxPackets);
+    // Notes are never delayed by more than one interval, even though the link
+    // cannot keep up with the control changes
+    EXPECT_LT(maxNoteLatency, interval);
+    EXPECT_GT(rejectedCCs, 0u);
+    // The packets are (almost) full
+    EXPECT_GT(s.getStatistics().getMessagesPerPacket(), 6);
+}
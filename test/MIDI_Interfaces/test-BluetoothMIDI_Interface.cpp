@@ -3,6 +3,8 @@
 #include <MIDI_Interfaces/GenericBLEMIDI_Interface.hpp>
 #include <MIDI_Interfaces/MIDI_Callbacks.hpp>
 
+#include <thread>
+
 using namespace cs;
 using testing::Mock;
 
@@ -791,3 +793,86 @@ TEST(BluetoothMIDIInterface, sendLongSysExFlush) {
 
     Mock::VerifyAndClear(&ArduinoMock::getInstance());
 }
+
+TEST(BluetoothMIDIInterface, sendFromMultipleThreads) {
+    constexpr uint8_t NumThreads = 4;
+    constexpr uint8_t NumMessages = 100;
+    BluetoothMIDI_Interface midi;
+    midi.begin();
+    midi.setTimeout(std::chrono::milliseconds {1});
+
+    std::vector<std::vector<uint8_t>> packets;
+    EXPECT_CALL(ArduinoMock::getInstance(), millis())
+        .WillRepeatedly(Return(timestamp(0x01, 0x02)));
+    EXPECT_CALL(midi.backend, notifyMIDIBLE(_))
+        .WillRepeatedly(Invoke([&](const std::vector<uint8_t> &packet) {
+            packets.push_back(packet); // called by the sender thread only
+        }));
+
+    std::vector<std::thread> threads;
+    for (uint8_t t = 0; t < NumThreads; ++t)
+        threads.emplace_back([&midi, t] {
+            for (uint8_t i = 0; i < NumMessages; ++i)
+                midi.sendNoteOn({i, Channel(t)}, 0x7F);
+        });
+    for (auto &thread : threads)
+        thread.join();
+    midi.sendNow();
+    Mock::VerifyAndClear(&midi.backend);
+
+    // Parse the packets again, the messages of each thread should arrive in
+    // order, exactly once
+    MockMIDI_Callbacks cb;
+    BluetoothMIDI_Interface receiver;
+    receiver.setCallbacks(&cb);
+    for (auto &packet : packets) {
+        receiver.parse(packet.data(), packet.size());
+        receiver.update();
+    }
+    ASSERT_EQ(cb.channelMessages.size(), size_t(NumThreads) * NumMessages);
+    uint8_t next[NumThreads] {};
+    for (auto msg : cb.channelMessages) {
+        uint8_t t = msg.getChannel().getRaw();
+        ASSERT_LT(t, NumThreads);
+        EXPECT_EQ(msg.data1, next[t]++);
+    }
+
+    Mock::VerifyAndClear(&ArduinoMock::getInstance());
+}
+
+TEST(BluetoothMIDIInterface, sendAtConnectionInterval) {
+    std::chrono::milliseconds interval {50};
+    BluetoothMIDI_Interface midi;
+    midi.begin();
+    midi.setConnectionInterval(interval);
+
+    std::vector<uint8_t> expected[] = {
+        {0x81, 0x82, 0x92, 0x12, 0x34},
+        {0x81, 0x83, 0x92, 0x13, 0x35, 0x14, 0x36},
+    };
+    EXPECT_CALL(ArduinoMock::getInstance(), millis())
+        .WillOnce(Return(timestamp(0x01, 0x02)))
+        .WillRepeatedly(Return(timestamp(0x01, 0x03)));
+
+    // The first message after an idle period is sent right away
+    EXPECT_CALL(midi.backend, notifyMIDIBLE(expected[0]));
+    midi.sendNoteOn({0x12, Channel_3}, 0x34);
+    std::this_thread::sleep_for(interval * 0.2);
+    Mock::VerifyAndClear(&midi.backend);
+
+    // The following messages wait for the next connection interval
+    EXPECT_CALL(midi.backend, notifyMIDIBLE(_)).Times(0);
+    midi.sendNoteOn({0x13, Channel_3}, 0x35);
+    midi.sendNoteOn({0x14, Channel_3}, 0x36);
+    std::this_thread::sleep_for(interval * 0.4);
+    Mock::VerifyAndClear(&midi.backend);
+    EXPECT_CALL(midi.backend, notifyMIDIBLE(expected[1]));
+    std::this_thread::sleep_for(interval * 0.8);
+    Mock::VerifyAndClear(&midi.backend);
+
+    auto stats = midi.getPacketStatistics();
+    EXPECT_EQ(stats.packets, 2u);
+    EXPECT_EQ(stats.messages, 3u);
+
+    Mock::VerifyAndClear(&ArduinoMock::getInstance());
+}
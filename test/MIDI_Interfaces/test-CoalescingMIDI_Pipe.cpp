@@ -0,0 +1,146 @@
+#include <MIDI_Interfaces/CoalescingMIDI_Pipe.hpp>
+#include <MIDI_Interfaces/MIDI_Staller.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+USING_CS_NAMESPACE;
+using ::testing::InSequence;
+using ::testing::StrictMock;
+
+struct MockCoalescedMIDI_Sink : TrueMIDI_Sink {
+    MOCK_METHOD(void, sinkMIDIfromPipe, (ChannelMessage), (override));
+    MOCK_METHOD(void, sinkMIDIfromPipe, (SysExMessage), (override));
+    MOCK_METHOD(void, sinkMIDIfromPipe, (SysCommonMessage), (override));
+    MOCK_METHOD(void, sinkMIDIfromPipe, (RealTimeMessage), (override));
+};
+
+TEST(CoalescingMIDI_Pipe, lastValueWins) {
+    StrictMock<MockCoalescedMIDI_Sink> sink;
+    CoalescingMIDI_Pipe<8> pipe;
+    TrueMIDI_Source source;
+    source >> pipe >> sink;
+
+    source.sourceMIDItoPipe(ChannelMessage {0xB0, 0x10, 0x01});
+    source.sourceMIDItoPipe(ChannelMessage {0xE1, 0x00, 0x40});
+    source.sourceMIDItoPipe(ChannelMessage {0xB0, 0x10, 0x02});
+    source.sourceMIDItoPipe(ChannelMessage {0xB0, 0x10, 0x03, Cable_2});
+    source.sourceMIDItoPipe(ChannelMessage {0xE1, 0x7F, 0x7F});
+    source.sourceMIDItoPipe(ChannelMessage {0xB0, 0x11, 0x04});
+    source.sourceMIDItoPipe(ChannelMessage {0xB0, 0x10, 0x05});
+    EXPECT_EQ(pipe.getNumPending(), 4);
+
+    InSequence seq;
+    EXPECT_CALL(sink, sinkMIDIfromPipe(ChannelMessage {0xB0, 0x10, 0x05}));
+    EXPECT_CALL(sink, sinkMIDIfromPipe(ChannelMessage {0xE1, 0x7F, 0x7F}));
+    EXPECT_CALL(sink,
+                sinkMIDIfromPipe(ChannelMessage {0xB0, 0x10, 0x03, Cable_2}));
+    EXPECT_CALL(sink, sinkMIDIfromPipe(ChannelMessage {0xB0, 0x11, 0x04}));
+    pipe.flush();
+    EXPECT_EQ(pipe.getNumPending(), 0);
+}
+
+TEST(CoalescingMIDI_Pipe, boundedUpdate) {
+    StrictMock<MockCoalescedMIDI_Sink> sink;
+    CoalescingMIDI_Pipe<8> pipe {2};
+    TrueMIDI_Source source;
+    source >> pipe >> sink;
+
+    for (uint8_t i = 0; i < 5; ++i)
+        source.sourceMIDItoPipe(ChannelMessage {0xB3, i, 0x10});
+
+    InSequence seq;
+    EXPECT_CALL(sink, sinkMIDIfromPipe(ChannelMessage {0xB3, 0, 0x10}));
+    EXPECT_CALL(sink, sinkMIDIfromPipe(ChannelMessage {0xB3, 1, 0x10}));
+    pipe.update();
+    ::testing::Mock::VerifyAndClear(&sink);
+    EXPECT_EQ(pipe.getNumPending(), 3);
+    EXPECT_CALL(sink, sinkMIDIfromPipe(ChannelMessage {0xB3, 2, 0x10}));
+    EXPECT_CALL(sink, sinkMIDIfromPipe(ChannelMessage {0xB3, 3, 0x10}));
+    pipe.update();
+    ::testing::Mock::VerifyAndClear(&sink);
+    EXPECT_CALL(sink, sinkMIDIfromPipe(ChannelMessage {0xB3, 4, 0x10}));
+    pipe.update();
+    ::testing::Mock::VerifyAndClear(&sink);
+    pipe.update();
+}
+
+TEST(CoalescingMIDI_Pipe, fullTableSendsOldest) {
+    StrictMock<MockCoalescedMIDI_Sink> sink;
+    CoalescingMIDI_Pipe<2> pipe;
+    TrueMIDI_Source source;
+    source >> pipe >> sink;
+
+    source.sourceMIDItoPipe(ChannelMessage {0xB0, 0x01, 0x01});
+    source.sourceMIDItoPipe(ChannelMessage {0xB0, 0x02, 0x02});
+    EXPECT_CALL(sink, sinkMIDIfromPipe(ChannelMessage {0xB0, 0x01, 0x01}));
+    source.sourceMIDItoPipe(ChannelMessage {0xB0, 0x03, 0x03});
+    ::testing::Mock::VerifyAndClear(&sink);
+    EXPECT_EQ(pipe.getNumPending(), 2);
+}
+
+TEST(CoalescingMIDI_Pipe, orderedMessagesFlushChannel) {
+    StrictMock<MockCoalescedMIDI_Sink> sink;
+    CoalescingMIDI_Pipe<8> pipe;
+    TrueMIDI_Source source;
+    source >> pipe >> sink;
+
+    source.sourceMIDItoPipe(ChannelMessage {0xB0, 0x07, 0x10});
+    source.sourceMIDItoPipe(ChannelMessage {0xB1, 0x07, 0x20});
+    {
+        // Note on the same channel: pending CC is sent first
+        InSequence seq;
+        EXPECT_CALL(sink, sinkMIDIfromPipe(ChannelMessage {0xB0, 0x07, 0x10}));
+        EXPECT_CALL(sink, sinkMIDIfromPipe(ChannelMessage {0x90, 0x3C, 0x7F}));
+        source.sourceMIDItoPipe(ChannelMessage {0x90, 0x3C, 0x7F});
+        ::testing::Mock::VerifyAndClear(&sink);
+    }
+    EXPECT_EQ(pipe.getNumPending(), 1);
+    {
+        // RPN selection and data entry are never coalesced
+        InSequence seq;
+        EXPECT_CALL(sink, sinkMIDIfromPipe(ChannelMessage {0xB1, 0x07, 0x20}));
+        EXPECT_CALL(sink, sinkMIDIfromPipe(ChannelMessage {0xB1, 0x65, 0x00}));
+        EXPECT_CALL(sink, sinkMIDIfromPipe(ChannelMessage {0xB1, 0x64, 0x00}));
+        EXPECT_CALL(sink, sinkMIDIfromPipe(ChannelMessage {0xB1, 0x06, 0x02}));
+        EXPECT_CALL(sink, sinkMIDIfromPipe(ChannelMessage {0xB1, 0x06, 0x03}));
+        source.sourceMIDItoPipe(ChannelMessage {0xB1, 0x65, 0x00});
+        source.sourceMIDItoPipe(ChannelMessage {0xB1, 0x64, 0x00});
+        source.sourceMIDItoPipe(ChannelMessage {0xB1, 0x06, 0x02});
+        source.sourceMIDItoPipe(ChannelMessage {0xB1, 0x06, 0x03});
+        ::testing::Mock::VerifyAndClear(&sink);
+    }
+    {
+        // Other message types are forwarded immediately
+        RealTimeMessage msg {0xF8};
+        EXPECT_CALL(sink, sinkMIDIfromPipe(msg));
+        source.sourceMIDItoPipe(ChannelMessage {0xB2, 0x01, 0x01});
+        source.sourceMIDItoPipe(msg);
+        ::testing::Mock::VerifyAndClear(&sink);
+    }
+    EXPECT_EQ(pipe.getNumPending(), 1);
+}
+
+struct CoalescingStaller : MIDIStaller {
+    void handleStall() override {}
+};
+
+TEST(CoalescingMIDI_Pipe, stalled) {
+    StrictMock<MockCoalescedMIDI_Sink> sink;
+    CoalescingMIDI_Pipe<8> pipe;
+    TrueMIDI_Source source;
+    source >> pipe >> sink;
+    // A second source that stalls the shared sink
+    TrueMIDI_Source other;
+    MIDI_Pipe otherPipe;
+    other >> otherPipe >> sink;
+    CoalescingStaller staller;
+
+    source.sourceMIDItoPipe(ChannelMessage {0xB0, 0x01, 0x01});
+    other.stall(&staller);
+    pipe.update();
+    EXPECT_EQ(pipe.getNumPending(), 1);
+    other.unstall(&staller);
+    EXPECT_CALL(sink, sinkMIDIfromPipe(ChannelMessage {0xB0, 0x01, 0x01}));
+    pipe.update();
+}
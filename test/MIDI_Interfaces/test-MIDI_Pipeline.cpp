@@ -0,0 +1,124 @@
+#include <MIDI_Interfaces/MIDI_Pipeline.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+USING_CS_NAMESPACE;
+using namespace MIDI_Stages;
+using ::testing::InSequence;
+using ::testing::StrictMock;
+
+struct MockPipelineMIDI_Sink : TrueMIDI_Sink {
+    MOCK_METHOD(void, sinkMIDIfromPipe, (ChannelMessage), (override));
+    MOCK_METHOD(void, sinkMIDIfromPipe, (SysExMessage), (override));
+    MOCK_METHOD(void, sinkMIDIfromPipe, (SysCommonMessage), (override));
+    MOCK_METHOD(void, sinkMIDIfromPipe, (RealTimeMessage), (override));
+};
+
+TEST(MIDI_Pipeline, empty) {
+    StrictMock<MockPipelineMIDI_Sink> sink;
+    MIDI_Pipeline<> pipeline;
+    TrueMIDI_Source source;
+    source >> pipeline >> sink;
+
+    InSequence seq;
+    EXPECT_CALL(sink, sinkMIDIfromPipe(ChannelMessage {0x93, 0x10, 0x7F}));
+    EXPECT_CALL(sink, sinkMIDIfromPipe(SysExMessage {nullptr, 0, Cable_2}));
+    EXPECT_CALL(sink, sinkMIDIfromPipe(SysCommonMessage {0xF3, 0x01, 0x00}));
+    EXPECT_CALL(sink, sinkMIDIfromPipe(RealTimeMessage {0xF8}));
+    source.sourceMIDItoPipe(ChannelMessage {0x93, 0x10, 0x7F});
+    source.sourceMIDItoPipe(SysExMessage {nullptr, 0, Cable_2});
+    source.sourceMIDItoPipe(SysCommonMessage {0xF3, 0x01, 0x00});
+    source.sourceMIDItoPipe(RealTimeMessage {0xF8});
+}
+
+TEST(MIDI_Pipeline, filterTransposeRemap) {
+    StrictMock<MockPipelineMIDI_Sink> sink;
+    MIDI_Pipeline<ChannelFilter<1>, Transpose<+12>, CableRemap<1, 2>> pipeline;
+    TrueMIDI_Source source;
+    source >> pipeline >> sink;
+
+    InSequence seq;
+    EXPECT_CALL(sink, sinkMIDIfromPipe(
+                          ChannelMessage {0x90, 0x3C + 12, 0x7F, Cable_2}));
+    EXPECT_CALL(sink, sinkMIDIfromPipe(
+                          ChannelMessage {0xB0, 0x07, 0x10, Cable_3}));
+    EXPECT_CALL(sink, sinkMIDIfromPipe(RealTimeMessage {0xF8, Cable_2}));
+    source.sourceMIDItoPipe(ChannelMessage {0x90, 0x3C, 0x7F});
+    // Wrong channel
+    source.sourceMIDItoPipe(ChannelMessage {0x91, 0x3C, 0x7F});
+    // Note out of range after transposing
+    source.sourceMIDItoPipe(ChannelMessage {0x80, 0x78, 0x7F});
+    // Not a note, different cable
+    source.sourceMIDItoPipe(ChannelMessage {0xB0, 0x07, 0x10, Cable_3});
+    source.sourceMIDItoPipe(RealTimeMessage {0xF8});
+}
+
+TEST(MIDI_Pipeline, messageTypeFilterDrop) {
+    // Same filter as in the MIDI_Pipes-Filter example
+    using Pipeline =
+        MIDI_Pipeline<MessageTypeFilter<MIDIMessageType::NoteOff,
+                                        MIDIMessageType::NoteOn>,
+                      Drop<SysExMessage, SysCommonMessage>, SetChannel<5>,
+                      Transpose<-12>>;
+    StrictMock<MockPipelineMIDI_Sink> sink;
+    Pipeline pipeline;
+    TrueMIDI_Source source;
+    source >> pipeline >> sink;
+
+    InSequence seq;
+    EXPECT_CALL(sink, sinkMIDIfromPipe(ChannelMessage {0x94, 0x30, 0x7F}));
+    EXPECT_CALL(sink, sinkMIDIfromPipe(ChannelMessage {0x84, 0x00, 0x40}));
+    EXPECT_CALL(sink, sinkMIDIfromPipe(RealTimeMessage {0xFA}));
+    source.sourceMIDItoPipe(ChannelMessage {0x98, 0x3C, 0x7F});
+    source.sourceMIDItoPipe(ChannelMessage {0x8F, 0x0C, 0x40});
+    source.sourceMIDItoPipe(ChannelMessage {0xE0, 0x12, 0x34});
+    source.sourceMIDItoPipe(SysExMessage {nullptr, 0});
+    source.sourceMIDItoPipe(SysCommonMessage {0xF6, 0x00, 0x00});
+    source.sourceMIDItoPipe(RealTimeMessage {0xFA});
+}
+
+/// Custom stage with state that can be changed at run time.
+struct Velocity : PassThrough {
+    using PassThrough::map;
+    bool map(ChannelMessage &msg) {
+        if (msg.getMessageType() == MIDIMessageType::NoteOn && msg.data2 != 0)
+            msg.data2 = velocity;
+        return true;
+    }
+    uint8_t velocity = 0x7F;
+};
+
+TEST(MIDI_Pipeline, customStage) {
+    StrictMock<MockPipelineMIDI_Sink> sink;
+    MIDI_Pipeline<SetChannel<2>, Velocity> pipeline;
+    TrueMIDI_Source source;
+    source >> pipeline >> sink;
+
+    pipeline.getStage<1>().velocity = 0x40;
+    InSequence seq;
+    EXPECT_CALL(sink, sinkMIDIfromPipe(ChannelMessage {0x91, 0x3C, 0x40}));
+    EXPECT_CALL(sink, sinkMIDIfromPipe(ChannelMessage {0x91, 0x3C, 0x00}));
+    EXPECT_CALL(sink, sinkMIDIfromPipe(ChannelMessage {0x81, 0x3C, 0x10}));
+    source.sourceMIDItoPipe(ChannelMessage {0x90, 0x3C, 0x01});
+    source.sourceMIDItoPipe(ChannelMessage {0x90, 0x3C, 0x00});
+    source.sourceMIDItoPipe(ChannelMessage {0x80, 0x3C, 0x10});
+
+    ChannelMessage msg {0x95, 0x3C, 0x7F};
+    EXPECT_TRUE(pipeline.map(msg));
+    EXPECT_EQ(msg, (ChannelMessage {0x91, 0x3C, 0x40}));
+}
+
+TEST(MIDI_Pipeline, through) {
+    StrictMock<MockPipelineMIDI_Sink> sink1, sink2;
+    MIDI_Pipeline<Transpose<+1>> pipeline1;
+    MIDI_Pipe pipe2;
+    TrueMIDI_Source source;
+    source >> pipeline1 >> sink1;
+    source >> pipe2 >> sink2;
+
+    // The mapping is not applied to the “through” output
+    EXPECT_CALL(sink1, sinkMIDIfromPipe(ChannelMessage {0x90, 0x3D, 0x7F}));
+    EXPECT_CALL(sink2, sinkMIDIfromPipe(ChannelMessage {0x90, 0x3C, 0x7F}));
+    source.sourceMIDItoPipe(ChannelMessage {0x90, 0x3C, 0x7F});
+}
@@ -2270,3 +2270,63 @@ TEST(MIDI_Pipes, StreamMIDIInterfaceSysExChunks) {
     testing::Mock::VerifyAndClear(&midiB);
     testing::Mock::VerifyAndClear(&ArduinoMock::getInstance());
 }
+
+// -------------------------------------------------------------------------- //
+
+TEST(MIDI_Pipes, routingCache4x4) {
+    MIDI_Pipe::setRoutingCacheEnabled(true);
+    StrictMock<MockMIDI_Sink> sinks[4];
+    MIDI_PipeFactory<16> pipes;
+    TrueMIDI_Source sources[4];
+    for (auto &source : sources)
+        for (auto &sink : sinks)
+            source >> pipes >> sink;
+
+    ChannelMessage msg {0x93, 0x10, 0x7F, Cable_6};
+    for (auto &source : sources) {
+        for (auto &sink : sinks)
+            EXPECT_CALL(sink, sinkMIDIfromPipe(msg));
+        source.sourceMIDItoPipe(msg);
+        for (auto &sink : sinks)
+            ::testing::Mock::VerifyAndClear(&sink);
+    }
+
+    // Disconnecting a pipe updates the routes of the other pipes
+    pipes[4].disconnect(); // sources[1] → sinks[0]
+    pipes[0].disconnect(); // sources[0] → sinks[0]
+    for (auto &sink : sinks)
+        if (&sink != &sinks[0])
+            EXPECT_CALL(sink, sinkMIDIfromPipe(msg));
+    sources[1].sourceMIDItoPipe(msg);
+    for (auto &sink : sinks)
+        ::testing::Mock::VerifyAndClear(&sink);
+    for (auto &sink : sinks)
+        EXPECT_CALL(sink, sinkMIDIfromPipe(msg));
+    sources[3].sourceMIDItoPipe(msg);
+    for (auto &sink : sinks)
+        ::testing::Mock::VerifyAndClear(&sink);
+    MIDI_Pipe::setRoutingCacheEnabled(false);
+}
+
+TEST(MIDI_Pipes, routingCacheMoveSink) {
+    MIDI_Pipe::setRoutingCacheEnabled(true);
+    StrictMock<MockMIDI_Sink> sink1;
+    MIDI_Pipe pipe1, pipe2;
+    TrueMIDI_Source source1, source2;
+    source1 >> pipe1 >> sink1;
+    source2 >> pipe2 >> sink1;
+
+    // Messages from source2 skip the through input of pipe1
+    ChannelMessage msg {0x93, 0x10, 0x7F, Cable_6};
+    EXPECT_CALL(sink1, sinkMIDIfromPipe(msg));
+    source2.sourceMIDItoPipe(msg);
+    ::testing::Mock::VerifyAndClear(&sink1);
+
+    // The cached sink is updated when the sink is moved
+    StrictMock<MockMIDI_Sink> sink2;
+    MIDI_Sink::swap(sink1, sink2);
+    EXPECT_CALL(sink2, sinkMIDIfromPipe(msg));
+    source2.sourceMIDItoPipe(msg);
+    ::testing::Mock::VerifyAndClear(&sink2);
+    MIDI_Pipe::setRoutingCacheEnabled(false);
+}
@@ -184,4 +184,109 @@ TEST(StreamMIDI_Interface, readRealTimeUpdate) {
     RealTimeMessage expected = {0xF8};
     EXPECT_CALL(callbacks, onRealTimeMessage(&midi, expected));
     midi.update();
-}
\ No newline at end of file
+}
+class MockBatchMIDI_Callbacks : public MIDI_Callbacks {
+  public:
+    using cmvec = std::vector<ChannelMessage>;
+    MOCK_METHOD(void, onChannelMessages, (MIDI_Interface *, cmvec), ());
+    MOCK_METHOD(void, onRealTimeMessage, (MIDI_Interface *, RealTimeMessage),
+                ());
+    void onChannelMessages(MIDI_Interface &midi, const ChannelMessage *msgs,
+                           size_t count) override {
+        onChannelMessages(&midi, cmvec(msgs, msgs + count));
+    }
+    void onRealTimeMessage(MIDI_Interface &midi, RealTimeMessage m) override {
+        onRealTimeMessage(&midi, m);
+    }
+};
+
+TEST(StreamMIDI_Interface, readChannelMessageBatches) {
+    using cmvec = MockBatchMIDI_Callbacks::cmvec;
+    ::testing::StrictMock<MockBatchMIDI_Callbacks> callbacks;
+    TestStream stream;
+    StreamMIDI_Interface midi = stream;
+    midi.setCallbacks(callbacks);
+    midi.begin();
+    for (auto v : {0x94, 0x12, 0x34, 0xB0, 0x07, 0x10, 0x07, 0x11, // 3 msgs
+                   0xF8,                                           // clock
+                   0x80, 0x12, 0x00})                              // 1 msg
+        stream.toRead.push(v);
+    ::testing::InSequence seq;
+    EXPECT_CALL(callbacks, onChannelMessages(&midi, cmvec {
+                                                        {0x94, 0x12, 0x34},
+                                                        {0xB0, 0x07, 0x10},
+                                                        {0xB0, 0x07, 0x11},
+                                                    }));
+    EXPECT_CALL(callbacks, onRealTimeMessage(&midi, RealTimeMessage {0xF8}));
+    EXPECT_CALL(callbacks,
+                onChannelMessages(&midi, cmvec {{0x80, 0x12, 0x00}}));
+    midi.update();
+}
+
+TEST(StreamMIDI_Interface, readChannelMessageBatchFull) {
+    using cmvec = MockBatchMIDI_Callbacks::cmvec;
+    ::testing::StrictMock<MockBatchMIDI_Callbacks> callbacks;
+    TestStream stream;
+    StreamMIDI_Interface midi = stream;
+    midi.setCallbacks(callbacks);
+    midi.begin();
+    constexpr uint8_t N = MIDI_CALLBACK_BATCH_SIZE + 4;
+    cmvec expected;
+    for (uint8_t i = 0; i < N; ++i) {
+        for (auto v : {0xB0, 0x10, int(i)})
+            stream.toRead.push(v);
+        expected.push_back({0xB0, 0x10, i});
+    }
+    ::testing::InSequence seq;
+    auto split = expected.begin() + MIDI_CALLBACK_BATCH_SIZE;
+    EXPECT_CALL(callbacks,
+                onChannelMessages(&midi, cmvec(expected.begin(), split)));
+    EXPECT_CALL(callbacks,
+                onChannelMessages(&midi, cmvec(split, expected.end())));
+    midi.update();
+}
+
+TEST(StreamMIDI_Interface, readChannelMessageBatchFineGrained) {
+    struct Callbacks : FineGrainedMIDI_Callbacks<Callbacks> {
+        // Handles the entire batch at once
+        void onChannelMessageBatch(const ChannelMessage *msgs, size_t count) {
+            batches.emplace_back(msgs, msgs + count);
+        }
+        std::vector<std::vector<ChannelMessage>> batches;
+    } callbacks;
+    struct DefaultCallbacks : FineGrainedMIDI_Callbacks<DefaultCallbacks> {
+        // Individual callbacks are still called by the default batch handler
+        void onNoteOn(Channel channel, uint8_t note, uint8_t, Cable) {
+            notes.push_back({note, channel});
+        }
+        std::vector<MIDIAddress> notes;
+    } defaultCallbacks;
+
+    TestStream stream;
+    StreamMIDI_Interface midi = stream;
+    midi.begin();
+    u8vec data {0x90, 0x3C, 0x7F, 0x3D, 0x7F, 0x91, 0x3E, 0x7F};
+    std::vector<ChannelMessage> expected {
+        {0x90, 0x3C, 0x7F},
+        {0x90, 0x3D, 0x7F},
+        {0x91, 0x3E, 0x7F},
+    };
+
+    midi.setCallbacks(callbacks);
+    for (auto v : data)
+        stream.toRead.push(v);
+    midi.update();
+    ASSERT_EQ(callbacks.batches.size(), 1u);
+    EXPECT_EQ(callbacks.batches[0], expected);
+
+    midi.setCallbacks(defaultCallbacks);
+    for (auto v : data)
+        stream.toRead.push(v);
+    midi.update();
+    std::vector<MIDIAddress> expectedNotes {
+        {0x3C, Channel_1},
+        {0x3D, Channel_1},
+        {0x3E, Channel_2},
+    };
+    EXPECT_EQ(defaultCallbacks.notes, expectedNotes);
+}
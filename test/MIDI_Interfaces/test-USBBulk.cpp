@@ -154,3 +154,69 @@ TEST(USB, BulkTX) {
     run_experiment(tx);
     EXPECT_EQ(tx.data_challenge, tx.data_response);
 }
+
+#include <MIDI_Interfaces/USBMIDI/LowLevel/BulkRX.hpp>
+
+namespace {
+
+/// Receives packets synchronously: @ref receive copies the data into the
+/// buffer of the pending read and calls the RX callback.
+struct TestBulkRX : cs::BulkRX<TestBulkRX, uint32_t, PacketSize> {
+    void rx_start(void *data, uint32_t) {
+        EXPECT_EQ(pending, nullptr);
+        pending = static_cast<uint8_t *>(data);
+    }
+    void rx_start_isr(void *data, uint32_t size) { rx_start(data, size); }
+
+    bool receive(const std::vector<uint32_t> &packet) {
+        if (pending == nullptr)
+            return false;
+        std::memcpy(pending, packet.data(), packet.size() * sizeof(uint32_t));
+        pending = nullptr;
+        rx_callback(packet.size() * sizeof(uint32_t));
+        return true;
+    }
+
+    TestBulkRX() { reset(); }
+
+    uint8_t *pending = nullptr;
+};
+
+} // namespace
+
+TEST(USB, BulkRXReadMultiple) {
+    TestBulkRX rx;
+    uint32_t messages[64];
+    EXPECT_EQ(rx.read(messages, 64), 0u);
+    std::vector<uint32_t> expected;
+    // Fill the queue completely (16 packets of 64 bytes)
+    for (uint32_t p = 0; p < 16; ++p) {
+        std::vector<uint32_t> packet;
+        for (uint32_t i = 0; i < (p % 2 ? 16 : 3); ++i)
+            packet.push_back(p * 100 + i);
+        expected.insert(expected.end(), packet.begin(), packet.end());
+        ASSERT_TRUE(rx.receive(packet));
+    }
+    // Queue full, reading stopped
+    EXPECT_FALSE(rx.receive({1}));
+    std::vector<uint32_t> result;
+    // Single read
+    uint32_t message;
+    ASSERT_TRUE(rx.read(message));
+    result.push_back(message);
+    // Partial reads of a packet
+    uint32_t n = rx.read(messages, 1);
+    ASSERT_EQ(n, 1u);
+    result.insert(result.end(), messages, messages + n);
+    // Reading resumes as soon as a packet has been consumed
+    n = rx.read(messages, 10);
+    ASSERT_EQ(n, 10u);
+    result.insert(result.end(), messages, messages + n);
+    EXPECT_TRUE(rx.receive({12345, 67890}));
+    expected.push_back(12345);
+    expected.push_back(67890);
+    while ((n = rx.read(messages, 64)) > 0)
+        result.insert(result.end(), messages, messages + n);
+    EXPECT_EQ(result, expected);
+    EXPECT_FALSE(rx.read(message));
+}
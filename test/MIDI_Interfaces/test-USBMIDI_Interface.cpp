@@ -210,4 +210,144 @@ TEST(USBMIDI_Interface, readSysEx) {
     };
     EXPECT_EQ(result, expected);
     EXPECT_EQ(sysex.cable, Cable_6);
-}
\ No newline at end of file
+}
+TEST(USBMIDI_Interface, sendOncePerLoop) {
+    StrictMock<USBMIDI_Interface> midi;
+    midi.sendOncePerLoop();
+    Sequence seq;
+    EXPECT_CALL(midi.backend, write(0x89, 0x93, 0x55, 0x66)).InSequence(seq);
+    EXPECT_CALL(midi.backend, write(0x89, 0x93, 0x56, 0x67)).InSequence(seq);
+    midi.sendNoteOn({0x55, Channel_4, Cable_9}, 0x66);
+    midi.sendNoteOn({0x56, Channel_4, Cable_9}, 0x67);
+    testing::Mock::VerifyAndClear(&midi.backend);
+    EXPECT_CALL(midi.backend, sendNow());
+    midi.flushLoopBatch();
+}
+
+struct BatchingUSBMIDIBackend {
+    using MIDIUSBPacket_t = AH::Array<uint8_t, 4>;
+
+    MOCK_METHOD(void, write, (MIDIUSBPacket_t));
+    MOCK_METHOD(void, writeMultiple, (std::vector<uint32_t>));
+    MOCK_METHOD(MIDIUSBPacket_t, read, ());
+    MOCK_METHOD(void, sendNow, ());
+    void write(const MIDIUSBPacket_t *packets, uint32_t num) {
+        std::vector<uint32_t> words;
+        for (uint32_t i = 0; i < num; ++i)
+            words.push_back(bytes_to_u32(packets[i]));
+        writeMultiple(words);
+    }
+    static bool preferImmediateSend() { return true; }
+};
+
+TEST(USBMIDI_Interface, sendOncePerLoopBatched) {
+    GenericUSBMIDI_Interface<StrictMock<BatchingUSBMIDIBackend>> midi;
+    EXPECT_TRUE(midi.alwaysSendsImmediately());
+    midi.sendOncePerLoop();
+    EXPECT_FALSE(midi.alwaysSendsImmediately());
+    EXPECT_TRUE(midi.sendsOncePerLoop());
+    midi.sendNoteOn({0x55, Channel_4, Cable_9}, 0x66);
+    midi.sendControlChange({0x10, Channel_2, Cable_1}, 0x7F);
+    testing::Mock::VerifyAndClear(&midi.backend);
+
+    Sequence seq;
+    std::vector<uint32_t> expected {0x66559389, 0x7F10B10B};
+    EXPECT_CALL(midi.backend, writeMultiple(expected)).InSequence(seq);
+    EXPECT_CALL(midi.backend, sendNow()).InSequence(seq);
+    MIDI_Interface::flushAllLoopBatches();
+    testing::Mock::VerifyAndClear(&midi.backend);
+
+    // Nothing was sent in this loop iteration
+    EXPECT_CALL(midi.backend, sendNow());
+    midi.flushLoopBatch();
+    testing::Mock::VerifyAndClear(&midi.backend);
+
+    // Full batch buffer
+    for (uint8_t i = 0; i < USB_MIDI_BATCH_SIZE; ++i)
+        midi.sendNoteOn({i, Channel_1}, 0x7F);
+    EXPECT_CALL(midi.backend,
+                writeMultiple(testing::SizeIs(USB_MIDI_BATCH_SIZE)));
+    midi.sendNoteOn({0x7F, Channel_1}, 0x7F);
+    testing::Mock::VerifyAndClear(&midi.backend);
+    EXPECT_CALL(midi.backend, writeMultiple(testing::SizeIs(1)));
+    EXPECT_CALL(midi.backend, sendNow());
+    midi.sendNow();
+    testing::Mock::VerifyAndClear(&midi.backend);
+
+    // Back to sending immediately, flushes anything that is still pending
+    EXPECT_CALL(midi.backend, sendNow());
+    midi.alwaysSendImmediately();
+    testing::Mock::VerifyAndClear(&midi.backend);
+    EXPECT_CALL(midi.backend, write(testing::_));
+    EXPECT_CALL(midi.backend, sendNow());
+    midi.sendNoteOn({0x55, Channel_4, Cable_9}, 0x66);
+}
+
+struct BatchReadingUSBMIDIBackend {
+    using MIDIUSBPacket_t = AH::Array<uint8_t, 4>;
+
+    MOCK_METHOD(void, write, (MIDIUSBPacket_t));
+    MOCK_METHOD(void, sendNow, ());
+    MIDIUSBPacket_t read() { throw std::logic_error("single read"); }
+    uint32_t read(MIDIUSBPacket_t *packets, uint32_t max) {
+        ++numReads;
+        uint32_t n = std::min<uint32_t>(max, incoming.size() - index);
+        std::copy_n(incoming.begin() + index, n, packets);
+        index += n;
+        return n;
+    }
+    static bool preferImmediateSend() { return true; }
+
+    std::vector<MIDIUSBPacket_t> incoming;
+    size_t index = 0;
+    size_t numReads = 0;
+};
+
+TEST(USBMIDI_Interface, readBatched) {
+    GenericUSBMIDI_Interface<StrictMock<BatchReadingUSBMIDIBackend>> midi;
+    for (uint8_t i = 0; i < USB_MIDI_BATCH_SIZE + 4; ++i)
+        midi.backend.incoming.push_back({{0x0B, 0xB0, i, 0x7F}});
+    midi.backend.incoming.push_back({{0x54, 0xF0, 0x55, 0x66}});
+    midi.backend.incoming.push_back({{0x56, 0x33, 0xF7, 0x00}});
+
+    for (uint8_t i = 0; i < USB_MIDI_BATCH_SIZE + 4; ++i) {
+        ASSERT_EQ(midi.read(), MIDIReadEvent::CHANNEL_MESSAGE);
+        EXPECT_EQ(midi.getChannelMessage(), ChannelMessage(0xB0, i, 0x7F));
+    }
+    EXPECT_EQ(midi.backend.numReads, 2u);
+    ASSERT_EQ(midi.read(), MIDIReadEvent::SYSEX_MESSAGE);
+    EXPECT_EQ(midi.getSysExMessage(),
+              SysExMessage({0xF0, 0x55, 0x66, 0x33, 0xF7}, Cable_6));
+    EXPECT_EQ(midi.read(), MIDIReadEvent::NO_MESSAGE);
+    EXPECT_EQ(midi.backend.numReads, 3u);
+    // New data after the backend ran dry
+    midi.backend.incoming.push_back({{0x09, 0x90, 0x3C, 0x40}});
+    ASSERT_EQ(midi.read(), MIDIReadEvent::CHANNEL_MESSAGE);
+    EXPECT_EQ(midi.getChannelMessage(), ChannelMessage(0x90, 0x3C, 0x40));
+}
+
+TEST(USBMIDI_Interface, sendOncePerLoopSwitchMode) {
+    GenericUSBMIDI_Interface<StrictMock<BatchingUSBMIDIBackend>> midi;
+    midi.sendOncePerLoop();
+    midi.sendNoteOn({0x55, Channel_4, Cable_9}, 0x66);
+    testing::Mock::VerifyAndClear(&midi.backend);
+
+    // Switching modes doesn't leave any packets behind in the batch
+    Sequence seq;
+    EXPECT_CALL(midi.backend, writeMultiple(std::vector<uint32_t> {0x66559389}))
+        .InSequence(seq);
+    EXPECT_CALL(midi.backend, sendNow()).InSequence(seq);
+    midi.alwaysSendImmediately();
+    testing::Mock::VerifyAndClear(&midi.backend);
+
+    midi.sendOncePerLoop();
+    midi.sendNoteOn({0x56, Channel_4, Cable_9}, 0x67);
+    testing::Mock::VerifyAndClear(&midi.backend);
+    // The packets are handed to the backend, but not sent immediately
+    EXPECT_CALL(midi.backend,
+                writeMultiple(std::vector<uint32_t> {0x67569389}));
+    midi.neverSendImmediately();
+    testing::Mock::VerifyAndClear(&midi.backend);
+    EXPECT_FALSE(midi.sendsOncePerLoop());
+    EXPECT_FALSE(midi.alwaysSendsImmediately());
+}
@@ -1,5 +1,6 @@
 #include <MIDI_Outputs/Bankable/CCPotentiometer.hpp>
 #include <MIDI_Outputs/CCPotentiometer.hpp>
+#include <MIDI_Outputs/CCPotentiometers.hpp>
 #include <MockMIDI_Interface.hpp>
 #include <gmock/gmock.h>
 
@@ -81,4 +82,44 @@ TEST(CCPotentiometer, invert) {
     pot.update();
 
     Mock::VerifyAndClear(&ArduinoMock::getInstance());
-}
\ No newline at end of file
+}
+
+TEST(CCPotentiometers, simple) {
+    MockMIDI_Interface midi;
+    Control_Surface.connectDefaultMIDI_Interface();
+
+    CCPotentiometers<3> pots({2, 3, 4}, {0x3C, Channel_7, Cable_13}, {2});
+    EXPECT_CALL(ArduinoMock::getInstance(), analogRead(2)).WillOnce(Return(0));
+    EXPECT_CALL(ArduinoMock::getInstance(), analogRead(3)).WillOnce(Return(0));
+    EXPECT_CALL(ArduinoMock::getInstance(), analogRead(4)).WillOnce(Return(0));
+    pots.begin();
+
+    // Only the inputs that changed are sent
+    EXPECT_CALL(ArduinoMock::getInstance(), analogRead(2))
+        .Times(3)
+        .WillRepeatedly(Return(512));
+    EXPECT_CALL(ArduinoMock::getInstance(), analogRead(3))
+        .Times(3)
+        .WillRepeatedly(Return(0));
+    EXPECT_CALL(ArduinoMock::getInstance(), analogRead(4))
+        .Times(3)
+        .WillRepeatedly(Return(512));
+    InSequence s;
+    EXPECT_CALL(
+        midi, sendChannelMessageImpl(ChannelMessage(0xB6, 0x3C, 16, Cable_13)));
+    EXPECT_CALL(
+        midi, sendChannelMessageImpl(ChannelMessage(0xB6, 0x40, 16, Cable_13)));
+    pots.update();
+    EXPECT_CALL(
+        midi, sendChannelMessageImpl(ChannelMessage(0xB6, 0x3C, 28, Cable_13)));
+    EXPECT_CALL(
+        midi, sendChannelMessageImpl(ChannelMessage(0xB6, 0x40, 28, Cable_13)));
+    pots.update();
+    EXPECT_CALL(
+        midi, sendChannelMessageImpl(ChannelMessage(0xB6, 0x3C, 37, Cable_13)));
+    EXPECT_CALL(
+        midi, sendChannelMessageImpl(ChannelMessage(0xB6, 0x40, 37, Cable_13)));
+    pots.update();
+
+    Mock::VerifyAndClear(&ArduinoMock::getInstance());
+}
@@ -191,4 +191,69 @@ TEST(NoteButtonBankable, pressAndChangeSettingAndRelease) {
     button.update();
 
     Mock::VerifyAndClear(&ArduinoMock::getInstance());
-}
\ No newline at end of file
+}
+// -------------------------------------------------------------------------- //
+
+/// Extended IO element with 16 inputs that are set by the test.
+class NoteButtonsInputs : public AH::ExtendedIOElement {
+  public:
+    NoteButtonsInputs() : ExtendedIOElement(16) {}
+
+    void pinModeBuffered(AH::pin_int_t, PinMode_t) override {}
+    void digitalWriteBuffered(AH::pin_int_t, PinStatus_t) override {}
+    PinStatus_t digitalReadBuffered(AH::pin_int_t p) override {
+        return (inputs >> p) & 1 ? HIGH : LOW;
+    }
+    AH::analog_t analogReadBuffered(AH::pin_int_t) override { return 0; }
+    void analogWriteBuffered(AH::pin_int_t, AH::analog_t) override {}
+    void begin() override {}
+    void updateBufferedOutputs() override {}
+    void updateBufferedInputs() override {}
+
+    uint16_t inputs = 0xFFFF;
+};
+
+TEST(NoteButtons, buttonBank) {
+    MockMIDI_Interface midi;
+    Control_Surface.connectDefaultMIDI_Interface();
+
+    NoteButtonsInputs io;
+    NoteButtons<8, AH::ButtonBank<8>> buttons {
+        {io, 4},
+        {0x10, Channel_3},
+        {4},
+    };
+    buttons.begin();
+
+    unsigned long now = 1000;
+    EXPECT_CALL(ArduinoMock::getInstance(), millis())
+        .WillRepeatedly(Invoke([&] { return now; }));
+    auto updateFor = [&](unsigned long duration) {
+        for (unsigned long i = 0; i < duration; ++i) {
+            ++now;
+            buttons.update();
+        }
+    };
+    updateFor(100);
+    Mock::VerifyAndClear(&midi);
+
+    // Press the third and fifth button
+    io.inputs &= ~(1u << (4 + 2) | 1u << (4 + 4));
+    EXPECT_CALL(midi, sendChannelMessageImpl(
+                          ChannelMessage(0x92, 0x18, 0x7F, Cable_1)));
+    EXPECT_CALL(midi, sendChannelMessageImpl(
+                          ChannelMessage(0x92, 0x20, 0x7F, Cable_1)));
+    updateFor(100);
+    Mock::VerifyAndClear(&midi);
+    EXPECT_EQ(buttons.getButtonState(2), AH::Button::Pressed);
+    EXPECT_EQ(buttons.getButtonState(3), AH::Button::Released);
+
+    // Release the fifth button
+    io.inputs |= 1u << (4 + 4);
+    EXPECT_CALL(midi, sendChannelMessageImpl(
+                          ChannelMessage(0x82, 0x20, 0x7F, Cable_1)));
+    updateFor(100);
+
+    Mock::VerifyAndClear(&midi);
+    Mock::VerifyAndClear(&ArduinoMock::getInstance());
+}
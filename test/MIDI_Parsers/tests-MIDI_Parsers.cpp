@@ -2,7 +2,9 @@
 
 #include <MIDI_Parsers/BufferPuller.hpp>
 #include <MIDI_Parsers/SerialMIDI_Parser.hpp>
+#include <MIDI_Parsers/SysExReassembler.hpp>
 #include <MIDI_Parsers/USBMIDI_Parser.hpp>
+#include <MIDI_Interfaces/BLEMIDI/BufferedBLEMIDIParser.hpp>
 
 using namespace cs;
 
@@ -864,4 +866,273 @@ TEST(SerialMIDIParser, realSysEx) {
     EXPECT_EQ(sparser.pull(puller), MIDIReadEvent::SYSEX_MESSAGE);
     EXPECT_EQ(sparser.getSysExMessage(), SysExMessage(data));
     EXPECT_EQ(sparser.pull(puller), MIDIReadEvent::NO_MESSAGE);
-}
\ No newline at end of file
+}
+
+// --------------------------- SysEx streaming ------------------------------ //
+
+TEST(USBMIDIParser, sysExStreaming) {
+    USBMIDI_Parser uparser;
+    uparser.setSysExStreaming(true);
+    Packet_t packets[] = {
+        {0x54, 0xF0, 0x51, 0x52}, {0x54, 0x53, 0x54, 0x55},
+        {0x09, 0x90, 0x3C, 0x7F}, {0x57, 0x56, 0x57, 0xF7},
+        {0x55, 0xF7, 0x00, 0x00},
+    };
+    auto puller = BufferPuller(packets);
+    EXPECT_EQ(uparser.pull(puller), MIDIReadEvent::SYSEX_CHUNK);
+    EXPECT_EQ(uparser.getSysExMessage(),
+              SysExMessage({0xF0, 0x51, 0x52}, Cable_6));
+    EXPECT_TRUE(uparser.getSysExMessage().isFirstChunk());
+    EXPECT_EQ(uparser.pull(puller), MIDIReadEvent::SYSEX_CHUNK);
+    EXPECT_EQ(uparser.getSysExMessage(),
+              SysExMessage({0x53, 0x54, 0x55}, Cable_6));
+    EXPECT_EQ(uparser.pull(puller), MIDIReadEvent::CHANNEL_MESSAGE);
+    EXPECT_EQ(uparser.getChannelMessage(), ChannelMessage(0x90, 0x3C, 0x7F));
+    EXPECT_EQ(uparser.pull(puller), MIDIReadEvent::SYSEX_MESSAGE);
+    EXPECT_EQ(uparser.getSysExMessage(),
+              SysExMessage({0x56, 0x57, 0xF7}, Cable_6));
+    EXPECT_TRUE(uparser.getSysExMessage().isLastChunk());
+    // No SysEx in progress anymore, end byte is ignored
+    EXPECT_EQ(uparser.pull(puller), MIDIReadEvent::NO_MESSAGE);
+}
+
+TEST(USBMIDIParser, sysExStreamingLarge) {
+    USBMIDI_Parser uparser;
+    uparser.setSysExStreaming(true);
+    std::vector<Packet_t> packets {{0x04, 0xF0, 0x00, 0x01}};
+    for (uint8_t i = 0; i < 200; ++i)
+        packets.push_back({0x04, uint8_t(i & 0x7F), 0x02, 0x03});
+    packets.push_back({0x05, 0xF7, 0x00, 0x00});
+    auto puller = BufferPuller(packets);
+    SysExReassembler<1024> reassembler;
+    size_t chunks = 0;
+    MIDIReadEvent evt;
+    while ((evt = uparser.pull(puller)) != MIDIReadEvent::NO_MESSAGE) {
+        ++chunks;
+        EXPECT_LE(uparser.getSysExMessage().length, 3);
+        bool complete = reassembler.add(uparser.getSysExMessage());
+        EXPECT_EQ(complete, evt == MIDIReadEvent::SYSEX_MESSAGE);
+    }
+    EXPECT_EQ(chunks, packets.size());
+    auto msg = reassembler.getMessage();
+    ASSERT_EQ(msg.length, 3 + 200 * 3 + 1);
+    EXPECT_TRUE(msg.isCompleteMessage());
+    EXPECT_EQ(msg.data[3 + 3 * 100], 100);
+}
+
+TEST(SerialMIDIParser, sysExStreaming) {
+    SerialMIDI_Parser sparser;
+    sparser.setSysExStreaming(true);
+    uint8_t data[] = {0xF0, 0x41, 0xF8, 0x42, 0x90, 0x3C, 0x7F};
+    auto puller = BufferPuller(data);
+    EXPECT_EQ(sparser.pull(puller), MIDIReadEvent::SYSEX_CHUNK);
+    EXPECT_EQ(sparser.getSysExMessage(), SysExMessage({0xF0}));
+    EXPECT_TRUE(sparser.isReceivingSysEx());
+    EXPECT_EQ(sparser.pull(puller), MIDIReadEvent::SYSEX_CHUNK);
+    EXPECT_EQ(sparser.getSysExMessage(), SysExMessage({0x41}));
+    EXPECT_EQ(sparser.pull(puller), MIDIReadEvent::REALTIME_MESSAGE);
+    EXPECT_EQ(sparser.pull(puller), MIDIReadEvent::SYSEX_CHUNK);
+    EXPECT_EQ(sparser.getSysExMessage(), SysExMessage({0x42}));
+    // Terminated by a channel message
+    EXPECT_EQ(sparser.pull(puller), MIDIReadEvent::SYSEX_MESSAGE);
+    EXPECT_EQ(sparser.getSysExMessage(), SysExMessage({0xF7}));
+    EXPECT_FALSE(sparser.isReceivingSysEx());
+    EXPECT_EQ(sparser.pull(puller), MIDIReadEvent::CHANNEL_MESSAGE);
+    EXPECT_EQ(sparser.getChannelMessage(), ChannelMessage(0x90, 0x3C, 0x7F));
+    EXPECT_EQ(sparser.pull(puller), MIDIReadEvent::NO_MESSAGE);
+}
+
+TEST(BufferedBLEMIDIParser, sysExStreaming) {
+    BufferedBLEMIDIParser<64> parser;
+    parser.setSysExStreaming(true);
+    const uint8_t packet1[] = {0x81, 0x82, 0xF0, 0x01, 0x02, 0x03};
+    const uint8_t packet2[] = {0x81, 0x04, 0x05, 0x83, 0xF7, 0x84, 0xF8};
+    parser.pushPacket({packet1, sizeof(packet1)});
+    parser.pushPacket({packet2, sizeof(packet2)});
+    AnyMIDIMessage msg;
+    ASSERT_TRUE(parser.popMessage(msg));
+    EXPECT_EQ(msg.eventType, MIDIReadEvent::SYSEX_CHUNK);
+    EXPECT_EQ(msg.message.sysexmessage, SysExMessage({0xF0}));
+    ASSERT_TRUE(parser.popMessage(msg));
+    EXPECT_EQ(msg.eventType, MIDIReadEvent::SYSEX_CHUNK);
+    EXPECT_EQ(msg.message.sysexmessage, SysExMessage({0x01, 0x02, 0x03}));
+    ASSERT_TRUE(parser.popMessage(msg));
+    EXPECT_EQ(msg.eventType, MIDIReadEvent::SYSEX_CHUNK);
+    EXPECT_EQ(msg.message.sysexmessage, SysExMessage({0x04, 0x05}));
+    ASSERT_TRUE(parser.popMessage(msg));
+    EXPECT_EQ(msg.eventType, MIDIReadEvent::SYSEX_MESSAGE);
+    EXPECT_EQ(msg.message.sysexmessage, SysExMessage({0xF7}));
+    ASSERT_TRUE(parser.popMessage(msg));
+    EXPECT_EQ(msg.eventType, MIDIReadEvent::REALTIME_MESSAGE);
+    EXPECT_FALSE(parser.popMessage(msg));
+}
+
+TEST(SysExReassembler, chunks) {
+    SysExReassembler<7> reassembler;
+    // Continuation without start is ignored
+    EXPECT_FALSE(reassembler.add(SysExMessage({0x01, 0x02})));
+    EXPECT_FALSE(reassembler.isReceiving());
+    EXPECT_FALSE(reassembler.add(SysExMessage({0xF0, 0x01}, Cable_2)));
+    // Chunks of other cables are ignored
+    EXPECT_FALSE(reassembler.add(SysExMessage({0x09, 0x09}, Cable_3)));
+    EXPECT_FALSE(reassembler.add(SysExMessage({0x02, 0x03}, Cable_2)));
+    EXPECT_TRUE(reassembler.add(SysExMessage({0x04, 0xF7}, Cable_2)));
+    EXPECT_EQ(reassembler.getMessage(),
+              SysExMessage({0xF0, 0x01, 0x02, 0x03, 0x04, 0xF7}, Cable_2));
+    // Too long
+    EXPECT_FALSE(reassembler.add(SysExMessage({0xF0, 0x01, 0x02, 0x03})));
+    EXPECT_FALSE(reassembler.add(SysExMessage({0x04, 0x05, 0x06, 0x07})));
+    EXPECT_TRUE(reassembler.hasOverflowed());
+    EXPECT_FALSE(reassembler.add(SysExMessage({0xF7})));
+    // A new message starts over
+    EXPECT_TRUE(reassembler.add(SysExMessage({0xF0, 0xF7})));
+    EXPECT_FALSE(reassembler.hasOverflowed());
+    EXPECT_EQ(reassembler.getMessage(), SysExMessage({0xF0, 0xF7}));
+}
+
+// ------------------------- Bulk Channel messages -------------------------- //
+
+TEST(SerialMIDIParser, pullChannelMessagesRunningStatus) {
+    SerialMIDI_Parser sparser;
+    uint8_t data[] = {0x90, 0x01, 0x02, 0x03, 0x04, 0xC0, 0x05,
+                      0x06, 0xB1, 0x07, 0x08, 0x09, 0x0A};
+    auto puller = BufferPuller(data);
+    std::vector<ChannelMessage> msgs(8, {0x00, 0x00, 0x00});
+    ASSERT_EQ(sparser.pullChannelMessages(puller, msgs.data(), 8), 6u);
+    EXPECT_EQ(msgs[0], ChannelMessage(0x90, 0x01, 0x02));
+    EXPECT_EQ(msgs[1], ChannelMessage(0x90, 0x03, 0x04));
+    EXPECT_EQ(msgs[2], ChannelMessage(0xC0, 0x05, 0x00));
+    EXPECT_EQ(msgs[3], ChannelMessage(0xC0, 0x06, 0x00));
+    EXPECT_EQ(msgs[4], ChannelMessage(0xB1, 0x07, 0x08));
+    EXPECT_EQ(msgs[5], ChannelMessage(0xB1, 0x09, 0x0A));
+    EXPECT_EQ(sparser.getChannelMessage(), msgs[5]);
+    EXPECT_EQ(puller.available(), 0u);
+}
+
+TEST(SerialMIDIParser, pullChannelMessagesSystemMessages) {
+    SerialMIDI_Parser sparser;
+    uint8_t data[] = {0x90, 0x01, 0x02, 0xF8, 0x03, 0x04,
+                      0xF3, 0x05, 0x06, 0x07, 0x91, 0x08, 0x09};
+    auto puller = BufferPuller(data);
+    std::vector<ChannelMessage> msgs(8, {0x00, 0x00, 0x00});
+    ASSERT_EQ(sparser.pullChannelMessages(puller, msgs.data(), 8), 1u);
+    EXPECT_EQ(msgs[0], ChannelMessage(0x90, 0x01, 0x02));
+    // Real-Time messages are handled by the normal parser
+    EXPECT_EQ(sparser.pull(puller), MIDIReadEvent::REALTIME_MESSAGE);
+    EXPECT_EQ(sparser.getRealTimeMessage().message, 0xF8);
+    ASSERT_EQ(sparser.pullChannelMessages(puller, msgs.data(), 8), 1u);
+    EXPECT_EQ(msgs[0], ChannelMessage(0x90, 0x03, 0x04));
+    // System Common messages as well
+    EXPECT_EQ(sparser.pullChannelMessages(puller, msgs.data(), 8), 0u);
+    EXPECT_EQ(sparser.pull(puller), MIDIReadEvent::SYSCOMMON_MESSAGE);
+    EXPECT_EQ(sparser.getSysCommonMessage(),
+              SysCommonMessage(0xF3, 0x05, 0x00));
+    // They cancel running status, so these data bytes are ignored
+    EXPECT_EQ(sparser.pullChannelMessages(puller, msgs.data(), 8), 0u);
+    EXPECT_EQ(sparser.pull(puller), MIDIReadEvent::CHANNEL_MESSAGE);
+    EXPECT_EQ(sparser.getChannelMessage(), ChannelMessage(0x91, 0x08, 0x09));
+    EXPECT_EQ(puller.available(), 0u);
+}
+
+TEST(SerialMIDIParser, pullChannelMessagesRealTimeInMessage) {
+    SerialMIDI_Parser sparser;
+    uint8_t data[] = {0x90, 0x01, 0xF8, 0x02, 0x03};
+    auto puller = BufferPuller(data);
+    std::vector<ChannelMessage> msgs(8, {0x00, 0x00, 0x00});
+    EXPECT_EQ(sparser.pullChannelMessages(puller, msgs.data(), 8), 0u);
+    EXPECT_EQ(sparser.pull(puller), MIDIReadEvent::REALTIME_MESSAGE);
+    ASSERT_EQ(sparser.pullChannelMessages(puller, msgs.data(), 8), 1u);
+    EXPECT_EQ(msgs[0], ChannelMessage(0x90, 0x01, 0x02));
+    // The last byte is the start of the next message
+    EXPECT_EQ(puller.available(), 0u);
+    uint8_t data2[] = {0x04};
+    auto puller2 = BufferPuller(data2);
+    EXPECT_EQ(sparser.pull(puller2), MIDIReadEvent::CHANNEL_MESSAGE);
+    EXPECT_EQ(sparser.getChannelMessage(), ChannelMessage(0x90, 0x03, 0x04));
+}
+
+TEST(SerialMIDIParser, pullChannelMessagesMaxMessages) {
+    SerialMIDI_Parser sparser;
+    uint8_t data[] = {0xE0, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07};
+    auto puller = BufferPuller(data);
+    std::vector<ChannelMessage> msgs(2, {0x00, 0x00, 0x00});
+    ASSERT_EQ(sparser.pullChannelMessages(puller, msgs.data(), 2), 2u);
+    EXPECT_EQ(msgs[1], ChannelMessage(0xE0, 0x03, 0x04));
+    EXPECT_EQ(puller.available(), 3u);
+    ASSERT_EQ(sparser.pullChannelMessages(puller, msgs.data(), 2), 1u);
+    EXPECT_EQ(msgs[0], ChannelMessage(0xE0, 0x05, 0x06));
+    EXPECT_EQ(puller.available(), 0u);
+}
+
+/// Parse random streams using the bulk parser, and compare the results to the
+/// normal parser.
+TEST(SerialMIDIParser, pullChannelMessagesRandom) {
+    std::mt19937 rng {0x1234};
+    auto randint = [&](int min, int max) {
+        return std::uniform_int_distribution<int>(min, max)(rng);
+    };
+    std::vector<uint8_t> stream;
+    for (int i = 0; i < 20000; ++i) {
+        int r = randint(0, 99);
+        if (r < 70) // data bytes (running status)
+            stream.push_back(randint(0x00, 0x7F));
+        else if (r < 90) // channel status
+            stream.push_back(randint(0x80, 0xEF));
+        else if (r < 95) // real-time
+            stream.push_back(randint(0xF8, 0xFF));
+        else // system common and SysEx
+            stream.push_back(randint(0xF0, 0xF7));
+    }
+
+    using Event = std::pair<MIDIReadEvent, MIDIMessage>;
+    auto getEvent = [](SerialMIDI_Parser &p, MIDIReadEvent evt) -> Event {
+        switch (evt) {
+            case MIDIReadEvent::CHANNEL_MESSAGE:
+                return {evt, p.getChannelMessage()};
+            case MIDIReadEvent::SYSCOMMON_MESSAGE:
+                return {evt, p.getSysCommonMessage()};
+            case MIDIReadEvent::REALTIME_MESSAGE:
+                return {evt, {p.getRealTimeMessage().message, 0x00, 0x00}};
+            case MIDIReadEvent::SYSEX_MESSAGE:
+            case MIDIReadEvent::SYSEX_CHUNK:
+                return {evt, {uint8_t(p.getSysExMessage().length), 0x00, 0x00}};
+            case MIDIReadEvent::NO_MESSAGE:
+            default: return {evt, {0x00, 0x00, 0x00}};
+        }
+    };
+
+    std::vector<Event> expected;
+    {
+        SerialMIDI_Parser parser;
+        auto puller = BufferPuller(stream);
+        MIDIReadEvent evt;
+        while ((evt = parser.pull(puller)) != MIDIReadEvent::NO_MESSAGE)
+            expected.push_back(getEvent(parser, evt));
+    }
+
+    for (size_t maxMessages : {1, 3, 64}) {
+        for (size_t chunkSize : {1, 7, 1000, 20000}) {
+            std::vector<Event> result;
+            SerialMIDI_Parser parser;
+            std::vector<ChannelMessage> msgs(maxMessages, {0x00, 0x00, 0x00});
+            for (size_t i = 0; i < stream.size(); i += chunkSize) {
+                size_t len = std::min(chunkSize, stream.size() - i);
+                auto puller = BufferPuller(stream.data() + i, len);
+                while (true) {
+                    size_t n = parser.pullChannelMessages(puller, msgs.data(),
+                                                          maxMessages);
+                    for (size_t j = 0; j < n; ++j)
+                        result.push_back(
+                            {MIDIReadEvent::CHANNEL_MESSAGE, msgs[j]});
+                    if (n == maxMessages)
+                        continue;
+                    MIDIReadEvent evt = parser.pull(puller);
+                    if (evt == MIDIReadEvent::NO_MESSAGE)
+                        break;
+                    result.push_back(getEvent(parser, evt));
+                }
+            }
+            EXPECT_EQ(result, expected) << maxMessages << ", " << chunkSize;
+        }
+    }
+}
@@ -0,0 +1,65 @@
+/**
+ * Measures the time it takes to dispatch incoming MIDI Note messages to the
+ * MIDI input elements, using the linear search through all elements, and
+ * using the dispatch index.
+ */
+
+#include <MIDI_Inputs/NoteCCKPValue.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace cs;
+
+static double benchmark(size_t numElements, bool indexed) {
+    MIDIInputDispatchIndexBase::setEnabled(indexed);
+    std::vector<std::unique_ptr<NoteValue>> elements;
+    std::vector<ChannelMessage> messages;
+    elements.reserve(numElements);
+    for (size_t i = 0; i < numElements; ++i) {
+        MIDIAddress address {int(i % 128), Channel(i / 128 % 16),
+                             Cable(i / 2048)};
+        elements.emplace_back(new NoteValue {address});
+    }
+    MIDIInputElementNote::rebuildDispatchIndex();
+
+    std::mt19937 rng {0x12345678};
+    std::uniform_int_distribution<size_t> dist {0, numElements - 1};
+    const size_t numMessages = 1 << 16;
+    messages.reserve(numMessages);
+    for (size_t i = 0; i < numMessages; ++i) {
+        size_t el = dist(rng);
+        messages.push_back({MIDIMessageType::NoteOn, Channel(el / 128 % 16),
+                            uint8_t(el % 128), uint8_t(i & 0x7F),
+                            Cable(el / 2048)});
+    }
+
+    using clock = std::chrono::steady_clock;
+    size_t matched = 0;
+    auto start = clock::now();
+    for (const auto &msg : messages)
+        matched += MIDIInputElementNote::updateAllWith(msg);
+    auto end = clock::now();
+    if (matched != numMessages)
+        std::fprintf(stderr, "Only %zu of %zu messages matched\n", matched,
+                     numMessages);
+
+    MIDIInputDispatchIndexBase::setEnabled(false);
+    elements.clear();
+    MIDIInputElementNote::rebuildDispatchIndex();
+    std::chrono::duration<double, std::nano> duration = end - start;
+    return duration.count() / numMessages;
+}
+
+int main() {
+    std::printf("%10s  %14s  %14s\n", "elements", "linear [ns]",
+                "indexed [ns]");
+    for (size_t n : {16, 128, 1024}) {
+        double linear = benchmark(n, false);
+        double indexed = benchmark(n, true);
+        std::printf("%10zu  %14.1f  %14.1f\n", n, linear, indexed);
+    }
+}
@@ -0,0 +1,68 @@
+/**
+ * Measures the time it takes to route MIDI messages through a 4×4 routing
+ * matrix of MIDI pipes (every source connected to every sink), with and
+ * without the routing cache.
+ */
+
+#include <MIDI_Interfaces/MIDI_Pipes.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace cs;
+
+struct CountingSink : TrueMIDI_Sink {
+    void sinkMIDIfromPipe(ChannelMessage msg) override { count += msg.data1; }
+    void sinkMIDIfromPipe(SysExMessage) override { ++count; }
+    void sinkMIDIfromPipe(SysCommonMessage) override { ++count; }
+    void sinkMIDIfromPipe(RealTimeMessage) override { ++count; }
+    size_t count = 0;
+};
+
+constexpr size_t N = 4;
+
+static double benchmark(bool cached) {
+    MIDI_Pipe::setRoutingCacheEnabled(cached);
+    CountingSink sinks[N];
+    TrueMIDI_Source sources[N];
+    MIDI_PipeFactory<N * N> pipes;
+    for (auto &source : sources)
+        for (auto &sink : sinks)
+            source >> pipes >> sink;
+
+    std::mt19937 rng {0x12345678};
+    std::uniform_int_distribution<int> dist {0, 0x7F};
+    const size_t numMessages = 1 << 18;
+    std::vector<ChannelMessage> messages;
+    messages.reserve(numMessages);
+    for (size_t i = 0; i < numMessages; ++i)
+        messages.push_back({MIDIMessageType::NoteOn, Channel(i % 16),
+                            uint8_t(dist(rng)), 0x7F});
+
+    using clock = std::chrono::steady_clock;
+    auto start = clock::now();
+    for (size_t i = 0; i < numMessages; ++i)
+        sources[i % N].sourceMIDItoPipe(messages[i]);
+    auto end = clock::now();
+
+    size_t total = 0, expected = 0;
+    for (auto &sink : sinks)
+        total += sink.count;
+    for (auto &msg : messages)
+        expected += N * msg.data1;
+    if (total != expected)
+        std::fprintf(stderr, "Received %zu instead of %zu\n", total, expected);
+
+    MIDI_Pipe::setRoutingCacheEnabled(false);
+    std::chrono::duration<double, std::nano> duration = end - start;
+    return duration.count() / numMessages;
+}
+
+int main() {
+    std::printf("%14s  %14s\n", "direct [ns]", "cached [ns]");
+    double direct = benchmark(false);
+    double cached = benchmark(true);
+    std::printf("%14.1f  %14.1f\n", direct, cached);
+}
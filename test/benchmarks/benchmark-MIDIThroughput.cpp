@@ -0,0 +1,596 @@
+/**
+ * Measures the throughput of the MIDI parsers and senders, using reproducible
+ * (seeded) workloads:
+ *
+ *  - `random`: a mix of Channel, SysEx, Real-Time and System Common messages,
+ *    generated like `test/tools/MIDI-random.py`.
+ *  - `running-status`: Channel messages on a few channels, serialized using
+ *    running status.
+ *  - `sysex`: large SysEx messages.
+ *
+ * The results are reported in nanoseconds per message and in megabytes per
+ * second. They can be compared against stored baselines to catch performance
+ * regressions:
+ *
+ *     benchmark-MIDIThroughput [--baseline <file>] [--update-baseline]
+ *                              [--tolerance <percent>] [--filter <substring>]
+ *                              [--repetitions <n>]
+ *
+ * Every benchmark is run `repetitions` times (default: 5), interleaved with
+ * the other benchmarks, and the fastest run is used.
+ *
+ * Absolute timings depend on the machine and its load, so they are not
+ * compared directly. Instead, the ratio of each result to its baseline is
+ * divided by the median of these ratios over all benchmarks in the same run,
+ * so a machine that is uniformly faster or slower doesn't matter. With
+ * `--baseline`, the program fails if any benchmark is more than `tolerance`
+ * percent slower than its baseline (default: 25 %), relative to the other
+ * benchmarks. Slowdowns that affect most benchmarks equally are only visible
+ * in the absolute change that is printed as well. With `--update-baseline`,
+ * the measured results are written to the baseline file instead.
+ *
+ * The baseline file records the compiler, build type and whether assertions
+ * are enabled. Results from a different configuration are not comparable:
+ * they are still printed, but they never cause a failure.
+ */
+
+#include <MIDI_Interfaces/BLEMIDI/BLEMIDIPacketBuilder.hpp>
+#include <MIDI_Interfaces/USBMIDI_Sender.hpp>
+#include <MIDI_Parsers/BLEMIDIParser.hpp>
+#include <MIDI_Parsers/BufferPuller.hpp>
+#include <MIDI_Parsers/SerialMIDI_Parser.hpp>
+#include <MIDI_Parsers/USBMIDI_Parser.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace cs;
+
+using Message = std::vector<uint8_t>;
+using Packet = USBMIDI_Parser::MIDIUSBPacket_t;
+
+struct Workload {
+    std::string name;
+    std::vector<Message> messages;
+    size_t getNumBytes() const {
+        size_t n = 0;
+        for (const auto &msg : messages)
+            n += msg.size();
+        return n;
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Workloads
+// ---------------------------------------------------------------------------
+
+class Generator {
+  public:
+    Generator(uint32_t seed) : rng(seed) {}
+
+    uint8_t randint(uint8_t min, uint8_t max) {
+        return std::uniform_int_distribution<int>(min, max)(rng);
+    }
+
+    Message channelMessage() {
+        uint8_t h = randint(0x80, 0xEF), d1 = randint(0, 0x7F),
+                d2 = randint(0, 0x7F);
+        if (h >= 0xC0 && h <= 0xDF)
+            return {h, d1};
+        return {h, d1, d2};
+    }
+    Message sysExMessage(size_t length) {
+        Message msg(length + 2);
+        msg.front() = 0xF0;
+        for (size_t i = 1; i <= length; ++i)
+            msg[i] = randint(0, 0x7F);
+        msg.back() = 0xF7;
+        return msg;
+    }
+    Message sysExMessage() {
+        return sysExMessage(
+            std::uniform_int_distribution<size_t>(1, MaxSysExLength)(rng));
+    }
+    Message realTimeMessage() {
+        const uint8_t rt[] = {0xF8, 0xFA, 0xFB, 0xFC, 0xFF};
+        return {rt[randint(0, 4)]};
+    }
+    Message sysCommonMessage() {
+        // Like MIDI-random.py, but with Tune Request instead of a stray
+        // SysEx End byte, so the message can be sent over USB as well.
+        switch (randint(0, 3)) {
+            case 0: return {0xF1, randint(0, 0x7F)};
+            case 1: return {0xF2, randint(0, 0x7F), randint(0, 0x7F)};
+            case 2: return {0xF3, randint(0, 0x7F)};
+            default: return {0xF6};
+        }
+    }
+    Message randomMessage() {
+        switch (randint(0, 3)) {
+            case 0: return channelMessage();
+            case 1: return sysExMessage();
+            case 2: return realTimeMessage();
+            default: return sysCommonMessage();
+        }
+    }
+
+    static constexpr size_t MaxSysExLength = 256;
+
+  private:
+    std::mt19937 rng;
+};
+
+Workload randomWorkload(size_t count) {
+    Generator gen {0};
+    Workload w {"random", {}};
+    for (size_t i = 0; i < count; ++i)
+        w.messages.push_back(gen.randomMessage());
+    return w;
+}
+
+Workload runningStatusWorkload(size_t count) {
+    Generator gen {1};
+    Workload w {"running-status", {}};
+    // Long runs of the same status byte: e.g. a fader or a note sequence
+    uint8_t header = 0x90;
+    for (size_t i = 0; i < count; ++i) {
+        if (gen.randint(0, 31) == 0) {
+            const uint8_t types[] = {0x80, 0x90, 0xB0, 0xE0};
+            header = types[gen.randint(0, 3)] | gen.randint(0, 3);
+        }
+        w.messages.push_back(
+            {header, gen.randint(0, 0x7F), gen.randint(0, 0x7F)});
+    }
+    return w;
+}
+
+Workload sysExWorkload(size_t count, size_t length) {
+    Generator gen {2};
+    Workload w {"sysex", {}};
+    for (size_t i = 0; i < count; ++i)
+        w.messages.push_back(gen.sysExMessage(length));
+    return w;
+}
+
+// ---------------------------------------------------------------------------
+// Encoding
+// ---------------------------------------------------------------------------
+
+/// Serial MIDI byte stream, omitting repeated status bytes of Channel
+/// messages.
+std::vector<uint8_t> encodeSerial(const Workload &w) {
+    std::vector<uint8_t> stream;
+    uint8_t runningHeader = 0;
+    for (const auto &msg : w.messages) {
+        bool channel = msg[0] < 0xF0;
+        bool skipHeader = channel && msg[0] == runningHeader;
+        if (msg[0] < 0xF8) // Real-Time messages don't affect running status
+            runningHeader = channel ? msg[0] : 0;
+        stream.insert(stream.end(), msg.begin() + skipHeader, msg.end());
+    }
+    return stream;
+}
+
+template <class Send>
+void sendUSB(USBMIDI_Sender &sender, const Message &msg, Send &&send) {
+    if (msg[0] < 0xF0)
+        sender.sendChannelMessage(
+            ChannelMessage {msg[0], msg[1], msg.size() > 2 ? msg[2] : uint8_t(0),
+                            Cable_1},
+            send);
+    else if (msg[0] == 0xF0)
+        sender.sendSysEx(SysExMessage {msg.data(), uint16_t(msg.size())},
+                         send);
+    else if (msg[0] >= 0xF8)
+        sender.sendRealTimeMessage(RealTimeMessage {msg[0]}, send);
+    else
+        sender.sendSysCommonMessage(
+            SysCommonMessage {msg[0], msg.size() > 1 ? msg[1] : uint8_t(0),
+                              msg.size() > 2 ? msg[2] : uint8_t(0), Cable_1},
+            send);
+}
+
+/// USB MIDI packets.
+std::vector<Packet> encodeUSB(const Workload &w) {
+    std::vector<Packet> packets;
+    USBMIDI_Sender sender;
+    auto send = [&](Cable cn, MIDICodeIndexNumber cin, uint8_t d0, uint8_t d1,
+                    uint8_t d2) {
+        packets.push_back(
+            {uint8_t((cn.getRaw() << 4) | uint8_t(cin)), d0, d1, d2});
+    };
+    for (const auto &msg : w.messages)
+        sendUSB(sender, msg, send);
+    return packets;
+}
+
+/// Add the message to the BLE packet builder, calling `send` whenever a
+/// packet is full.
+template <class Send>
+void buildBLE(BLEMIDIPacketBuilder &builder, const Message &msg,
+              uint16_t timestamp, Send &&send) {
+    auto flushAndRetry = [&](auto add) {
+        if (!add()) {
+            send(builder);
+            builder.reset();
+            add();
+        }
+    };
+    if (msg[0] == 0xF0) {
+        const uint8_t *data = msg.data();
+        size_t length = msg.size();
+        flushAndRetry([&] { return builder.addSysEx(data, length, timestamp); });
+        while (data) {
+            send(builder);
+            builder.reset();
+            builder.continueSysEx(data, length, timestamp);
+        }
+    } else if (msg[0] >= 0xF8) {
+        flushAndRetry([&] { return builder.addRealTime(msg[0], timestamp); });
+    } else if (msg[0] >= 0xF0) {
+        uint8_t d1 = msg.size() > 1 ? msg[1] : 0, d2 = msg.size() > 2 ? msg[2] : 0;
+        flushAndRetry([&] {
+            return builder.addSysCommon(msg.size() - 1, msg[0], d1, d2,
+                                        timestamp);
+        });
+    } else if (msg.size() == 3) {
+        flushAndRetry(
+            [&] { return builder.add3B(msg[0], msg[1], msg[2], timestamp); });
+    } else {
+        flushAndRetry([&] { return builder.add2B(msg[0], msg[1], timestamp); });
+    }
+}
+
+/// BLE MIDI packets with the default 20-byte payload (23-byte MTU).
+std::vector<Message> encodeBLE(const Workload &w) {
+    std::vector<Message> packets;
+    BLEMIDIPacketBuilder builder;
+    auto send = [&](const BLEMIDIPacketBuilder &b) {
+        packets.push_back(b.getPacket());
+    };
+    uint16_t timestamp = 0;
+    for (const auto &msg : w.messages)
+        buildBLE(builder, msg, timestamp++ & 0x1FFF, send);
+    if (!builder.empty())
+        send(builder);
+    return packets;
+}
+
+// ---------------------------------------------------------------------------
+// Measurement
+// ---------------------------------------------------------------------------
+
+/// The checksum of the last run, printed so the compiler can't optimize the
+/// work away.
+static size_t checksum = 0;
+
+/// Run the given function repeatedly, and return the shortest duration of a
+/// single run in nanoseconds.
+double measure(const std::function<size_t()> &run) {
+    using clock = std::chrono::steady_clock;
+    checksum = run(); // warm-up
+    double best = 1e300;
+    std::chrono::duration<double, std::nano> total {0};
+    for (int i = 0; i < 5 || (i < 1000 && total.count() < 100e6); ++i) {
+        auto start = clock::now();
+        size_t result = run();
+        auto end = clock::now();
+        if (result != checksum)
+            std::fprintf(stderr, "Inconsistent results: %zu != %zu\n", result,
+                         checksum);
+        std::chrono::duration<double, std::nano> duration = end - start;
+        best = std::min(best, duration.count());
+        total += duration;
+    }
+    return best;
+}
+
+size_t serialParse(const std::vector<uint8_t> &stream) {
+    SerialMIDI_Parser parser;
+    auto puller = BufferPuller(stream);
+    size_t events = 0;
+    while (parser.pull(puller) != MIDIReadEvent::NO_MESSAGE)
+        ++events;
+    return events;
+}
+
+/// Uses the bulk Channel message fast path, falling back to the normal parser
+/// for all other bytes.
+size_t serialParseBulk(const std::vector<uint8_t> &stream) {
+    SerialMIDI_Parser parser;
+    auto puller = BufferPuller(stream);
+    constexpr size_t MaxMessages = 64;
+    static std::vector<ChannelMessage> msgs(MaxMessages, {0x00, 0x00, 0x00});
+    size_t events = 0;
+    while (true) {
+        size_t n = parser.pullChannelMessages(puller, msgs.data(), MaxMessages);
+        events += n;
+        if (n == MaxMessages)
+            continue;
+        if (parser.pull(puller) == MIDIReadEvent::NO_MESSAGE)
+            break;
+        ++events;
+    }
+    return events;
+}
+
+size_t usbParse(const std::vector<Packet> &packets) {
+    USBMIDI_Parser parser;
+    auto puller = BufferPuller(packets);
+    size_t events = 0;
+    while (parser.pull(puller) != MIDIReadEvent::NO_MESSAGE)
+        ++events;
+    return events;
+}
+
+size_t bleParse(const std::vector<Message> &packets) {
+    SerialMIDI_Parser parser;
+    size_t events = 0;
+    for (const auto &packet : packets) {
+        BLEMIDIParser ble {packet.data(), packet.size()};
+        while (parser.pull(ble) != MIDIReadEvent::NO_MESSAGE)
+            ++events;
+    }
+    return events;
+}
+
+size_t usbSend(const Workload &w) {
+    static std::vector<Packet> packets;
+    packets.clear();
+    USBMIDI_Sender sender;
+    auto send = [&](Cable cn, MIDICodeIndexNumber cin, uint8_t d0, uint8_t d1,
+                    uint8_t d2) {
+        packets.push_back(
+            {uint8_t((cn.getRaw() << 4) | uint8_t(cin)), d0, d1, d2});
+    };
+    for (const auto &msg : w.messages)
+        sendUSB(sender, msg, send);
+    return packets.size();
+}
+
+size_t bleBuild(const Workload &w) {
+    BLEMIDIPacketBuilder builder;
+    size_t packets = 0, bytes = 0;
+    auto send = [&](const BLEMIDIPacketBuilder &b) {
+        ++packets;
+        bytes += b.getSize();
+    };
+    uint16_t timestamp = 0;
+    for (const auto &msg : w.messages)
+        buildBLE(builder, msg, timestamp++ & 0x1FFF, send);
+    return packets + bytes;
+}
+
+struct Result {
+    std::string name;
+    double nsPerMessage;
+    double megabytesPerSecond;
+};
+
+Result benchmark(const std::string &name, const Workload &w,
+                 const std::function<size_t()> &run) {
+    double ns = measure(run);
+    std::string fullName = name + "/" + w.name;
+    return {fullName, ns / w.messages.size(), w.getNumBytes() / ns * 1e3};
+}
+
+#ifndef BENCHMARK_BUILD_TYPE
+#define BENCHMARK_BUILD_TYPE ""
+#endif
+
+/// The configuration the results were measured in.
+std::string getConfiguration() {
+    std::string buildType = BENCHMARK_BUILD_TYPE;
+    return std::string("compiler ") + __VERSION__ + ", build type " +
+           (buildType.empty() ? "<none>" : buildType) +
+#ifdef NDEBUG
+           ", NDEBUG";
+#else
+           ", assertions enabled";
+#endif
+}
+
+// ---------------------------------------------------------------------------
+// Baselines
+// ---------------------------------------------------------------------------
+
+const std::string configurationPrefix = "# Configuration: ";
+
+std::map<std::string, double> readBaseline(const std::string &filename,
+                                           std::string &configuration) {
+    std::map<std::string, double> baseline;
+    std::ifstream file {filename};
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.compare(0, configurationPrefix.size(), configurationPrefix) ==
+            0)
+            configuration = line.substr(configurationPrefix.size());
+        if (line.empty() || line[0] == '#')
+            continue;
+        std::istringstream ss {line};
+        std::string name;
+        double ns;
+        if (ss >> name >> ns)
+            baseline[name] = ns;
+    }
+    return baseline;
+}
+
+void writeBaseline(const std::string &filename,
+                   const std::vector<Result> &results) {
+    std::ofstream file {filename};
+    file << "# Baseline results of benchmark-MIDIThroughput in ns/message.\n"
+            "# Update using: make benchmarks-update-baseline\n"
+         << configurationPrefix << getConfiguration() << '\n';
+    for (const auto &r : results)
+        file << r.name << ' ' << r.nsPerMessage << '\n';
+}
+
+/// Compare the results against the baseline, relative to the median change
+/// of all benchmarks. Returns the number of regressions. Benchmarks without a
+/// baseline are counted in @p missing.
+int compare(const std::map<std::string, double> &baseline,
+            const std::vector<Result> &results, double tolerance,
+            int &missing) {
+    int regressions = 0;
+    missing = 0;
+    std::vector<double> ratios;
+    for (const auto &r : results) {
+        auto it = baseline.find(r.name);
+        if (it != baseline.end())
+            ratios.push_back(r.nsPerMessage / it->second);
+    }
+    if (ratios.empty()) {
+        missing = int(results.size());
+        return 0;
+    }
+    std::sort(ratios.begin(), ratios.end());
+    size_t n = ratios.size();
+    double median = n % 2 ? ratios[n / 2]
+                          : (ratios[n / 2 - 1] + ratios[n / 2]) / 2;
+    std::printf("\nMedian change: %+.1f%%\n", (median - 1) * 100);
+    std::printf("\n%-34s %12s %12s %9s %9s\n", "benchmark", "baseline",
+                "ns/message", "absolute", "relative");
+    for (const auto &r : results) {
+        auto it = baseline.find(r.name);
+        if (it == baseline.end()) {
+            std::printf("%-34s %12s %12.2f %9s\n", r.name.c_str(), "-",
+                        r.nsPerMessage, "MISSING");
+            ++missing;
+            continue;
+        }
+        double absolute = (r.nsPerMessage / it->second - 1) * 100;
+        double relative = (r.nsPerMessage / it->second / median - 1) * 100;
+        bool regression = relative > tolerance;
+        regressions += regression;
+        std::printf("%-34s %12.2f %12.2f %+8.1f%% %+8.1f%%%s\n",
+                    r.name.c_str(), it->second, r.nsPerMessage, absolute,
+                    relative, regression ? "  REGRESSION" : "");
+    }
+    return regressions;
+}
+
+int main(int argc, char *argv[]) {
+    std::string baselineFile, filter;
+    bool update = false;
+    double tolerance = 25;
+    int repetitions = 5;
+    for (int i = 1; i < argc; ++i) {
+        if (!std::strcmp(argv[i], "--baseline") && i + 1 < argc)
+            baselineFile = argv[++i];
+        else if (!std::strcmp(argv[i], "--update-baseline"))
+            update = true;
+        else if (!std::strcmp(argv[i], "--tolerance") && i + 1 < argc)
+            tolerance = std::atof(argv[++i]);
+        else if (!std::strcmp(argv[i], "--filter") && i + 1 < argc)
+            filter = argv[++i];
+        else if (!std::strcmp(argv[i], "--repetitions") && i + 1 < argc)
+            repetitions = std::max(1, std::atoi(argv[++i]));
+        else {
+            std::fprintf(stderr,
+                         "Usage: %s [--baseline <file>] [--update-baseline] "
+                         "[--tolerance <percent>] [--filter <substring>] "
+                         "[--repetitions <n>]\n",
+                         argv[0]);
+            return 2;
+        }
+    }
+    if (update && baselineFile.empty()) {
+        std::fprintf(stderr, "--update-baseline requires --baseline\n");
+        return 2;
+    }
+
+    const Workload workloads[] = {
+        randomWorkload(10000),
+        runningStatusWorkload(100000),
+        sysExWorkload(64, 4096),
+    };
+
+    // Keep the fastest result of all repetitions
+    std::vector<Result> results;
+    std::map<std::string, size_t> checksums;
+    auto run = [&](const std::string &name, const Workload &w,
+                   const std::function<size_t()> &fn) {
+        if ((name + "/" + w.name).find(filter) == std::string::npos)
+            return;
+        Result r = benchmark(name, w, fn);
+        checksums[r.name] = checksum;
+        auto same = [&](const Result &o) { return o.name == r.name; };
+        auto it = std::find_if(results.begin(), results.end(), same);
+        if (it == results.end())
+            results.push_back(r);
+        else if (r.nsPerMessage < it->nsPerMessage)
+            *it = r;
+    };
+
+    std::printf("Configuration: %s\n", getConfiguration().c_str());
+    for (int rep = 0; rep < repetitions; ++rep) {
+        for (const auto &w : workloads) {
+            auto serial = encodeSerial(w);
+            run("serial-parse", w, [&] { return serialParse(serial); });
+        }
+        for (const auto &w : workloads) {
+            auto serial = encodeSerial(w);
+            run("serial-parse-bulk", w,
+                [&] { return serialParseBulk(serial); });
+        }
+        for (const auto &w : workloads) {
+            auto usb = encodeUSB(w);
+            run("usb-parse", w, [&] { return usbParse(usb); });
+        }
+        for (const auto &w : workloads) {
+            auto ble = encodeBLE(w);
+            run("ble-parse", w, [&] { return bleParse(ble); });
+        }
+        for (const auto &w : workloads)
+            run("usb-send", w, [&] { return usbSend(w); });
+        for (const auto &w : workloads)
+            run("ble-build", w, [&] { return bleBuild(w); });
+    }
+
+    std::printf("\n%-34s %12s %12s %12s\n", "benchmark", "ns/message", "MB/s",
+                "checksum");
+    for (const auto &r : results)
+        std::printf("%-34s %12.2f %12.2f %12zu\n", r.name.c_str(),
+                    r.nsPerMessage, r.megabytesPerSecond, checksums[r.name]);
+
+    if (baselineFile.empty())
+        return 0;
+    if (update) {
+        writeBaseline(baselineFile, results);
+        std::printf("\nWrote %zu results to %s\n", results.size(),
+                    baselineFile.c_str());
+        return 0;
+    }
+    std::string configuration;
+    auto baseline = readBaseline(baselineFile, configuration);
+    if (configuration != getConfiguration()) {
+        std::printf("\nWarning: the baselines were recorded in a different "
+                    "configuration, not comparing.\n"
+                    "  Baseline: %s\n  Current:  %s\n",
+                    configuration.empty() ? "<unknown>"
+                                          : configuration.c_str(),
+                    getConfiguration().c_str());
+        return 0;
+    }
+    int missing;
+    int regressions = compare(baseline, results, tolerance, missing);
+    if (missing > 0)
+        std::printf("\n%d benchmark(s) have no baseline, add them using "
+                    "--update-baseline\n",
+                    missing);
+    if (regressions > 0)
+        std::printf("\n%d benchmark(s) regressed by more than %.1f%%\n",
+                    regressions, tolerance);
+    return regressions > 0 || missing > 0 ? 1 : 0;
+}